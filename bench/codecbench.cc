@@ -0,0 +1,178 @@
+/*
+ * codecbench.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "codec.hh"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * \brief make up some text that compresses like prose does.
+ * \param size how many bytes we want.
+ * \param out where to put them.
+ */
+static void generate(std::size_t size, std::string &out)
+{
+  static const char *words[] = {"katoob ", "editor ", "the ", "text ", "of ", "and ",
+                                "unicode ", "file ", "a ", "bidi ", "line ", "to ",
+                                "document ", "is ", "in ", "save ", "export ", "\n"};
+  const unsigned n = sizeof(words) / sizeof(words[0]);
+
+  unsigned seed = 1;
+  out.clear();
+  out.reserve(size + 16);
+  while (out.size() < size) {
+    // A plain LCG, so every run compresses the same input.
+    seed = seed * 1103515245 + 12345;
+    out += words[(seed >> 16) % n];
+  }
+  out.resize(size);
+}
+
+/**
+ * \brief compress the whole input with one encoder, the way exporting worked before blocks.
+ */
+static bool encode_serial(Codec::Format format,
+                          const std::string &in,
+                          std::string &out,
+                          std::string &error)
+{
+  Codec *codec = Codec::create_encoder(format, -1, error);
+  if (!codec) {
+    return false;
+  }
+
+  bool ok = codec->process(in.data(), in.size(), out, true, error);
+  delete codec;
+  return ok;
+}
+
+/**
+ * \brief make sure what we compressed comes back as it was.
+ */
+static bool check(Codec::Format format, const std::string &in, const std::string &data)
+{
+  std::string out, error;
+  Codec *codec = Codec::create_decoder(format, error);
+  if (!codec) {
+    fprintf(stderr, "%s\n", error.c_str());
+    return false;
+  }
+
+  bool ok = codec->process(data.data(), data.size(), out, true, error);
+  delete codec;
+  if (!ok) {
+    fprintf(stderr, "%s\n", error.c_str());
+    return false;
+  }
+
+  return out == in;
+}
+
+/**
+ * \brief time the serial and the parallel compressor for one format.
+ * \param names the formats we were asked for, all of them if it's empty.
+ * \return false if either failed.
+ */
+static bool run(Codec::Format format,
+                const char *name,
+                const std::string &in,
+                const std::vector<std::string> &names)
+{
+  if (!names.empty() && std::find(names.begin(), names.end(), name) == names.end()) {
+    return true;
+  }
+
+  const double mb = in.size() / 1048576.0;
+  std::string serial, parallel, error;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  if (!encode_serial(format, in, serial, error)) {
+    fprintf(stderr, "%s: %s\n", name, error.c_str());
+    return false;
+  }
+  std::chrono::duration<double> serial_time = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  if (!Codec::encode(format, -1, in.data(), in.size(), parallel, error)) {
+    fprintf(stderr, "%s: %s\n", name, error.c_str());
+    return false;
+  }
+  std::chrono::duration<double> parallel_time = std::chrono::steady_clock::now() - start;
+
+  printf("%-5s serial   %9.2f MB/s %6.1f%%\n",
+         name,
+         mb / serial_time.count(),
+         100.0 * serial.size() / in.size());
+  printf("%-5s parallel %9.2f MB/s %6.1f%%  %.2fx\n",
+         name,
+         mb / parallel_time.count(),
+         100.0 * parallel.size() / in.size(),
+         serial_time.count() / parallel_time.count());
+
+  if (!check(format, in, parallel)) {
+    fprintf(stderr, "%s: the parallel output doesn't decompress to the input\n", name);
+    return false;
+  }
+
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  // The size of the input in MB, then the formats to time.
+  const long size = argc > 1 ? strtol(argv[1], NULL, 10) : 100;
+  if (size <= 0) {
+    fprintf(stderr, "Usage: %s [MB [FORMAT...]]\n", argv[0]);
+    return 1;
+  }
+
+  std::vector<std::string> names;
+  for (int x = 2; x < argc; x++) {
+    names.push_back(argv[x]);
+  }
+
+  std::string in;
+  generate(size * 1048576, in);
+
+  printf("%li MB, %u threads\n", size, std::thread::hardware_concurrency());
+
+  bool ok = true;
+#ifdef HAVE_GZIP
+  ok = run(Codec::GZIP, "gzip", in, names) && ok;
+#endif
+#ifdef HAVE_BZIP2
+  ok = run(Codec::BZIP2, "bzip2", in, names) && ok;
+#endif
+#ifdef HAVE_XZ
+  ok = run(Codec::XZ, "xz", in, names) && ok;
+#endif
+#ifdef HAVE_ZSTD
+  ok = run(Codec::ZSTD, "zstd", in, names) && ok;
+#endif
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,151 @@
+/*
+ * filterbench.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "export.hh"
+#include "import.hh"
+#include "utils.hh"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <glibmm/fileutils.h>
+#include <string>
+#include <unistd.h>
+
+// How much of the text Document::foreach_segment() gives at a time, roughly.
+#define SEGMENT_SIZE 65536
+
+/**
+ * \brief make up Arabic lines with lam-alefs, bidi marks and some latin text and numbers.
+ * \param size how many bytes we want.
+ * \param out where to put them.
+ */
+static void generate(std::size_t size, std::string &out)
+{
+  static const char *words[] = {"السلام", "عليكم", "كتاب", "لا", "إلى", "الأرض",
+                                "مرحبا", "محرر", "نص", "في", "آلة", "katoob",
+                                "\xe2\x80\x8f", "2021", "أنا", "بلاد", "سلام", "قال"};
+  const unsigned n = sizeof(words) / sizeof(words[0]);
+
+  unsigned seed = 1;
+  std::size_t line = 0;
+  out.clear();
+  out.reserve(size + 16);
+  while (out.size() < size) {
+    // A plain LCG, so every run filters the same input.
+    seed = seed * 1103515245 + 12345;
+    out += words[(seed >> 16) % n];
+    if (out.size() - line > 80) {
+      out += '\n';
+      line = out.size();
+    } else {
+      out += ' ';
+    }
+  }
+
+  // Don't cut a character in half.
+  out.resize(out.rfind('\n') + 1);
+}
+
+/**
+ * \brief print how fast we went.
+ */
+static void report(const char *name,
+                   std::size_t len,
+                   const std::chrono::steady_clock::time_point &start)
+{
+  std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+  printf("%-18s %9.2f MB/s\n", name, len / 1048576.0 / time.count());
+}
+
+int main(int argc, char *argv[])
+{
+  // The size of the input in MB.
+  const long size = argc > 1 ? strtol(argv[1], NULL, 10) : 16;
+  if (size <= 0) {
+    fprintf(stderr, "Usage: %s [MB]\n", argv[0]);
+    return 1;
+  }
+
+  std::string in, out, error;
+  generate(size * 1048576, in);
+
+  printf("%li MB\n", size);
+
+  // The whole text in one go, like the Export menu does it.
+  Glib::ustring text(in);
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  if (!katoob_export_plain(text, out, error)) {
+    fprintf(stderr, "katoob_export_plain: %s\n", error.c_str());
+    return 1;
+  }
+  report("export_plain", in.size(), start);
+
+  // The text a few lines at a time through the LineExporter.
+  Export ex;
+  ex.name = "bidi_shape";
+  ex.func = katoob_export_bidi_shape;
+  ex.lines = true;
+
+  out.clear();
+  start = std::chrono::steady_clock::now();
+  LineExporter exporter(ex, out);
+  std::size_t pos = 0;
+  while (pos < in.size()) {
+    std::size_t end = in.find('\n', std::min(pos + SEGMENT_SIZE, in.size() - 1)) + 1;
+    if (!exporter.add(in.data() + pos, end - pos, 0, 0)) {
+      break;
+    }
+    pos = end;
+  }
+  if (!exporter.finish(error)) {
+    fprintf(stderr, "katoob_export_bidi_shape: %s\n", error.c_str());
+    return 1;
+  }
+  report("export_bidi_shape", in.size(), start);
+
+  // Read back what we shaped.
+  std::string file;
+  int fd = Glib::file_open_tmp(file, "katoob");
+  if (!Utils::write_all(fd, out.data(), out.size())) {
+    fprintf(stderr, "%s: %s\n", file.c_str(), std::strerror(errno));
+    close(fd);
+    unlink(file.c_str());
+    return 1;
+  }
+  close(fd);
+
+  std::string shaped;
+  start = std::chrono::steady_clock::now();
+  bool ok = katoob_import_bidi_shape(file, shaped);
+  report("import_bidi_shape", out.size(), start);
+  unlink(file.c_str());
+
+  if (!ok) {
+    fprintf(stderr, "katoob_import_bidi_shape: %s\n", shaped.c_str());
+    return 1;
+  }
+
+  return 0;
+}
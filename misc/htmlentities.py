@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+#
+# Generates src/htmlentities.cc from the HTML5 named character references that Python ships,
+# which is the WHATWG entities.json list.
+#
+# Usage: misc/htmlentities.py > src/htmlentities.cc
+#
+# The names are placed with a minimal perfect hash (hash and displace): a name first hashes to a
+# bucket, the bucket's displacement is then used as the seed of a second hash which picks the
+# slot. html_entity_find() in the generated file has to hash exactly like fnv() below.
+
+import html.entities
+
+BUCKET_LOAD = 4
+
+
+def fnv(name, seed):
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for c in name.encode('ascii'):
+        h ^= c
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def build(names):
+    n = len(names)
+    nbuckets = (n + BUCKET_LOAD - 1) // BUCKET_LOAD
+    buckets = [[] for _ in range(nbuckets)]
+    for name in names:
+        buckets[fnv(name, 0) % nbuckets].append(name)
+
+    slots = [None] * n
+    displacements = [0] * nbuckets
+    for b in sorted(range(nbuckets), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            continue
+        d = 1
+        while True:
+            picked = [fnv(name, d) % n for name in buckets[b]]
+            if len(set(picked)) == len(picked) and all(slots[s] is None for s in picked):
+                break
+            d += 1
+        displacements[b] = d
+        for name, s in zip(buckets[b], picked):
+            slots[s] = name
+
+    return slots, displacements
+
+
+def main():
+    entities = html.entities.html5
+    names = sorted(entities)
+    slots, displacements = build(names)
+    legacy = max(len(name) for name in names if not name.endswith(';'))
+
+    print('''/*
+ * htmlentities.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+/* Generated by misc/htmlentities.py, do not edit. */
+
+#include <config.h>
+
+#include "htmlentities.hh"
+#include <cstring>
+
+#define ENTITIES %d
+#define BUCKETS %d
+
+static_assert(HTML_ENTITY_MAX_NAME == %d, "Update htmlentities.hh");
+static_assert(HTML_ENTITY_MAX_LEGACY == %d, "Update htmlentities.hh");
+''' % (len(slots), len(displacements), max(map(len, names)), legacy))
+
+    print('/* clang-format off */')
+    print('static const HtmlEntity entities[ENTITIES] = {')
+    for name in slots:
+        value = [ord(c) for c in entities[name]] + [0]
+        print('  {"%s", %d, {0x%04X, 0x%04X}},' % (name, len(name), value[0], value[1]))
+    print('};')
+    print()
+    print('static const unsigned short displacements[BUCKETS] = {')
+    for x in range(0, len(displacements), 12):
+        print('  ' + ', '.join('%d' % d for d in displacements[x:x + 12]) + ',')
+    print('};')
+    print('/* clang-format on */')
+
+    print('''
+static inline guint32 fnv(const char *name, std::size_t len, guint32 seed)
+{
+  guint32 h = 2166136261u ^ seed;
+  for (std::size_t x = 0; x < len; x++) {
+    h ^= static_cast<unsigned char>(name[x]);
+    h *= 16777619u;
+  }
+  return h;
+}
+
+const HtmlEntity *html_entity_find(const char *name, std::size_t len)
+{
+  if (len == 0 || len > HTML_ENTITY_MAX_NAME) {
+    return NULL;
+  }
+
+  guint32 d = displacements[fnv(name, len, 0) % BUCKETS];
+  const HtmlEntity *entity = &entities[fnv(name, len, d) % ENTITIES];
+  if (entity->len == len && !memcmp(entity->name, name, len)) {
+    return entity;
+  }
+
+  return NULL;
+}''')
+
+
+if __name__ == '__main__':
+    main()
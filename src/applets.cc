@@ -24,7 +24,6 @@
 #include "applets.hh"
 #include "dict.hh"
 #include "macros.h"
-#include "network.hh"
 #include "utils.hh"
 
 Applet::Applet(Conf &conf): _conf(conf)
@@ -608,19 +607,27 @@ void EncodingsApplet::locale_enc_toggled_cb()
 }
 
 /* FileSaveApplet */
-FileSaveApplet::FileSaveApplet(Conf &_conf): Applet::Applet(_conf)
+FileSaveApplet::FileSaveApplet(Conf &_conf):
+ Applet::Applet(_conf),
+ compression_level_adj(0, 0, 19)
 {
   backup.set_use_underline();
   backup.set_label(_("_Backup files before saving."));
   backup_label.set_text(_("Backup extension"));
+  compression_level_label.set_text(_("Compression level (0 for the default)"));
+  compression_level.set_adjustment(compression_level_adj);
 
   box.pack_start(backup, false, false);
   box.pack_start(fs_box1, false, false);
+  box.pack_start(fs_box2, false, false);
   fs_box1.pack_start(backup_label);
   fs_box1.pack_start(backup_ext);
+  fs_box2.pack_start(compression_level_label);
+  fs_box2.pack_start(compression_level);
 
   backup.set_active(_conf.get("backup", true));
   backup_ext.set_text(_conf.get("backup_ext", "~"));
+  compression_level_adj.set_value(_conf.get("compression_level", 0));
 
   backup.signal_toggled().connect(sigc::mem_fun(*this, &FileSaveApplet::backup_toggled_cb));
   backup.toggled();
@@ -633,6 +640,7 @@ void FileSaveApplet::apply()
     backup_ext.set_text("~");
   }
   _conf.set("backup_ext", backup_ext.get_text().c_str());
+  _conf.set("compression_level", compression_level.get_value_as_int());
 }
 
 void FileSaveApplet::backup_toggled_cb()
@@ -647,12 +655,15 @@ SpellCheckerApplet::SpellCheckerApplet(Conf &_conf): Applet::Applet(_conf)
   spell_check.set_use_underline();
 
   spell_check.set_label(_("_Autocheck Spelling"));
+  spell_detect.set_use_underline();
+  spell_detect.set_label(_("_Detect the language of documents"));
   //  misspelled_label.set_text(_("Misspelled words color"));
   default_dict_label.set_text(_("Choose the default dictionary"));
 
   box.pack_start(spell_check, false, false);
   //  box.pack_start(sc_box1, false, false);
   box.pack_start(sc_box2, false, false);
+  box.pack_start(spell_detect, false, false);
   //  sc_box1.pack_start(misspelled_label);
   //  sc_box1.pack_start(misspelled);
   sc_box2.pack_start(default_dict_label);
@@ -660,6 +671,7 @@ SpellCheckerApplet::SpellCheckerApplet(Conf &_conf): Applet::Applet(_conf)
 
   spell_check.set_active(_conf.get("spell_check", true));
   default_dict.set_active_text(_conf.get("default_dict", "en"));
+  spell_detect.set_active(_conf.get("spell_detect", true));
   /*
     Gdk::Color color;
     color.set_red(_conf.get("misspelled_red", 65535));
@@ -678,6 +690,7 @@ void SpellCheckerApplet::apply()
 {
   _conf.set("spell_check", spell_check.get_active());
   _conf.set("default_dict", default_dict.get_active_text().c_str());
+  _conf.set("spell_detect", spell_detect.get_active());
 
   /*
     color = misspelled.get_color();
@@ -762,7 +775,7 @@ print_frame.set_sensitive(gui_show_advanced.get_active());
 /* DictionaryApplet */
 DictionaryApplet::DictionaryApplet(Conf &_conf):
  Applet::Applet(_conf),
- handle(NULL),
+ request(0),
  dict_port_adj(0, 0, 0)
 {
   dict.set_use_underline();
@@ -843,25 +856,21 @@ void DictionaryApplet::dict_toggled_cb()
 
 void DictionaryApplet::signal_cancel_clicked_cb()
 {
-  Network::del_transfer(handle);
-  handle = NULL;
+  DictClient::cancel(request);
+  request = 0;
   conn.disconnect();
 }
 
-void DictionaryApplet::signal_dict_transfer_complete_cb(bool st, const std::string &str)
+void DictionaryApplet::signal_dict_lookup_done_cb(bool st,
+                                                  const std::map<std::string, std::string> &res)
 {
   // stop the progress indicator.
   meter->quit();
 
   conn.disconnect();
+  request = 0;
 
   if (!st) {
-    katoob_error(str);
-    return;
-  }
-
-  std::map<std::string, std::string> res;
-  if (!Dict::parse_dbs(str, res)) {
     if (res.size() == 0) {
       katoob_error(_("Failed to get the available dictionaries."));
     } else if (res.begin()->first.size() == 0) {
@@ -872,7 +881,7 @@ void DictionaryApplet::signal_dict_transfer_complete_cb(bool st, const std::stri
   } else {
     dict_store->clear();
     Gtk::TreeModel::Row _row;
-    std::map<std::string, std::string>::iterator iter;
+    std::map<std::string, std::string>::const_iterator iter;
     for (iter = res.begin(); iter != res.end(); iter++) {
       Gtk::TreeModel::Row row = *(dict_store->append());
       if (iter == res.begin()) {
@@ -895,15 +904,8 @@ void DictionaryApplet::list_dicts_clicked_cb()
     return;
   }
 
-  sigc::slot<void, bool, const std::string &> slot =
-      sigc::mem_fun(this, &DictionaryApplet::signal_dict_transfer_complete_cb);
-
-  std::string uri = Dict::construct_lsdb_uri(host, port);
-
-  std::string error;
-  if (!Network::add_transfer(uri, error, slot, handle)) {
-    katoob_error(error);
-  }
+  request = DictClient::show_db(
+      host, port, sigc::mem_fun(this, &DictionaryApplet::signal_dict_lookup_done_cb));
 
   meter = katoob_activity();
 
@@ -942,13 +944,17 @@ void MultipressApplet::apply()
 /* RemoteDocumentsApplet */
 RemoteDocumentsApplet::RemoteDocumentsApplet(Conf &_conf):
  Applet::Applet(_conf),
- locations_size_adj(0, 0, 0)
+ locations_size_adj(0, 0, 0),
+ http_cache_size_adj(0, 0, 0)
 {
   box.pack_start(open_location_to_active, false, false);
   box.pack_start(r_box1, false, false);
   box.pack_start(r_box2, false, false);
+  box.pack_start(http_cache_offline, false, false);
   r_box1.pack_start(locations_size_label);
   r_box1.pack_start(locations_size);
+  r_box2.pack_start(http_cache_size_label);
+  r_box2.pack_start(http_cache_size);
 
   locations_size.set_adjustment(locations_size_adj);
   locations_size_adj.set_upper(1000);
@@ -958,12 +964,23 @@ RemoteDocumentsApplet::RemoteDocumentsApplet(Conf &_conf):
   open_location_to_active.set_use_underline();
   open_location_to_active.set_active(_conf.get("open_location_to_active", false));
   open_location_to_active.set_label(_("_Insert into the active document enabled by default ?"));
+
+  http_cache_size.set_adjustment(http_cache_size_adj);
+  http_cache_size_adj.set_upper(1000);
+  http_cache_size_adj.set_lower(0);
+  http_cache_size_adj.set_value(_conf.get("http_cache_size", 20));
+  http_cache_size_label.set_text(_("Size of the remote documents cache in MB\n(0 to disable)"));
+  http_cache_offline.set_use_underline();
+  http_cache_offline.set_active(_conf.get("http_cache_offline", false));
+  http_cache_offline.set_label(_("_Work offline (open remote documents from the cache)"));
 }
 
 void RemoteDocumentsApplet::apply()
 {
   _conf.set("open_location_to_active", open_location_to_active.get_active());
   _conf.set("locations_size", locations_size.get_value_as_int());
+  _conf.set("http_cache_size", http_cache_size.get_value_as_int());
+  _conf.set("http_cache_offline", http_cache_offline.get_active());
 }
 
 /* AdvancedApplet */
@@ -143,7 +143,10 @@ class FileSaveApplet: public Applet {
   Gtk::CheckButton backup;
   Gtk::Entry backup_ext;
   Gtk::Label backup_label;
-  Gtk::HBox fs_box1;
+  Gtk::HBox fs_box1, fs_box2;
+  Gtk::Label compression_level_label;
+  Gtk::Adjustment compression_level_adj;
+  Gtk::SpinButton compression_level;
 };
 
 #ifdef ENABLE_SPELL
@@ -153,7 +156,7 @@ class SpellCheckerApplet: public Applet {
   virtual void apply();
 
  private:
-  Gtk::CheckButton spell_check;
+  Gtk::CheckButton spell_check, spell_detect;
   SpellMenu default_dict;
   Gtk::Label default_dict_label;   //, misspelled_label;
   Gtk::HBox /*sc_box1,*/ sc_box2;
@@ -182,15 +185,15 @@ class DictionaryApplet: public Applet {
  private:
   void dict_toggled_cb();
   void list_dicts_clicked_cb();
-  void signal_dict_transfer_complete_cb(bool, const std::string &);
+  void signal_dict_lookup_done_cb(bool, const std::map<std::string, std::string> &);
   void signal_cancel_clicked_cb();
 
   sigc::connection conn;
 
   Glib::RefPtr<ActivityMeter> meter;
 
-  // our network handle
-  void *handle;
+  // our dictionary request
+  unsigned request;
 
   Gtk::CheckButton dict;
   Gtk::Label dict_host_label, dict_port_label, dict_name_label;
@@ -229,10 +232,10 @@ class RemoteDocumentsApplet: public Applet {
   virtual void apply();
 
  private:
-  Gtk::CheckButton open_location_to_active;
-  Gtk::SpinButton locations_size;
-  Gtk::Adjustment locations_size_adj;
-  Gtk::Label locations_size_label;
+  Gtk::CheckButton open_location_to_active, http_cache_offline;
+  Gtk::SpinButton locations_size, http_cache_size;
+  Gtk::Adjustment locations_size_adj, http_cache_size_adj;
+  Gtk::Label locations_size_label, http_cache_size_label;
   Gtk::HBox r_box1, r_box2;
 };
 
@@ -0,0 +1,883 @@
+/*
+ * codec.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "codec.hh"
+#include "macros.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#ifdef HAVE_GZIP
+#include <zlib.h>
+#endif
+
+#ifdef HAVE_BZIP2
+#include <bzlib.h>
+#endif
+
+#ifdef HAVE_XZ
+#include <lzma.h>
+#endif
+
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+// How much we grow the output by at a time.
+#define CHUNK_SIZE 262144
+
+// How much we read from a file at a time.
+#define READ_SIZE 1048576
+
+// Big inputs are compressed in blocks of that size, one thread per core.
+#define BLOCK_SIZE 8388608
+
+// The libraries count the input with an unsigned int.
+#define INPUT_LIMIT 1073741824
+
+/**
+ * \brief make room at the end of out for the codec to write to.
+ * \return where the codec should write.
+ */
+static char *grow(std::string &out, std::size_t &old)
+{
+  old = out.size();
+  out.resize(old + CHUNK_SIZE);
+  return &out[old];
+}
+
+#ifdef HAVE_GZIP
+class GzipEncoder: public Codec {
+ public:
+  GzipEncoder(): _ok(false)
+  {
+    memset(&stream, 0, sizeof(stream));
+  }
+
+  ~GzipEncoder()
+  {
+    if (_ok) {
+      deflateEnd(&stream);
+    }
+  }
+
+  bool init(int level)
+  {
+    // 16 asks for a gzip header instead of a zlib one.
+    _ok = deflateInit2(&stream, level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+    return _ok;
+  }
+
+ protected:
+  bool code(const char *data, std::size_t len, std::string &out, bool finish, std::string &error)
+  {
+    stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+    stream.avail_in = len;
+
+    do {
+      std::size_t old;
+      stream.next_out = reinterpret_cast<Bytef *>(grow(out, old));
+      stream.avail_out = CHUNK_SIZE;
+      int res = deflate(&stream, finish ? Z_FINISH : Z_NO_FLUSH);
+      out.resize(old + CHUNK_SIZE - stream.avail_out);
+      if (res == Z_STREAM_ERROR) {
+        error = _("Couldn't compress the text.");
+        return false;
+      }
+    } while (stream.avail_out == 0);
+
+    return true;
+  }
+
+ private:
+  z_stream stream;
+  bool _ok;
+};
+
+class GzipDecoder: public Codec {
+ public:
+  GzipDecoder(): _ok(false), _end(false)
+  {
+    memset(&stream, 0, sizeof(stream));
+  }
+
+  ~GzipDecoder()
+  {
+    if (_ok) {
+      inflateEnd(&stream);
+    }
+  }
+
+  bool init()
+  {
+    // 32 detects the gzip header.
+    _ok = inflateInit2(&stream, 15 + 32) == Z_OK;
+    return _ok;
+  }
+
+ protected:
+  bool code(const char *data, std::size_t len, std::string &out, bool finish, std::string &error)
+  {
+    stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+    stream.avail_in = len;
+
+    bool more = len > 0;
+    while (more) {
+      std::size_t old;
+      stream.next_out = reinterpret_cast<Bytef *>(grow(out, old));
+      stream.avail_out = CHUNK_SIZE;
+      int res = inflate(&stream, Z_NO_FLUSH);
+      out.resize(old + CHUNK_SIZE - stream.avail_out);
+
+      if (res == Z_STREAM_END) {
+        // Another member might follow, gzip and pigz both concatenate them.
+        inflateReset(&stream);
+        _end = true;
+        more = stream.avail_in > 0;
+        continue;
+      }
+
+      if (res != Z_OK && res != Z_BUF_ERROR) {
+        error = _("The compressed data is corrupted.");
+        return false;
+      }
+
+      _end = false;
+      more = stream.avail_in > 0 || stream.avail_out == 0;
+    }
+
+    if (finish && !_end) {
+      error = _("The compressed data is truncated.");
+      return false;
+    }
+
+    return true;
+  }
+
+ private:
+  z_stream stream;
+  bool _ok;
+  bool _end;
+};
+#endif
+
+#ifdef HAVE_BZIP2
+class Bzip2Encoder: public Codec {
+ public:
+  Bzip2Encoder(): _ok(false)
+  {
+    memset(&stream, 0, sizeof(stream));
+  }
+
+  ~Bzip2Encoder()
+  {
+    if (_ok) {
+      BZ2_bzCompressEnd(&stream);
+    }
+  }
+
+  bool init(int level)
+  {
+    _ok = BZ2_bzCompressInit(&stream, level, 0, 0) == BZ_OK;
+    return _ok;
+  }
+
+ protected:
+  bool code(const char *data, std::size_t len, std::string &out, bool finish, std::string &error)
+  {
+    stream.next_in = const_cast<char *>(data);
+    stream.avail_in = len;
+
+    while (true) {
+      std::size_t old;
+      stream.next_out = grow(out, old);
+      stream.avail_out = CHUNK_SIZE;
+      int res = BZ2_bzCompress(&stream, finish ? BZ_FINISH : BZ_RUN);
+      out.resize(old + CHUNK_SIZE - stream.avail_out);
+
+      if (res < 0) {
+        error = _("Couldn't compress the text.");
+        return false;
+      }
+
+      if (finish ? res == BZ_STREAM_END : stream.avail_in == 0) {
+        return true;
+      }
+    }
+  }
+
+ private:
+  bz_stream stream;
+  bool _ok;
+};
+
+class Bzip2Decoder: public Codec {
+ public:
+  Bzip2Decoder(): _ok(false), _end(false)
+  {
+    memset(&stream, 0, sizeof(stream));
+  }
+
+  ~Bzip2Decoder()
+  {
+    if (_ok) {
+      BZ2_bzDecompressEnd(&stream);
+    }
+  }
+
+  bool init()
+  {
+    _ok = BZ2_bzDecompressInit(&stream, 0, 0) == BZ_OK;
+    return _ok;
+  }
+
+ protected:
+  bool code(const char *data, std::size_t len, std::string &out, bool finish, std::string &error)
+  {
+    stream.next_in = const_cast<char *>(data);
+    stream.avail_in = len;
+
+    bool more = len > 0;
+    while (more) {
+      std::size_t old;
+      stream.next_out = grow(out, old);
+      stream.avail_out = CHUNK_SIZE;
+      int res = BZ2_bzDecompress(&stream);
+      out.resize(old + CHUNK_SIZE - stream.avail_out);
+
+      if (res == BZ_STREAM_END) {
+        // pbzip2 writes one stream per block.
+        char *next_in = stream.next_in;
+        unsigned avail_in = stream.avail_in;
+        BZ2_bzDecompressEnd(&stream);
+        memset(&stream, 0, sizeof(stream));
+        if (BZ2_bzDecompressInit(&stream, 0, 0) != BZ_OK) {
+          _ok = false;
+          error = _("Couldn't initialize the compression library.");
+          return false;
+        }
+        stream.next_in = next_in;
+        stream.avail_in = avail_in;
+        _end = true;
+        more = stream.avail_in > 0;
+        continue;
+      }
+
+      if (res != BZ_OK) {
+        error = _("The compressed data is corrupted.");
+        return false;
+      }
+
+      _end = false;
+      more = stream.avail_in > 0 || stream.avail_out == 0;
+    }
+
+    if (finish && !_end) {
+      error = _("The compressed data is truncated.");
+      return false;
+    }
+
+    return true;
+  }
+
+ private:
+  bz_stream stream;
+  bool _ok;
+  bool _end;
+};
+#endif
+
+#ifdef HAVE_XZ
+/**
+ * \brief liblzma does both directions the same way.
+ */
+class XzCodec: public Codec {
+ public:
+  XzCodec()
+  {
+    lzma_stream tmp = LZMA_STREAM_INIT;
+    stream = tmp;
+  }
+
+  ~XzCodec()
+  {
+    lzma_end(&stream);
+  }
+
+  bool init_encoder(int level)
+  {
+    return lzma_easy_encoder(&stream, level, LZMA_CHECK_CRC64) == LZMA_OK;
+  }
+
+  bool init_decoder()
+  {
+    return lzma_stream_decoder(&stream, UINT64_MAX, LZMA_CONCATENATED) == LZMA_OK;
+  }
+
+ protected:
+  bool code(const char *data, std::size_t len, std::string &out, bool finish, std::string &error)
+  {
+    stream.next_in = reinterpret_cast<const uint8_t *>(data);
+    stream.avail_in = len;
+
+    while (true) {
+      std::size_t old;
+      stream.next_out = reinterpret_cast<uint8_t *>(grow(out, old));
+      stream.avail_out = CHUNK_SIZE;
+      lzma_ret res = lzma_code(&stream, finish ? LZMA_FINISH : LZMA_RUN);
+      out.resize(old + CHUNK_SIZE - stream.avail_out);
+
+      if (res == LZMA_STREAM_END) {
+        return true;
+      }
+
+      if (res == LZMA_BUF_ERROR) {
+        error = _("The compressed data is truncated.");
+        return false;
+      }
+
+      if (res != LZMA_OK) {
+        error = _("The compressed data is corrupted.");
+        return false;
+      }
+
+      if (!finish && stream.avail_in == 0 && stream.avail_out != 0) {
+        return true;
+      }
+    }
+  }
+
+ private:
+  lzma_stream stream;
+};
+#endif
+
+#ifdef HAVE_ZSTD
+class ZstdEncoder: public Codec {
+ public:
+  ZstdEncoder(): ctx(ZSTD_createCCtx())
+  {
+  }
+
+  ~ZstdEncoder()
+  {
+    ZSTD_freeCCtx(ctx);
+  }
+
+  bool init(int level)
+  {
+    return ctx && !ZSTD_isError(ZSTD_CCtx_setParameter(ctx, ZSTD_c_compressionLevel, level));
+  }
+
+ protected:
+  bool code(const char *data, std::size_t len, std::string &out, bool finish, std::string &error)
+  {
+    ZSTD_inBuffer in = {data, len, 0};
+
+    while (true) {
+      std::size_t old;
+      ZSTD_outBuffer buf = {grow(out, old), CHUNK_SIZE, 0};
+      std::size_t res = ZSTD_compressStream2(ctx, &buf, &in, finish ? ZSTD_e_end : ZSTD_e_continue);
+      out.resize(old + buf.pos);
+
+      if (ZSTD_isError(res)) {
+        error = _("Couldn't compress the text.");
+        return false;
+      }
+
+      if (finish ? res == 0 : in.pos == in.size) {
+        return true;
+      }
+    }
+  }
+
+ private:
+  ZSTD_CCtx *ctx;
+};
+
+class ZstdDecoder: public Codec {
+ public:
+  ZstdDecoder(): ctx(ZSTD_createDCtx()), _end(false)
+  {
+  }
+
+  ~ZstdDecoder()
+  {
+    ZSTD_freeDCtx(ctx);
+  }
+
+  bool init()
+  {
+    return ctx != NULL;
+  }
+
+ protected:
+  bool code(const char *data, std::size_t len, std::string &out, bool finish, std::string &error)
+  {
+    ZSTD_inBuffer in = {data, len, 0};
+
+    bool more = len > 0;
+    while (more) {
+      std::size_t old;
+      ZSTD_outBuffer buf = {grow(out, old), CHUNK_SIZE, 0};
+      std::size_t res = ZSTD_decompressStream(ctx, &buf, &in);
+      out.resize(old + buf.pos);
+
+      if (ZSTD_isError(res)) {
+        error = _("The compressed data is corrupted.");
+        return false;
+      }
+
+      // 0 means a frame ended. Another one might follow.
+      _end = res == 0;
+      more = in.pos < in.size || buf.pos == buf.size;
+    }
+
+    if (finish && !_end) {
+      error = _("The compressed data is truncated.");
+      return false;
+    }
+
+    return true;
+  }
+
+ private:
+  ZSTD_DCtx *ctx;
+  bool _end;
+};
+#endif
+
+Codec::Codec()
+{
+}
+
+Codec::~Codec()
+{
+}
+
+/**
+ * \brief feed the codec.
+ * \param data the data.
+ * \param len the length of data.
+ * \param out the output is appended to it.
+ * \param finish true if that's the last chunk.
+ * \param error contains the error, if any.
+ * \return true on success.
+ */
+bool Codec::process(const char *data,
+                    std::size_t len,
+                    std::string &out,
+                    bool finish,
+                    std::string &error)
+{
+  while (len > INPUT_LIMIT) {
+    if (!code(data, INPUT_LIMIT, out, false, error)) {
+      return false;
+    }
+    data += INPUT_LIMIT;
+    len -= INPUT_LIMIT;
+  }
+
+  return code(data, len, out, finish, error);
+}
+
+/**
+ * \brief create a compressor.
+ * \param format the format to compress to.
+ * \param level the compression level, or -1 for the default. Higher levels are clamped.
+ * \param error contains the error, if any.
+ * \return the codec, to be deleted by the caller, or NULL.
+ */
+Codec *Codec::create_encoder(Format format, int level, std::string &error)
+{
+  if (level < 0) {
+    level = default_level(format);
+  } else if (level > max_level(format)) {
+    level = max_level(format);
+  }
+
+  switch (format) {
+#ifdef HAVE_GZIP
+    case GZIP: {
+      GzipEncoder *codec = new GzipEncoder;
+      if (codec->init(level)) {
+        return codec;
+      }
+      delete codec;
+      break;
+    }
+#endif
+#ifdef HAVE_BZIP2
+    case BZIP2: {
+      Bzip2Encoder *codec = new Bzip2Encoder;
+      if (codec->init(level)) {
+        return codec;
+      }
+      delete codec;
+      break;
+    }
+#endif
+#ifdef HAVE_XZ
+    case XZ: {
+      XzCodec *codec = new XzCodec;
+      if (codec->init_encoder(level)) {
+        return codec;
+      }
+      delete codec;
+      break;
+    }
+#endif
+#ifdef HAVE_ZSTD
+    case ZSTD: {
+      ZstdEncoder *codec = new ZstdEncoder;
+      if (codec->init(level)) {
+        return codec;
+      }
+      delete codec;
+      break;
+    }
+#endif
+    default:
+      error = _("This compression format is not supported.");
+      return NULL;
+  }
+
+  error = _("Couldn't initialize the compression library.");
+  return NULL;
+}
+
+/**
+ * \brief create a decompressor.
+ * \param format the format to decompress.
+ * \param error contains the error, if any.
+ * \return the codec, to be deleted by the caller, or NULL.
+ */
+Codec *Codec::create_decoder(Format format, std::string &error)
+{
+  switch (format) {
+#ifdef HAVE_GZIP
+    case GZIP: {
+      GzipDecoder *codec = new GzipDecoder;
+      if (codec->init()) {
+        return codec;
+      }
+      delete codec;
+      break;
+    }
+#endif
+#ifdef HAVE_BZIP2
+    case BZIP2: {
+      Bzip2Decoder *codec = new Bzip2Decoder;
+      if (codec->init()) {
+        return codec;
+      }
+      delete codec;
+      break;
+    }
+#endif
+#ifdef HAVE_XZ
+    case XZ: {
+      XzCodec *codec = new XzCodec;
+      if (codec->init_decoder()) {
+        return codec;
+      }
+      delete codec;
+      break;
+    }
+#endif
+#ifdef HAVE_ZSTD
+    case ZSTD: {
+      ZstdDecoder *codec = new ZstdDecoder;
+      if (codec->init()) {
+        return codec;
+      }
+      delete codec;
+      break;
+    }
+#endif
+    default:
+      error = _("This compression format is not supported.");
+      return NULL;
+  }
+
+  error = _("Couldn't initialize the compression library.");
+  return NULL;
+}
+
+/**
+ * \brief guess the format from the magic bytes at the start of the data.
+ */
+Codec::Format Codec::detect(const char *data, std::size_t len)
+{
+  const unsigned char *buf = reinterpret_cast<const unsigned char *>(data);
+
+  if (len >= 2 && buf[0] == 0x1f && buf[1] == 0x8b) {
+    return GZIP;
+  }
+
+  if (len >= 3 && memcmp(buf, "BZh", 3) == 0) {
+    return BZIP2;
+  }
+
+  if (len >= 6 && memcmp(buf, "\xfd" "7zXZ\0", 6) == 0) {
+    return XZ;
+  }
+
+  if (len >= 4 && memcmp(buf, "\x28\xb5\x2f\xfd", 4) == 0) {
+    return ZSTD;
+  }
+
+  return NONE;
+}
+
+/**
+ * \brief guess the format of a file from its first bytes.
+ */
+Codec::Format Codec::detect_file(const std::string &file)
+{
+  FILE *fp = fopen(file.c_str(), "rb");
+  if (!fp) {
+    return NONE;
+  }
+
+  char buf[6];
+  std::size_t n = fread(buf, 1, sizeof(buf), fp);
+  fclose(fp);
+  return detect(buf, n);
+}
+
+/**
+ * \brief guess the format from the file name extension.
+ */
+Codec::Format Codec::format_for_name(const std::string &file)
+{
+  static const struct {
+    const char *ext;
+    Format format;
+  } exts[] = {{".gz", GZIP}, {".bz2", BZIP2}, {".xz", XZ}, {".zst", ZSTD}};
+
+  for (unsigned x = 0; x < sizeof(exts) / sizeof(exts[0]); x++) {
+    std::size_t len = strlen(exts[x].ext);
+    if (file.size() > len && file.compare(file.size() - len, len, exts[x].ext) == 0) {
+      return exts[x].format;
+    }
+  }
+
+  return NONE;
+}
+
+/**
+ * \brief the level the command line tools use.
+ */
+int Codec::default_level(Format format)
+{
+  switch (format) {
+    case GZIP:
+      return 6;
+    case BZIP2:
+      return 9;
+    case XZ:
+      return 6;
+    case ZSTD:
+      return 3;
+    default:
+      return 0;
+  }
+}
+
+int Codec::max_level(Format format)
+{
+  switch (format) {
+    case GZIP:
+    case BZIP2:
+    case XZ:
+      return 9;
+    case ZSTD:
+      return 19;
+    default:
+      return 0;
+  }
+}
+
+/**
+ * \brief decompress a file.
+ * \param format the format the file should be in.
+ * \param file the file.
+ * \param out the decompressed data is appended to it.
+ * \param error contains the error, if any.
+ * \param cancel if given, we stop without an error once it becomes true.
+ * \return true on success.
+ */
+bool Codec::decode_file(Format format,
+                        const std::string &file,
+                        std::string &out,
+                        std::string &error,
+                        const std::atomic<bool> *cancel)
+{
+  FILE *fp = fopen(file.c_str(), "rb");
+  if (!fp) {
+    error = _("Can't open file.");
+    return false;
+  }
+
+  Codec *codec = create_decoder(format, error);
+  if (!codec) {
+    fclose(fp);
+    return false;
+  }
+
+  std::vector<char> buf(READ_SIZE);
+  bool first = true;
+  bool ok = true;
+  while (ok) {
+    if (cancel && *cancel) {
+      ok = false;
+      break;
+    }
+
+    std::size_t n = fread(&buf[0], 1, buf.size(), fp);
+    if (n == 0 && ferror(fp)) {
+      error = _("Error reading file.");
+      ok = false;
+      break;
+    }
+
+    // Is it really in that format ?
+    if (first && detect(&buf[0], n) != format) {
+      error = _("Error reading file.");
+      ok = false;
+      break;
+    }
+    first = false;
+
+    ok = codec->process(&buf[0], n, out, n == 0, error);
+    if (n == 0) {
+      break;
+    }
+  }
+
+  delete codec;
+  fclose(fp);
+  return ok;
+}
+
+/**
+ * \brief compress the blocks nobody took yet.
+ *
+ * Every block becomes a complete stream of its own, the way pigz and pbzip2 do it. Our decoders
+ * and the command line tools read the concatenated streams back as one.
+ */
+static void encode_blocks(Codec::Format format,
+                          int level,
+                          const char *data,
+                          std::size_t len,
+                          std::vector<std::string> &blocks,
+                          std::vector<std::string> &errors,
+                          std::atomic<std::size_t> &next)
+{
+  while (true) {
+    std::size_t x = next++;
+    if (x >= blocks.size()) {
+      return;
+    }
+
+    Codec *codec = Codec::create_encoder(format, level, errors[x]);
+    if (codec) {
+      std::size_t start = x * BLOCK_SIZE;
+      codec->process(
+          data + start, std::min<std::size_t>(BLOCK_SIZE, len - start), blocks[x], true, errors[x]);
+      delete codec;
+    }
+  }
+}
+
+/**
+ * \brief compress data in one go.
+ *
+ * Data bigger than a block is compressed in parallel.
+ *
+ * \param format the format to compress to.
+ * \param level the compression level, or -1 for the default.
+ * \param data the data.
+ * \param len the length of data.
+ * \param out the compressed data is appended to it.
+ * \param error contains the error, if any.
+ * \return true on success.
+ */
+bool Codec::encode(Format format,
+                   int level,
+                   const char *data,
+                   std::size_t len,
+                   std::string &out,
+                   std::string &error)
+{
+  const std::size_t n = (len + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  const unsigned jobs = std::min<std::size_t>(std::thread::hardware_concurrency(), n);
+
+  if (jobs < 2) {
+    Codec *codec = create_encoder(format, level, error);
+    if (!codec) {
+      return false;
+    }
+
+    bool ok = codec->process(data, len, out, true, error);
+    delete codec;
+    return ok;
+  }
+
+  std::vector<std::string> blocks(n), errors(n);
+  std::atomic<std::size_t> next(0);
+  std::vector<std::thread> threads;
+  for (unsigned x = 0; x < jobs; x++) {
+    threads.push_back(std::thread(encode_blocks,
+                                  format,
+                                  level,
+                                  data,
+                                  len,
+                                  std::ref(blocks),
+                                  std::ref(errors),
+                                  std::ref(next)));
+  }
+
+  for (std::thread &thread: threads) {
+    thread.join();
+  }
+
+  std::size_t size = out.size();
+  for (std::size_t x = 0; x < n; x++) {
+    if (errors[x].size() > 0) {
+      error = errors[x];
+      return false;
+    }
+    size += blocks[x].size();
+  }
+
+  out.reserve(size);
+  for (std::size_t x = 0; x < n; x++) {
+    out += blocks[x];
+    std::string().swap(blocks[x]);
+  }
+
+  return true;
+}
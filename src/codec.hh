@@ -0,0 +1,66 @@
+/*
+ * codec.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+/**
+ * \brief A streaming compressor or decompressor.
+ *
+ * Data is fed in chunks of any size and whatever the codec produced is appended to the output
+ * string. The codecs work with fixed size buffers so the only memory we need is for the input
+ * and the output.
+ */
+class Codec {
+ public:
+  enum Format { NONE, GZIP, BZIP2, XZ, ZSTD };
+
+  static Codec *create_encoder(Format, int, std::string &);
+  static Codec *create_decoder(Format, std::string &);
+  static Format detect(const char *, std::size_t);
+  static Format detect_file(const std::string &);
+  static Format format_for_name(const std::string &);
+  static int default_level(Format);
+  static int max_level(Format);
+
+  static bool decode_file(Format,
+                          const std::string &,
+                          std::string &,
+                          std::string &,
+                          const std::atomic<bool> * = NULL);
+  static bool encode(Format, int, const char *, std::size_t, std::string &, std::string &);
+
+  virtual ~Codec();
+
+  bool process(const char *, std::size_t, std::string &, bool, std::string &);
+
+ protected:
+  Codec();
+
+  // Called by process() with at most INPUT_LIMIT bytes at a time.
+  virtual bool code(const char *, std::size_t, std::string &, bool, std::string &) = 0;
+
+ private:
+  Codec(const Codec &);
+  Codec &operator=(const Codec &);
+};
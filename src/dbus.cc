@@ -28,6 +28,11 @@
 #define OPEN_FILES "OpenFiles"
 #define PING       "Ping"
 
+// OpenFiles takes an array of (path, encoding, line, column). We used to only send the paths.
+#define OPEN_FILES_SIGNATURE       "a(ssii)"
+#define OPEN_FILES_ENTRY_SIGNATURE "(ssii)"
+#define OPEN_FILES_PATHS_SIGNATURE "as"
+
 auto katoob_dbus_message_handler(DBusConnection *connection, DBusMessage *message, void *user_data)
     -> DBusHandlerResult
 {
@@ -107,24 +112,8 @@ auto DBus::got_message(DBusConnection *connection, DBusMessage *message) -> DBus
 
 auto DBus::open_files(DBusConnection *connection, DBusMessage *message) -> DBusHandlerResult
 {
-  DBusError error;
-  bool done = true;
-  int len;
-  char **list;
-
-  dbus_error_init(&error);
-
-  if (!dbus_message_get_args(message,
-                             &error,
-                             DBUS_TYPE_ARRAY,
-                             DBUS_TYPE_STRING,
-                             &list,
-                             &len,
-                             DBUS_TYPE_INVALID)) {
-    std::cerr << error.message << std::endl;
-    dbus_error_free(&error);
-    done = false;
-  }
+  std::vector<OpenFile> files;
+  bool done = read_files(message, files);
 
   DBusMessage *reply = dbus_message_new_method_return(message);
   if (reply == nullptr) {
@@ -135,19 +124,55 @@ auto DBus::open_files(DBusConnection *connection, DBusMessage *message) -> DBusH
   dbus_connection_send(connection, reply, nullptr);
   dbus_message_unref(reply);
 
-  std::vector<std::string> files;
-  files.reserve(len);
-
-  for (int i = 0; i < len; i++) {
-    files.emplace_back(list[i]);
-  }
-
   // dbus_connection_flush
   signal_open_files.emit(files);
   return DBUS_HANDLER_RESULT_HANDLED;
 }
 
-auto DBus::signal_open_files_event() -> sigc::signal<void, std::vector<std::string> &>
+auto DBus::read_files(DBusMessage *message, std::vector<OpenFile> &files) -> bool
+{
+  bool paths = dbus_message_has_signature(message, OPEN_FILES_PATHS_SIGNATURE) != 0;
+  if ((!paths) && (dbus_message_has_signature(message, OPEN_FILES_SIGNATURE) == 0)) {
+    std::cerr << "Katoob: Unexpected " << OPEN_FILES << " signature "
+              << dbus_message_get_signature(message) << std::endl;
+    return false;
+  }
+
+  DBusMessageIter iter, array, entry;
+  dbus_message_iter_init(message, &iter);
+  dbus_message_iter_recurse(&iter, &array);
+
+  while (dbus_message_iter_get_arg_type(&array) != DBUS_TYPE_INVALID) {
+    OpenFile file;
+    const char *str;
+    dbus_int32_t n;
+
+    if (paths) {
+      dbus_message_iter_get_basic(&array, &str);
+      file.path = str;
+    } else {
+      dbus_message_iter_recurse(&array, &entry);
+      dbus_message_iter_get_basic(&entry, &str);
+      file.path = str;
+      dbus_message_iter_next(&entry);
+      dbus_message_iter_get_basic(&entry, &str);
+      file.encoding = str;
+      dbus_message_iter_next(&entry);
+      dbus_message_iter_get_basic(&entry, &n);
+      file.line = n;
+      dbus_message_iter_next(&entry);
+      dbus_message_iter_get_basic(&entry, &n);
+      file.column = n;
+    }
+
+    files.push_back(file);
+    dbus_message_iter_next(&array);
+  }
+
+  return true;
+}
+
+auto DBus::signal_open_files_event() -> sigc::signal<void, std::vector<OpenFile> &>
 {
   return signal_open_files;
 }
@@ -170,91 +195,76 @@ auto DBus::pong(DBusConnection *connection, DBusMessage *message) -> DBusHandler
   return DBUS_HANDLER_RESULT_HANDLED;
 }
 
-auto DBus::ping() -> bool
+// This only needs libdbus so main() can call it before Gtk is initialized.
+auto DBus::open_files(std::vector<OpenFile> &_files) -> bool
 {
-  DBusConnection *con;
-  DBusMessage *msg;
-  DBusMessage *res;
+  // D-Bus strings have to be UTF-8 and libdbus aborts if they are not.
+  for (unsigned i = 0; i < _files.size(); i++) {
+    if ((!g_utf8_validate(_files[i].path.c_str(), -1, nullptr)) ||
+        (!g_utf8_validate(_files[i].encoding.c_str(), -1, nullptr))) {
+      return false;
+    }
+  }
+
   DBusError error;
   dbus_error_init(&error);
-  const char *_ping = PING;
 
-  con = dbus_bus_get(DBUS_BUS_SESSION, &error);
+  DBusConnection *con = dbus_bus_get(DBUS_BUS_SESSION, &error);
   if (con == nullptr) {
     std::cerr << error.message << std::endl;
     dbus_error_free(&error);
     return false;
   }
-  msg = dbus_message_new_method_call(APP_ID, APP_PATH, APP_ID, PING);
-  dbus_message_set_auto_start(msg, FALSE);
 
-  dbus_message_append_args(msg, DBUS_TYPE_STRING, &_ping, DBUS_TYPE_INVALID);
-  res = dbus_connection_send_with_reply_and_block(con, msg, 2000, &error);
-  dbus_message_unref(msg);
-  if (res == nullptr) {
-    std::cerr << error.message << std::endl;
-    dbus_error_free(&error);
+  // Asking the bus is cheaper than waiting for a method call to fail.
+  if (dbus_bus_name_has_owner(con, APP_ID, &error) == 0) {
+    if (dbus_error_is_set(&error) != 0) {
+      std::cerr << error.message << std::endl;
+      dbus_error_free(&error);
+    }
+    dbus_connection_unref(con);
     return false;
   }
 
-  if (dbus_message_get_type(res) == DBUS_MESSAGE_TYPE_ERROR) {
-    dbus_set_error_from_message(&error, res);
-    std::cerr << error.message << std::endl;
-    dbus_message_unref(res);
-    dbus_error_free(&error);
-    return false;
-  }
+  DBusMessage *msg = dbus_message_new_method_call(APP_ID, APP_PATH, APP_ID, OPEN_FILES);
+  dbus_message_set_auto_start(msg, FALSE);
 
-  /* Assume it worked */
-  dbus_message_unref(res);
-  return true;
-}
+  char *dir = g_get_current_dir();
 
-auto DBus::open_files(std::vector<std::string> &_files) -> bool
-{
-  gchar **files = g_new(gchar *, _files.size() + 1);
+  DBusMessageIter iter, array, entry;
+  dbus_message_iter_init_append(msg, &iter);
+  dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY, OPEN_FILES_ENTRY_SIGNATURE, &array);
   for (unsigned i = 0; i < _files.size(); i++) {
     // We need to add absolute paths
-    if (g_path_is_absolute(_files[i].c_str())) {
-      files[i] = g_strdup(_files[i].c_str());
-    } else {
-      char *dir = g_get_current_dir();
-      char *file = g_build_filename(dir, _files[i].c_str(), NULL);
-      g_free(dir);
-      files[i] = g_strdup(file);
+    std::string path = _files[i].path;
+    if (!g_path_is_absolute(path.c_str())) {
+      char *file = g_build_filename(dir, path.c_str(), NULL);
+      path = file;
       g_free(file);
     }
-  }
-  files[_files.size()] = nullptr;
 
-  DBusConnection *con;
-  DBusMessage *msg;
-  DBusMessage *res;
-  DBusError error;
-  dbus_error_init(&error);
-
-  con = dbus_bus_get(DBUS_BUS_SESSION, &error);
-  if (con == nullptr) {
-    std::cerr << error.message << std::endl;
-    dbus_error_free(&error);
-    g_strfreev(files);
-    return false;
+    const char *str = path.c_str();
+    dbus_int32_t n;
+    dbus_message_iter_open_container(&array, DBUS_TYPE_STRUCT, nullptr, &entry);
+    dbus_message_iter_append_basic(&entry, DBUS_TYPE_STRING, &str);
+    str = _files[i].encoding.c_str();
+    dbus_message_iter_append_basic(&entry, DBUS_TYPE_STRING, &str);
+    n = _files[i].line;
+    dbus_message_iter_append_basic(&entry, DBUS_TYPE_INT32, &n);
+    n = _files[i].column;
+    dbus_message_iter_append_basic(&entry, DBUS_TYPE_INT32, &n);
+    dbus_message_iter_close_container(&array, &entry);
   }
-  msg = dbus_message_new_method_call(APP_ID, APP_PATH, APP_ID, OPEN_FILES);
-  dbus_message_set_auto_start(msg, FALSE);
+  dbus_message_iter_close_container(&iter, &array);
+
+  g_free(dir);
 
-  dbus_message_append_args(msg,
-                           DBUS_TYPE_ARRAY,
-                           DBUS_TYPE_STRING,
-                           &files,
-                           g_strv_length(files),
-                           DBUS_TYPE_INVALID);
-  res = dbus_connection_send_with_reply_and_block(con, msg, 2000, &error);
+  DBusMessage *res = dbus_connection_send_with_reply_and_block(con, msg, 2000, &error);
   dbus_message_unref(msg);
+  dbus_connection_unref(con);
   if (res == nullptr) {
     std::cerr << error.message << std::endl;
     dbus_error_free(&error);
-    g_strfreev(files);
     return false;
   }
 
@@ -263,12 +273,10 @@ auto DBus::open_files(std::vector<std::string> &_files) -> bool
     std::cerr << error.message << std::endl;
     dbus_message_unref(res);
     dbus_error_free(&error);
-    g_strfreev(files);
     return false;
   }
 
   /* Assume it worked */
   dbus_message_unref(res);
-  g_strfreev(files);
   return true;
 }
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include "openfile.hh"
 #include <sigc++/signal.h>
 #include <string>
 #include <vector>
@@ -34,25 +35,25 @@ class DBus {
   DBus();
   ~DBus();
 
-  static auto ping() -> bool;
   void start();
 
-  static auto open_files(std::vector<std::string> &) -> bool;
+  static auto open_files(std::vector<OpenFile> &) -> bool;
 
   friend auto katoob_dbus_message_handler(DBusConnection *, DBusMessage *, void *)
       -> DBusHandlerResult;
 
-  auto signal_open_files_event() -> sigc::signal<void, std::vector<std::string> &>;
+  auto signal_open_files_event() -> sigc::signal<void, std::vector<OpenFile> &>;
 
  protected:
   auto got_message(DBusConnection *, DBusMessage *) -> DBusHandlerResult;
 
  private:
   auto open_files(DBusConnection *, DBusMessage *) -> DBusHandlerResult;
+  static auto read_files(DBusMessage *, std::vector<OpenFile> &) -> bool;
   static auto pong(DBusConnection *, DBusMessage *) -> DBusHandlerResult;
   static auto connect(DBusConnection **) -> bool;
   DBusConnection *server;
   bool _ok;
 
-  sigc::signal<void, std::vector<std::string> &> signal_open_files;
+  sigc::signal<void, std::vector<OpenFile> &> signal_open_files;
 };
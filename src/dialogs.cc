@@ -139,7 +139,7 @@ ActivityMeter::ActivityMeter(): dialog(_("Please wait..."), true, true)
   loop = Glib::MainLoop::create();
   dialog.add_button(Gtk::Stock::CANCEL, Gtk::RESPONSE_CANCEL);
   dialog.get_vbox()->pack_start(bar, true, true);
-  bar.set_pulse_step(0.007);
+  bar.set_pulse_step(0.05);
   dialog.signal_response().connect(sigc::mem_fun(this, &ActivityMeter::signal_response_cb));
 }
 
@@ -151,13 +151,29 @@ void ActivityMeter::signal_response_cb(int res)
 
 void ActivityMeter::run()
 {
-  conn = Glib::signal_idle().connect(
+  // A timeout and not an idle handler so we don't keep a core busy while we wait.
+  conn = Glib::signal_timeout().connect(
       sigc::bind_return(sigc::mem_fun(bar, &Gtk::ProgressBar::pulse), true),
+      100,
       Glib::PRIORITY_LOW);
   dialog.show_all();
   loop->run();
 }
 
+/**
+ * \brief show how far we got.
+ * \param fraction how much is done, or -1 if we don't know and should keep pulsing.
+ * \param text a text to show on the progress bar.
+ */
+void ActivityMeter::set_progress(double fraction, const std::string &text)
+{
+  if (fraction >= 0) {
+    conn.disconnect();
+    bar.set_fraction(fraction > 1 ? 1 : fraction);
+  }
+  bar.set_text(text);
+}
+
 void ActivityMeter::quit()
 {
   conn.disconnect();
@@ -38,6 +38,7 @@ class ActivityMeter: public Glib::Object {
   //  ~ActivityMeter();
   void run();
   void quit();
+  void set_progress(double, const std::string &);
   sigc::signal<void> signal_cancel_clicked;
 
  private:
@@ -22,17 +22,12 @@
 #pragma once
 
 #include "conf.hh"
-#include <map>
+#include "dictclient.hh"
 #include <string>
-#include <vector>
 
 // TODO: Auth not implemented
 // TODO: strategies not implemented.
-// TODO: Make the errors in DICTClient translatable.
 
 namespace Dict {
-  auto construct_uri(Conf &, const std::string &) -> std::string;
-  auto construct_lsdb_uri(const std::string &, int) -> std::string;
-  auto parse_defs(const std::string &, std::vector<std::string> &) -> bool;
-  auto parse_dbs(const std::string &, std::map<std::string, std::string> &) -> bool;
+  auto define(Conf &, const std::string &, DictClient::DefineSlot) -> unsigned;
 };
@@ -0,0 +1,684 @@
+/*
+ * dictclient.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "dictclient.hh"
+#include "macros.h"
+#include "utils.hh"
+#include <cstdlib>
+#include <fstream>
+
+#define CACHE_FILE "dict-cache"
+
+static std::string escape(const std::string &str)
+{
+  std::string res;
+  for (std::string::size_type x = 0; x < str.size(); x++) {
+    switch (str[x]) {
+      case '\\':
+        res += "\\\\";
+        break;
+      case '\t':
+        res += "\\t";
+        break;
+      case '\n':
+        res += "\\n";
+        break;
+      default:
+        res += str[x];
+    }
+  }
+  return res;
+}
+
+static std::string unescape(const std::string &str)
+{
+  std::string res;
+  for (std::string::size_type x = 0; x < str.size(); x++) {
+    if (str[x] == '\\' && x + 1 < str.size()) {
+      ++x;
+      res += str[x] == 't' ? '\t' : str[x] == 'n' ? '\n' : str[x];
+    } else {
+      res += str[x];
+    }
+  }
+  return res;
+}
+
+/**
+ * \brief quote a DICT command argument.
+ */
+static std::string quote(const std::string &str)
+{
+  std::string res = "\"";
+  for (std::string::size_type x = 0; x < str.size(); x++) {
+    if (str[x] == '\r' || str[x] == '\n') {
+      continue;
+    }
+    if (str[x] == '"' || str[x] == '\\') {
+      res += '\\';
+    }
+    res += str[x];
+  }
+  return res + "\"";
+}
+
+/**
+ * \brief look up a word.
+ * \param host the server.
+ * \param port the server port.
+ * \param db the database to search.
+ * \param word the word.
+ * \param slot gets the definitions.
+ * \return an id for cancel().
+ */
+unsigned DictClient::define(const std::string &host,
+                            int port,
+                            const std::string &db,
+                            const std::string &word,
+                            DefineSlot slot)
+{
+  Request *request = new Request;
+  request->id = ++last_id;
+  request->key = Utils::substitute("define\t%s:%i\t%s\t%s", host, port, db, word);
+  request->command = "DEFINE " + quote(db) + " " + quote(word) + "\r\n";
+  request->show_db = false;
+  request->retried = false;
+  request->define_slot = slot;
+
+  Entry entry;
+  if (lookup(request->key, entry)) {
+    // Answer from the main loop like we do for the network.
+    request->defs = entry.first;
+    deliver_later(request);
+    return request->id;
+  }
+
+  get_connection(host, port)->queue(request);
+  return request->id;
+}
+
+/**
+ * \brief list the databases of a server.
+ * \param host the server.
+ * \param port the server port.
+ * \param slot gets the databases and their descriptions.
+ * \return an id for cancel().
+ */
+unsigned DictClient::show_db(const std::string &host, int port, DatabasesSlot slot)
+{
+  Request *request = new Request;
+  request->id = ++last_id;
+  request->key = Utils::substitute("dbs\t%s:%i", host, port);
+  request->command = "SHOW DB\r\n";
+  request->show_db = true;
+  request->retried = false;
+  request->databases_slot = slot;
+
+  Entry entry;
+  if (lookup(request->key, entry)) {
+    request->dbs = entry.second;
+    deliver_later(request);
+    return request->id;
+  }
+
+  get_connection(host, port)->queue(request);
+  return request->id;
+}
+
+/**
+ * \brief don't call the slot of a request.
+ *
+ * The command stays in the pipeline so the replies still match the requests.
+ */
+void DictClient::cancel(unsigned id)
+{
+  std::map<unsigned, std::pair<sigc::connection, Request *> >::iterator pending = cached.find(id);
+  if (pending != cached.end()) {
+    pending->second.first.disconnect();
+    delete pending->second.second;
+    cached.erase(pending);
+    return;
+  }
+
+  for (std::map<std::string, Connection *>::iterator iter = connections.begin();
+       iter != connections.end();
+       iter++) {
+    if (iter->second->cancel(id)) {
+      return;
+    }
+  }
+}
+
+void DictClient::destroy()
+{
+  for (std::map<std::string, Connection *>::iterator iter = connections.begin();
+       iter != connections.end();
+       iter++) {
+    delete iter->second;
+  }
+  connections.clear();
+
+  for (std::map<unsigned, std::pair<sigc::connection, Request *> >::iterator iter = cached.begin();
+       iter != cached.end();
+       iter++) {
+    iter->second.first.disconnect();
+    delete iter->second.second;
+  }
+  cached.clear();
+
+  if (cache_dirty) {
+    save_cache();
+  }
+}
+
+DictClient::Connection *DictClient::get_connection(const std::string &host, int port)
+{
+  std::string key = Utils::substitute("%s:%i", host, port);
+  std::map<std::string, Connection *>::iterator iter = connections.find(key);
+  if (iter != connections.end()) {
+    return iter->second;
+  }
+
+  Connection *connection = new Connection(host, port);
+  connections[key] = connection;
+  return connection;
+}
+
+/**
+ * \brief answer a request from the cache once we are back in the main loop.
+ *
+ * Like the network does, so the caller gets its id before the slot is called.
+ */
+void DictClient::deliver_later(Request *request)
+{
+  sigc::connection conn = Glib::signal_idle().connect(
+      sigc::bind_return(sigc::bind(sigc::ptr_fun(&DictClient::deliver_cached), request->id),
+                        false));
+  cached[request->id] = std::make_pair(conn, request);
+}
+
+void DictClient::deliver_cached(unsigned id)
+{
+  std::map<unsigned, std::pair<sigc::connection, Request *> >::iterator iter = cached.find(id);
+  if (iter == cached.end()) {
+    return;
+  }
+
+  Request *request = iter->second.second;
+  cached.erase(iter);
+  deliver(request, true, std::string());
+}
+
+/**
+ * \brief hand a finished request to its slot and free it.
+ */
+void DictClient::deliver(Request *request, bool ok, const std::string &error)
+{
+  if (ok) {
+    remember(request->key, Entry(request->defs, request->dbs));
+  } else if (request->show_db) {
+    request->dbs.clear();
+    request->dbs[error] = "";
+  } else {
+    request->defs.clear();
+    request->defs.push_back(error);
+  }
+
+  if (request->show_db) {
+    if (!request->databases_slot.empty()) {
+      request->databases_slot(ok, request->dbs);
+    }
+  } else if (!request->define_slot.empty()) {
+    request->define_slot(ok, request->defs);
+  }
+
+  delete request;
+}
+
+bool DictClient::lookup(const std::string &key, Entry &entry)
+{
+  load_cache();
+
+  std::map<std::string, std::list<std::pair<std::string, Entry> >::iterator>::iterator iter =
+      cache.find(key);
+  if (iter == cache.end()) {
+    return false;
+  }
+
+  lru.splice(lru.begin(), lru, iter->second);
+  entry = iter->second->second;
+  return true;
+}
+
+void DictClient::remember(const std::string &key, const Entry &entry)
+{
+  load_cache();
+
+  std::map<std::string, std::list<std::pair<std::string, Entry> >::iterator>::iterator iter =
+      cache.find(key);
+  if (iter != cache.end()) {
+    lru.erase(iter->second);
+    cache.erase(iter);
+  }
+
+  lru.push_front(std::make_pair(key, entry));
+  cache[key] = lru.begin();
+
+  while (lru.size() > cache_size) {
+    cache.erase(lru.back().first);
+    lru.pop_back();
+  }
+
+  cache_dirty = true;
+}
+
+/**
+ * \brief load the cache. One entry per line, the most recently used first.
+ *
+ * A line is the key followed by the definitions or by database and description pairs, all
+ * escaped and separated by tabs.
+ */
+void DictClient::load_cache()
+{
+  if (cache_loaded) {
+    return;
+  }
+  cache_loaded = true;
+
+  std::ifstream ifs(Glib::build_filename(Utils::cacheDir(), CACHE_FILE).c_str());
+  std::string buff;
+  while (getline(ifs, buff) && lru.size() < cache_size) {
+    std::vector<std::string> fields = Utils::split(buff, '\t');
+    if (fields.empty()) {
+      continue;
+    }
+
+    std::string key = unescape(fields[0]);
+    Entry entry;
+    if (key.compare(0, 4, "dbs\t") == 0) {
+      for (unsigned x = 1; x + 1 < fields.size(); x += 2) {
+        entry.second[unescape(fields[x])] = unescape(fields[x + 1]);
+      }
+    } else {
+      for (unsigned x = 1; x < fields.size(); x++) {
+        entry.first.push_back(unescape(fields[x]));
+      }
+    }
+
+    if (cache.find(key) == cache.end()) {
+      lru.push_back(std::make_pair(key, entry));
+      cache[key] = --lru.end();
+    }
+  }
+}
+
+void DictClient::save_cache()
+{
+  if (g_mkdir_with_parents(Utils::cacheDir().c_str(), 0700) == -1) {
+    return;
+  }
+
+  std::ofstream ofs(Glib::build_filename(Utils::cacheDir(), CACHE_FILE).c_str());
+  for (std::list<std::pair<std::string, Entry> >::iterator iter = lru.begin(); iter != lru.end();
+       iter++) {
+    ofs << escape(iter->first);
+    for (unsigned x = 0; x < iter->second.first.size(); x++) {
+      ofs << '\t' << escape(iter->second.first[x]);
+    }
+    for (std::map<std::string, std::string>::iterator i = iter->second.second.begin();
+         i != iter->second.second.end();
+         i++) {
+      ofs << '\t' << escape(i->first) << '\t' << escape(i->second);
+    }
+    ofs << std::endl;
+  }
+
+  cache_dirty = false;
+}
+
+DictClient::Connection::Connection(const std::string &host, int port):
+ _host(host),
+ _port(port),
+ connecting(false),
+ greeted(false),
+ in_text(false),
+ _generation(0)
+{
+}
+
+DictClient::Connection::~Connection()
+{
+  watch.disconnect();
+  for (unsigned x = 0; x < requests.size(); x++) {
+    delete requests[x];
+  }
+}
+
+/**
+ * \brief send a command, connecting first if we have to.
+ */
+void DictClient::Connection::queue(Request *request)
+{
+  requests.push_back(request);
+  out += request->command;
+
+  if (greeted) {
+    flush();
+  } else if (!connecting) {
+    connect();
+  }
+}
+
+bool DictClient::Connection::cancel(unsigned id)
+{
+  for (unsigned x = 0; x < requests.size(); x++) {
+    if (requests[x]->id == id) {
+      requests[x]->define_slot = DefineSlot();
+      requests[x]->databases_slot = DatabasesSlot();
+      return true;
+    }
+  }
+  return false;
+}
+
+void DictClient::Connection::connect()
+{
+  connecting = true;
+  greeted = false;
+  in_text = false;
+  in.clear();
+
+  client = Gio::SocketClient::create();
+  client->connect_to_host_async(_host, _port, sigc::mem_fun(*this, &Connection::on_connected));
+}
+
+void DictClient::Connection::on_connected(Glib::RefPtr<Gio::AsyncResult> &result)
+{
+  connecting = false;
+
+  try {
+    connection = client->connect_to_host_finish(result);
+  } catch (Glib::Error &err) {
+    close(err.what());
+    return;
+  }
+
+  connection->get_socket()->set_blocking(false);
+  watch_socket();
+}
+
+/**
+ * \brief watch for replies, and for room to write if we have something to send.
+ */
+void DictClient::Connection::watch_socket()
+{
+  watch.disconnect();
+
+  Glib::IOCondition cond = Glib::IO_IN | Glib::IO_HUP | Glib::IO_ERR;
+  if (greeted && !out.empty()) {
+    cond |= Glib::IO_OUT;
+  }
+
+  watch = Glib::signal_io().connect(
+      sigc::mem_fun(*this, &Connection::on_io), connection->get_socket()->get_fd(), cond);
+}
+
+bool DictClient::Connection::on_io(Glib::IOCondition cond)
+{
+  if (cond & Glib::IO_OUT) {
+    flush();
+  }
+
+  if (cond & (Glib::IO_IN | Glib::IO_HUP | Glib::IO_ERR)) {
+    read();
+  }
+
+  // We replace the watch whenever we need another condition.
+  return true;
+}
+
+/**
+ * \brief read what we can and handle every complete line.
+ */
+void DictClient::Connection::read()
+{
+  Glib::RefPtr<Gio::Socket> socket = connection->get_socket();
+  char buf[4096];
+  bool closed = false;
+
+  while (true) {
+    try {
+      gssize n = socket->receive(buf, sizeof(buf));
+      if (n == 0) {
+        closed = true;
+        break;
+      }
+      in.append(buf, n);
+    } catch (Gio::Error &err) {
+      closed = err.code() != Gio::Error::WOULD_BLOCK;
+      break;
+    } catch (Glib::Error &err) {
+      closed = true;
+      break;
+    }
+  }
+
+  // A line can make us close() the connection which throws away what we read.
+  const unsigned generation = _generation;
+  std::string::size_type start = 0, end;
+  while ((end = in.find('\n', start)) != std::string::npos) {
+    std::string::size_type len = end - start;
+    if (len > 0 && in[end - 1] == '\r') {
+      --len;
+    }
+    line(in.substr(start, len));
+    if (generation != _generation) {
+      return;
+    }
+    start = end + 1;
+  }
+  in.erase(0, start);
+
+  if (closed) {
+    close(_("The dictionary server closed the connection."));
+  }
+}
+
+/**
+ * \brief send as much of what we have as the socket takes.
+ */
+void DictClient::Connection::flush()
+{
+  if (!connection || !greeted) {
+    return;
+  }
+
+  Glib::RefPtr<Gio::Socket> socket = connection->get_socket();
+  while (!out.empty()) {
+    try {
+      gssize n = socket->send(out.data(), out.size());
+      if (n <= 0) {
+        break;
+      }
+      out.erase(0, n);
+    } catch (Glib::Error &err) {
+      // Would block, or the connection is gone and read() will tell us.
+      break;
+    }
+  }
+
+  watch_socket();
+}
+
+void DictClient::Connection::line(const std::string &str)
+{
+  if (in_text) {
+    if (str == ".") {
+      in_text = false;
+      text_done();
+      return;
+    }
+
+    // Undo the dot stuffing.
+    text += str.compare(0, 2, "..") == 0 ? str.substr(1) : str;
+    text += '\n';
+    return;
+  }
+
+  status(atoi(str.c_str()), str);
+}
+
+void DictClient::Connection::status(int code, const std::string &str)
+{
+  if (!greeted) {
+    if (code == 220) {
+      greeted = true;
+      flush();
+    } else {
+      close(str);
+    }
+    return;
+  }
+
+  if (requests.empty()) {
+    return;
+  }
+
+  switch (code) {
+    case 110:   // n databases present
+    case 151:   // a definition follows
+      in_text = true;
+      text.clear();
+      break;
+    case 150:   // n definitions retrieved
+      break;
+    case 250:   // ok
+      finish(true, "");
+      break;
+    case 550:
+      finish(false, _("Invalid database. Please reconfigure the dictionary in use."));
+      break;
+    case 552:
+      finish(false, _("No matches were found"));
+      break;
+    case 554:
+      finish(false, _("No databases were found."));
+      break;
+    default:
+      if (code >= 400 || code < 100) {
+        finish(false, str);
+      }
+  }
+}
+
+/**
+ * \brief a text block ended. It's either a definition or the database list.
+ */
+void DictClient::Connection::text_done()
+{
+  if (requests.empty()) {
+    return;
+  }
+
+  Request *request = requests.front();
+  if (!request->show_db) {
+    if (!text.empty()) {
+      text.erase(text.size() - 1);
+    }
+    request->defs.push_back(text);
+    return;
+  }
+
+  std::vector<std::string> lines = Utils::split(text, '\n');
+  for (unsigned x = 0; x < lines.size(); x++) {
+    std::string::size_type sp = lines[x].find(' ');
+    if (sp == std::string::npos) {
+      continue;
+    }
+    std::string db = lines[x].substr(0, sp);
+    std::string desc = lines[x].substr(sp + 1);
+
+    sp = desc.find_first_of('"');
+    if (sp != std::string::npos) {
+      desc = desc.substr(++sp);
+    }
+
+    sp = desc.find_last_of('"');
+    if (sp != std::string::npos) {
+      desc = desc.substr(0, sp);
+    }
+    request->dbs[db] = desc;
+  }
+}
+
+void DictClient::Connection::finish(bool ok, const std::string &error)
+{
+  Request *request = requests.front();
+  requests.pop_front();
+  deliver(request, ok, error);
+}
+
+/**
+ * \brief drop the connection.
+ *
+ * Servers drop idle connections so a request that never got a reply is sent again once on a
+ * new connection. The rest fail with error.
+ */
+void DictClient::Connection::close(const std::string &error)
+{
+  ++_generation;
+  watch.disconnect();
+  connection.reset();
+  client.reset();
+  greeted = false;
+  in_text = false;
+  in.clear();
+  out.clear();
+
+  std::deque<Request *> pending;
+  pending.swap(requests);
+
+  for (unsigned x = 0; x < pending.size(); x++) {
+    Request *request = pending[x];
+    if (!request->retried && request->defs.empty() && request->dbs.empty()) {
+      request->retried = true;
+      requests.push_back(request);
+      out += request->command;
+    } else {
+      deliver(request, false, error);
+    }
+  }
+
+  if (!requests.empty()) {
+    connect();
+  }
+}
+
+/* Our static members */
+unsigned DictClient::last_id = 0;
+std::map<unsigned, std::pair<sigc::connection, DictClient::Request *> > DictClient::cached;
+std::map<std::string, DictClient::Connection *> DictClient::connections;
+std::list<std::pair<std::string, DictClient::Entry> > DictClient::lru;
+std::map<std::string, std::list<std::pair<std::string, DictClient::Entry> >::iterator>
+    DictClient::cache;
+bool DictClient::cache_loaded = false;
+bool DictClient::cache_dirty = false;
@@ -0,0 +1,124 @@
+/*
+ * dictclient.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include <deque>
+#include <giomm.h>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * \brief A DICT (RFC 2229) client.
+ *
+ * We keep one connection per server and pipeline the commands on it: every command is sent
+ * as soon as it's queued and the replies are parsed line by line as they arrive, in order.
+ * Definitions and database lists are kept in a least recently used cache which is saved
+ * under Utils::cacheDir() so repeated lookups are answered immediately and work offline.
+ *
+ * On failure the slots get the error as the first definition or the first database name.
+ */
+class DictClient {
+ public:
+  typedef sigc::slot<void, bool, const std::vector<std::string> &> DefineSlot;
+  typedef sigc::slot<void, bool, const std::map<std::string, std::string> &> DatabasesSlot;
+
+  static unsigned
+  define(const std::string &, int, const std::string &, const std::string &, DefineSlot);
+  static unsigned show_db(const std::string &, int, DatabasesSlot);
+  static void cancel(unsigned);
+  static void destroy();
+
+ private:
+  DictClient();
+
+  struct Request {
+    unsigned id;
+    std::string key;
+    std::string command;
+    bool show_db;
+    bool retried;
+    DefineSlot define_slot;
+    DatabasesSlot databases_slot;
+    std::vector<std::string> defs;
+    std::map<std::string, std::string> dbs;
+  };
+
+  class Connection {
+   public:
+    Connection(const std::string &, int);
+    ~Connection();
+    void queue(Request *);
+    bool cancel(unsigned);
+
+   private:
+    void connect();
+    void on_connected(Glib::RefPtr<Gio::AsyncResult> &);
+    bool on_io(Glib::IOCondition);
+    void watch_socket();
+    void read();
+    void flush();
+    void line(const std::string &);
+    void status(int, const std::string &);
+    void text_done();
+    void finish(bool, const std::string &);
+    void close(const std::string &);
+
+    std::string _host;
+    int _port;
+    Glib::RefPtr<Gio::SocketClient> client;
+    Glib::RefPtr<Gio::SocketConnection> connection;
+    sigc::connection watch;
+    bool connecting;
+    bool greeted;
+    bool in_text;
+    std::string text;
+    std::string in, out;
+    // Sent and waiting for a reply, in order.
+    std::deque<Request *> requests;
+    // Bumped by close() so read() knows the data it was parsing is gone.
+    unsigned _generation;
+  };
+
+  typedef std::pair<std::vector<std::string>, std::map<std::string, std::string> > Entry;
+
+  static Connection *get_connection(const std::string &, int);
+  static void deliver(Request *, bool, const std::string &);
+  static void deliver_later(Request *);
+  static void deliver_cached(unsigned);
+  static bool lookup(const std::string &, Entry &);
+  static void remember(const std::string &, const Entry &);
+  static void load_cache();
+  static void save_cache();
+
+  static unsigned last_id;
+  static std::map<std::string, Connection *> connections;
+  // Requests answered from the cache, waiting for the main loop.
+  static std::map<unsigned, std::pair<sigc::connection, Request *> > cached;
+
+  // Most recently used first.
+  static std::list<std::pair<std::string, Entry> > lru;
+  static std::map<std::string, std::list<std::pair<std::string, Entry> >::iterator> cache;
+  static bool cache_loaded;
+  static bool cache_dirty;
+  static const unsigned cache_size = 500;
+};
@@ -27,17 +27,22 @@
 
 #include "dialogs.hh"
 #include "document.hh"
+#include "langdetect.hh"
 #include "macros.h"
+#include "startupprofile.hh"
 #include "textbuffer.hh"
 #include "utils.hh"
+#include <algorithm>
 #include <cassert>
 #include <cerrno>
 #include <cstring>
 #include <gtkmm.h>
 #include <iostream>
-#include <sstream>
 #include <string>
 
+// Document::foreach_segment() copies about that many characters from the buffer at a time.
+#define SEGMENT_SIZE 65536
+
 // TODO:
 // highlight current line
 // right click on a word -> spell check word
@@ -67,6 +72,7 @@ void _on_toggle_overwrite(GtkTextView * /* textview */, gpointer user_data)
 
 Document::Document(Conf &conf, Encodings &encodings, int num):
  _label(conf),
+ _gutter(_text_view),
  _conf(conf),
  _encodings(encodings),
  _ok(true),
@@ -74,9 +80,11 @@ Document::Document(Conf &conf, Encodings &encodings, int num):
  _encoding(_encodings.utf8()),
  _readonly(false),
  _line_numbers(false),
+ _compression(Codec::NONE),
  __on_move_cursor(0),
  __on_toggle_overwrite(0),
- _overwrite(false)
+ _overwrite(false),
+ _autosave_busy(false)
 {
   _label.set_text(num);
   if (!create()) {
@@ -86,14 +94,17 @@ Document::Document(Conf &conf, Encodings &encodings, int num):
 
 Document::Document(Conf &conf, Encodings &encodings, int encoding, std::string &file):
  _label(conf),
+ _gutter(_text_view),
  _conf(conf),
  _encodings(encodings),
  _ok(false),
  _readonly(false),
  _line_numbers(false),
+ _compression(Codec::NONE),
  __on_move_cursor(0),
  __on_toggle_overwrite(0),
- _overwrite(false)
+ _overwrite(false),
+ _autosave_busy(false)
 {
   std::string contents;
 
@@ -112,7 +123,42 @@ Document::Document(Conf &conf, Encodings &encodings, int encoding, std::string &
       return;
     }
   }
+  StartupProfile::mark("Read the file");
+
+  load(file, contents, encoding);
+}
 
+/**
+ * \brief constructor for a compressed file.
+ * \param encoding the encoding of the decompressed text, or -1 to detect it.
+ * \param file the file.
+ * \param compression the format the file is compressed with, we save it back the same way.
+ * \param contents the decompressed contents of the file.
+ */
+Document::Document(Conf &conf,
+                   Encodings &encodings,
+                   int encoding,
+                   std::string &file,
+                   Codec::Format compression,
+                   std::string &contents):
+ _label(conf),
+ _gutter(_text_view),
+ _conf(conf),
+ _encodings(encodings),
+ _ok(false),
+ _readonly(false),
+ _line_numbers(false),
+ _compression(compression),
+ __on_move_cursor(0),
+ __on_toggle_overwrite(0),
+ _overwrite(false),
+ _autosave_busy(false)
+{
+  load(file, contents, encoding);
+}
+
+void Document::load(std::string &file, std::string &contents, int encoding)
+{
   _file = file;
 
   // is the file writable ?
@@ -125,12 +171,19 @@ Document::Document(Conf &conf, Encodings &encodings, int encoding, std::string &
     katoob_error(Utils::substitute(_("Couldn't detect the encoding of %s"), file));
     return;
   }
+  StartupProfile::mark("Encoding detection and conversion");
   _encoding = enc;
-  if (!create(enc == _encodings.utf8() ? contents : contents2)) {
+  std::string &text = enc == _encodings.utf8() ? contents : contents2;
+  if (!create(text)) {
     _ok = false;
     return;
   }
 
+#ifdef ENABLE_SPELL
+  spell_detect_dictionary(text.c_str(), text.size());
+  StartupProfile::mark("Spelling language detection");
+#endif
+
 #ifdef GLIBMM_EXCEPTIONS_ENABLED
   try {
     _label.set_text(Glib::filename_to_utf8(Glib::path_get_basename(file)));
@@ -150,7 +203,7 @@ Document::Document(Conf &conf, Encodings &encodings, int encoding, std::string &
 
 #ifdef ENABLE_HIGHLIGHT
   // auto highlight.
-  if (conf.get("highlight_auto", true)) {
+  if (_conf.get("highlight_auto", true)) {
     set_highlight(SourceManager::get_language_for_file(file));
   }
 #endif
@@ -158,14 +211,17 @@ Document::Document(Conf &conf, Encodings &encodings, int encoding, std::string &
 
 Document::Document(Conf &conf, Encodings &encodings, int num, int encoding):
  _label(conf),
+ _gutter(_text_view),
  _conf(conf),
  _encodings(encodings),
  _ok(false),
  _readonly(false),
  _line_numbers(false),
+ _compression(Codec::NONE),
  __on_move_cursor(0),
  __on_toggle_overwrite(0),
- _overwrite(false)
+ _overwrite(false),
+ _autosave_busy(false)
 {
   // TODO: Bad, We are reading character by character.
   std::string contents;
@@ -183,11 +239,17 @@ Document::Document(Conf &conf, Encodings &encodings, int num, int encoding):
     return;
   }
   _encoding = enc;
-  if (!create(enc == _encodings.utf8() ? contents : contents2)) {
+  std::string &text = enc == _encodings.utf8() ? contents : contents2;
+  if (!create(text)) {
     _ok = false;
     return;
   }
 
+#ifdef ENABLE_SPELL
+  spell_detect_dictionary(text.c_str(), text.size());
+  StartupProfile::mark("Spelling language detection");
+#endif
+
   _label.set_text(num);
   _ok = true;
   set_modified(true);
@@ -195,6 +257,10 @@ Document::Document(Conf &conf, Encodings &encodings, int num, int encoding):
 
 Document::~Document()
 {
+  if (_autosave_thread.joinable()) {
+    _autosave_thread.join();
+  }
+
   clear_do();
 
   // Disconnect our handlers.
@@ -237,6 +303,8 @@ void Document::connect_signals()
                                            "toggle-overwrite",
                                            G_CALLBACK(_on_toggle_overwrite),
                                            this);
+
+  _updates.signal_dispatch.connect(sigc::mem_fun(*this, &Document::dispatch_updates));
 }
 
 bool Document::has_selection()
@@ -245,6 +313,13 @@ bool Document::has_selection()
   return _text_view.get_buffer()->get_selection_bounds(a, b);
 }
 
+std::string Document::get_selected_text()
+{
+  Gtk::TextIter a, b;
+  _text_view.get_buffer()->get_selection_bounds(a, b);
+  return _text_view.get_buffer()->get_text(a, b);
+}
+
 void Document::block_do()
 {
   // We can't block the signal otherwise our spell checker invalidation
@@ -295,27 +370,78 @@ bool Document::create(const std::string &str)
 
   create_ui();
   connect_signals();
+  StartupProfile::mark("Document widgets");
 
   if (str.size() == 0) {
     return true;
   }
 
-  // We must connect the signals first so that the spell checker can create its lines
-  // We will block do_undo
-  if (do_undo) {
-    do_undo = false;
-    set_text(const_cast<std::string &>(str));
-    do_undo = true;
-  } else {
-    set_text(const_cast<std::string &>(str));
-  }
+  set_text(str);
+  StartupProfile::mark("Load the text into the buffer");
 
   return true;
 }
 
-void Document::set_text(std::string &str)
+void Document::set_text(const std::string &str, bool undoable)
+{
+  Glib::RefPtr<TextBuffer> buffer = Glib::RefPtr<TextBuffer>::cast_dynamic(_text_view.get_buffer());
+  bool had_text = buffer->get_char_count() > 0;
+
+  replace_text(str);
+
+  if (undoable && do_undo) {
+    // TextBuffer kept the old text for us. Undoing brings it back in one step.
+    if (had_text || str.size() > 0) {
+      undo_push(new KatoobDoElem(buffer->get_deleted(), str));
+    }
+  } else {
+    // The recorded offsets are meaningless for the new text.
+    clear_do();
+    _updates.queue(UpdateBus::UPDATE_CAN_UNDO | UpdateBus::UPDATE_CAN_REDO);
+  }
+  buffer->clear_deleted();
+}
+
+/**
+ * \brief swap the whole text of the buffer and rebuild what we keep about it.
+ *
+ * Nothing is recorded for undo, that's up to the caller.
+ */
+void Document::replace_text(const std::string &str)
 {
-  _text_view.get_buffer()->set_text(str);
+  Glib::RefPtr<TextBuffer> buffer = Glib::RefPtr<TextBuffer>::cast_dynamic(_text_view.get_buffer());
+
+  // Our insert and erase handlers do their bookkeeping per edit, which for a whole file means
+  // growing the spell lines one insert at a time. We load with them blocked and rebuild
+  // everything they maintain below.
+  insert_conn.block();
+  erase_conn.block();
+  buffer->set_text(str);
+  erase_conn.unblock();
+  insert_conn.unblock();
+
+#ifdef ENABLE_SPELL
+  spell_index.clear();
+  lines.assign(buffer->get_line_count(), true);
+  spell_checker_connect_worker();
+
+  // The constructor detects the language of what it loads, Anything else might be in another one.
+  if ((_ok) && (buffer->get_char_count() >= 1024) && (!spell_detect_conn.connected())) {
+    _spell_detect_offset = 0;
+    spell_detect_conn =
+        Glib::signal_idle().connect(sigc::mem_fun(*this, &Document::spell_detect_worker));
+  }
+#endif
+
+  _column_line = -1;
+
+  if (_chunks.active()) {
+    _chunks.reset();
+    foreach_segment(sigc::mem_fun(_chunks, &TextChunks::append));
+  }
+
+  buffer->place_cursor(buffer->begin());
+  _updates.queue(UpdateBus::UPDATE_CURSOR | UpdateBus::UPDATE_MODIFIED);
 }
 
 void Document::create_ui()
@@ -372,6 +498,8 @@ void Document::create_ui()
   misspelled_tag->property_underline() = Pango::UNDERLINE_ERROR;
 #endif
 
+  _column_line = -1;
+
   // TODO: Make these configurable ?
   _search_from_beginning = true;
   _search_wrap = true;
@@ -409,39 +537,63 @@ void Document::set_readonly(bool r)
   signal_readonly_set.emit(r);
 }
 
-void Document::scroll_to(int x)
+void Document::scroll_to(int x, int y)
 {
-  Gtk::TextIter iter = _text_view.get_buffer()->get_iter_at_line(--x);
-  _text_view.get_buffer()->place_cursor(iter);
-  _text_view.scroll_to(iter);
-  /*
-    _text_view.get_buffer()->move_mark(_text_view.get_buffer()->get_insert(), iter);
-  */
+  Glib::RefPtr<Gtk::TextBuffer> buffer = _text_view.get_buffer();
+  Gtk::TextIter iter = buffer->get_iter_at_line(--x);
+  if (y > 1) {
+    // Don't go past the end of the line.
+    Gtk::TextIter end = iter;
+    if (!end.ends_line()) {
+      end.forward_to_line_end();
+    }
+    iter.set_line_offset(std::min(y - 1, end.get_line_offset()));
+  }
+  buffer->place_cursor(iter);
+  // The mark is scrolled to once we are allocated. Scrolling to an iter needs a valid size.
+  _text_view.scroll_to(buffer->get_insert());
 }
 
 bool Document::save(std::string &ofile, int enc, bool replace)
 {
-  std::string txt = _text_view.get_buffer()->get_text();
   std::string str, err;
 
+  // Our own file is saved back compressed the way it was, other files the way their name says.
+  Codec::Format format = ofile == _file ? _compression : Codec::format_for_name(ofile);
+
   if (enc == _encodings.utf8()) {
-    if (Utils::katoob_write(_conf, ofile, txt, err)) {
+    bool ok;
+    if (format == Codec::NONE) {
+      // Straight from the buffer to the file.
+      ok = Utils::katoob_write(_conf, ofile, sigc::mem_fun(*this, &Document::write_segments), err);
+    } else {
+      std::string txt = get_text();
+      ok = write_file(ofile, txt, format, err);
+    }
+
+    if (ok) {
       set_modified(false);
       if (replace) {
         set_readonly(false);
         set_file(ofile);
+        _compression = format;
       }
       return true;
     } else {
       katoob_error(err);
       return false;
     }
-  } else if (_encodings.convert_from(txt, str, enc) != -1) {
-    if (Utils::katoob_write(_conf, ofile, str, err)) {
+  }
+
+  std::string txt = get_text();
+  if (_encodings.convert_from(txt, str, enc) != -1) {
+    txt.clear();
+    if (write_file(ofile, str, format, err)) {
       set_modified(false);
       if (replace) {
         set_readonly(false);
         set_file(ofile);
+        _compression = format;
 
         // NOTE: We are doing it manually without calling set_encoding() because it will also mark
         // the Document as modified but it's not.
@@ -459,6 +611,29 @@ bool Document::save(std::string &ofile, int enc, bool replace)
   }
 }
 
+/**
+ * \brief write the text to a file, compressing it first if we have to.
+ */
+bool Document::write_file(std::string &file,
+                          std::string &text,
+                          Codec::Format format,
+                          std::string &error)
+{
+  if (format == Codec::NONE) {
+    return Utils::katoob_write(_conf, file, text, error);
+  }
+
+  // 0 means the level the command line tools use.
+  int level = _conf.get("compression_level", 0);
+
+  std::string data;
+  if (!Codec::encode(format, level > 0 ? level : -1, text.data(), text.size(), data, error)) {
+    return false;
+  }
+
+  return Utils::katoob_write(_conf, file, data, error);
+}
+
 void Document::set_file(std::string &nfile)
 {
   _file = nfile;
@@ -487,39 +662,69 @@ void Document::set_file(std::string &nfile)
 
 void Document::on_insert(const Gtk::TextBuffer::iterator &iter, const Glib::ustring &str, int len)
 {
+  int pos =
+      Glib::RefPtr<TextBuffer>::cast_dynamic(_text_view.get_buffer())->get_mark_insert_position();
+
   // Let's add to our undo stack.
   if (do_undo) {
-    undo(KATOOB_DO_INSERT,
-         str,
-         Glib::RefPtr<TextBuffer>::cast_dynamic(_text_view.get_buffer())
-             ->get_mark_insert_position());
+    undo(KATOOB_DO_INSERT, str, pos);
   }
 
 #ifdef ENABLE_SPELL
+  // NOTE: Don't use str for the length, TextBuffer might have inserted something else.
+  spell_index.insert(pos, iter.get_offset() - pos);
   spell_checker_on_insert(iter, len);
   spell_checker_connect_worker();
+
+  // A big paste might be in another language. We don't do it while loading, the constructor
+  // will take care of it.
+  if ((_ok) && (iter.get_offset() - pos >= 1024) && (!spell_detect_conn.connected())) {
+    _spell_detect_offset = pos;
+    spell_detect_conn =
+        Glib::signal_idle().connect(sigc::mem_fun(*this, &Document::spell_detect_worker));
+  }
 #endif
 
-  on_move_cursor();
-  signal_modified_set.emit(true);
+  column_cache_on_insert(_text_view.get_buffer()->get_iter_at_offset(pos), iter, str);
+
+  if (_chunks.active()) {
+    // TextBuffer might have inserted something else than str.
+    Glib::ustring text = _text_view.get_buffer()->get_text(
+        _text_view.get_buffer()->get_iter_at_offset(pos), iter, true);
+    _chunks.insert(pos, text.data(), text.bytes());
+  }
+
+  _updates.queue(UpdateBus::UPDATE_CURSOR | UpdateBus::UPDATE_MODIFIED);
 }
 
 void Document::on_erase(const Gtk::TextBuffer::iterator &start,
                         const Gtk::TextBuffer::iterator &end)
 {
+  Glib::RefPtr<TextBuffer> b = Glib::RefPtr<TextBuffer>::cast_dynamic(_text_view.get_buffer());
+
+#ifdef ENABLE_SPELL
+  int len = g_utf8_strlen(b->get_deleted().c_str(), b->get_deleted().size());
+#endif
+
+  column_cache_on_erase(start, b->get_erase_line(), b->get_deleted());
+
+  if (_chunks.active()) {
+    _chunks.erase(start.get_offset(),
+                  g_utf8_strlen(b->get_deleted().data(), b->get_deleted().size()));
+  }
+
   if (do_undo) {
-    Glib::RefPtr<TextBuffer> b = Glib::RefPtr<TextBuffer>::cast_dynamic(_text_view.get_buffer());
     undo(KATOOB_DO_DELETE, b->get_deleted(), start.get_offset());
     b->clear_deleted();
   }
 
 #ifdef ENABLE_SPELL
+  spell_index.erase(start.get_offset(), start.get_offset() + len);
   spell_checker_on_erase(start, end);
   spell_checker_connect_worker();
 #endif
 
-  on_move_cursor();
-  signal_modified_set.emit(true);
+  _updates.queue(UpdateBus::UPDATE_CURSOR | UpdateBus::UPDATE_MODIFIED);
 }
 
 void Document::on_mark_set_cb(const Gtk::TextBuffer::iterator & /* iter */,
@@ -538,9 +743,33 @@ void Document::on_toggle_overwrite()
 }
 
 void Document::on_move_cursor()
+{
+  _updates.queue(UpdateBus::UPDATE_CURSOR);
+}
+
+void Document::dispatch_updates(int what)
+{
+  if (what & UpdateBus::UPDATE_CURSOR) {
+    emit_cursor();
+  }
+  if (what & UpdateBus::UPDATE_MODIFIED) {
+    signal_modified_set.emit(is_modified());
+  }
+  if (what & UpdateBus::UPDATE_CAN_UNDO) {
+    signal_can_undo.emit(can_undo());
+  }
+  if (what & UpdateBus::UPDATE_CAN_REDO) {
+    signal_can_redo.emit(can_redo());
+  }
+}
+
+void Document::emit_cursor()
 {
   Gtk::TextIter iter =
       _text_view.get_buffer()->get_iter_at_mark(_text_view.get_buffer()->get_insert());
+  if (_line_numbers) {
+    _gutter.set_current_line(iter.get_line());
+  }
   signal_cursor_moved.emit(calculate_column(iter) + 1, iter.get_line() + 1);
 }
 
@@ -551,21 +780,113 @@ int Document::calculate_column(Gtk::TextIter &iter)
   int column = 0;
   Gtk::TextIter start = iter;
 
-  start.set_line_offset(0);
+  if ((_column_line == iter.get_line()) && (_column_offset <= iter.get_chars_in_line())) {
+    start.set_line_offset(_column_offset);
+    column = _column;
+  } else {
+    start.set_line_offset(0);
+  }
 
-  while (start != iter) {
+  while (start < iter) {
     column += start.get_char() == '\t' ? 8 : 1;
     start.forward_char();
   }
 
+  while (start > iter) {
+    start.backward_char();
+    column -= start.get_char() == '\t' ? 8 : 1;
+  }
+
+  _column_line = iter.get_line();
+  _column_offset = iter.get_line_offset();
+  _column = column;
+
   return column;
 }
 
+// The column of a position only depends on the characters before it on the same line, so an
+// edit after the cached position doesn't affect it and one before it only shifts it.
+void Document::column_cache_on_insert(const Gtk::TextIter &start,
+                                      const Gtk::TextIter &end,
+                                      const Glib::ustring &str)
+{
+  if (_column_line == -1) {
+    return;
+  }
+
+  if (start.get_line() < _column_line) {
+    if (end.get_line() != start.get_line()) {
+      _column_line = -1;
+    }
+  } else if ((start.get_line() == _column_line) && (start.get_line_offset() < _column_offset)) {
+    if (end.get_line() != start.get_line()) {
+      _column_line = -1;
+      return;
+    }
+
+    int len = end.get_offset() - start.get_offset();
+    _column_offset += len;
+    _column += len;
+    for (Glib::ustring::const_iterator iter = str.begin(); iter != str.end(); iter++) {
+      if (*iter == '\t') {
+        _column += 7;
+      }
+    }
+  }
+}
+
+void Document::column_cache_on_erase(const Gtk::TextIter &start,
+                                     int end_line,
+                                     const std::string &deleted)
+{
+  if ((_column_line == -1) || (start.get_line() > _column_line)) {
+    return;
+  }
+
+  if (end_line != start.get_line()) {
+    // Lines were joined. Either our line moved or it lost the characters before us.
+    if ((start.get_line() < _column_line) || (start.get_line_offset() < _column_offset)) {
+      _column_line = -1;
+    }
+    return;
+  }
+
+  if ((start.get_line() < _column_line) || (start.get_line_offset() >= _column_offset)) {
+    return;
+  }
+
+  int len = g_utf8_strlen(deleted.c_str(), deleted.size());
+  if (start.get_line_offset() + len > _column_offset) {
+    // The cached position itself was erased.
+    _column_line = -1;
+    return;
+  }
+
+  _column_offset -= len;
+  _column -= len;
+  for (unsigned x = 0; x < deleted.size(); x++) {
+    if (deleted[x] == '\t') {
+      _column -= 7;
+    }
+  }
+}
+
 void Document::insert(const std::string &str)
 {
   _text_view.get_buffer()->insert_at_cursor(str);
 }
 
+/**
+ * \brief add text at the end without an undo step, for documents loaded in pieces.
+ */
+void Document::append(const std::string &str)
+{
+  bool undo = do_undo;
+  block_do();
+  _text_view.get_buffer()->insert(_text_view.get_buffer()->end(), str);
+  do_undo = undo;
+}
+
 void Document::undo()
 {
   if (_undo.size() == 0) {
@@ -579,7 +900,7 @@ void Document::undo()
   undo(e);
 
   if (_undo.size() == 0) {
-    signal_can_undo.emit(false);
+    _updates.queue(UpdateBus::UPDATE_CAN_UNDO);
   }
 }
 
@@ -595,20 +916,24 @@ void Document::redo()
 
   redo(e);
 
-  int x = _redo.size();
-  if (x == 0) {
-    signal_can_redo.emit(false);
-  } else if (x == 1) {
-    signal_can_redo.emit(true);
+  if (_redo.size() <= 1) {
+    _updates.queue(UpdateBus::UPDATE_CAN_REDO);
   }
 }
 
 void Document::undo(KatoobDoType a, const std::string &t, int p)
 {
-  KatoobDoElem *e = new KatoobDoElem(a, t, p);
+  undo_push(new KatoobDoElem(a, t, p));
+}
+
+/**
+ * \brief record an undo step.
+ */
+void Document::undo_push(KatoobDoElem *e)
+{
   _undo.push_back(e);
   if (_undo.size() == 1) {
-    signal_can_undo.emit(true);
+    _updates.queue(UpdateBus::UPDATE_CAN_UNDO);
   }
 
   // Did we exceed ?
@@ -633,7 +958,10 @@ void Document::redo(KatoobDoElem *e)
 
   // We are dealing with char offsets.
   Gtk::TextIter iter = _text_view.get_buffer()->get_iter_at_offset(e->pos());
-  if (e->action() == KATOOB_DO_INSERT) {
+  if (e->action() == KATOOB_DO_REPLACE) {
+    replace_text(e->text());
+    Glib::RefPtr<TextBuffer>::cast_dynamic(_text_view.get_buffer())->clear_deleted();
+  } else if (e->action() == KATOOB_DO_INSERT) {
     // We will delete.
     Gtk::TextIter iter2 = iter;
     int n = iter2.get_offset();
@@ -657,7 +985,7 @@ void Document::redo(KatoobDoElem *e)
   if (s == 0) {
     // unlimited.
     if (_undo.size() == 1) {
-      signal_can_undo.emit(true);
+      _updates.queue(UpdateBus::UPDATE_CAN_UNDO);
     }
     return;
   }
@@ -668,7 +996,7 @@ void Document::redo(KatoobDoElem *e)
     _undo.erase(_undo.begin());
   }
   if (_undo.size() == 1) {
-    signal_can_undo.emit(true);
+    _updates.queue(UpdateBus::UPDATE_CAN_UNDO);
   }
 }
 
@@ -678,7 +1006,10 @@ void Document::undo(KatoobDoElem *e)
 
   // We are dealing with char offsets.
   Gtk::TextIter iter = _text_view.get_buffer()->get_iter_at_offset(e->pos());
-  if (e->action() == KATOOB_DO_INSERT) {
+  if (e->action() == KATOOB_DO_REPLACE) {
+    replace_text(e->text());
+    Glib::RefPtr<TextBuffer>::cast_dynamic(_text_view.get_buffer())->clear_deleted();
+  } else if (e->action() == KATOOB_DO_INSERT) {
     // We will delete.
     Gtk::TextIter iter2 = iter;
     int n = iter2.get_offset();
@@ -702,7 +1033,7 @@ void Document::undo(KatoobDoElem *e)
   if (s == 0) {
     // unlimited.
     if (_redo.size() == 1) {
-      signal_can_redo.emit(true);
+      _updates.queue(UpdateBus::UPDATE_CAN_REDO);
     }
     return;
   }
@@ -713,7 +1044,7 @@ void Document::undo(KatoobDoElem *e)
     _redo.erase(_redo.begin());
   }
   if (_redo.size() == 1) {
-    signal_can_redo.emit(true);
+    _updates.queue(UpdateBus::UPDATE_CAN_REDO);
   }
 }
 
@@ -760,38 +1091,148 @@ void Document::get_selection(std::vector<std::string> &l)
   get_lines(start, end, l);
 }
 
+/**
+ * \brief split segments back into lines, the delimiters are dropped.
+ * \param open true while the text so far ends with a delimiter, or is empty. There's an empty
+ * line after it then unless more text comes.
+ */
+template <class T>
+static bool split_lines(const char *text, std::size_t len, int, int, std::vector<T> *l, bool *open)
+{
+  const char *end = text + len;
+  while (text < end) {
+    gint delim, next;
+    pango_find_paragraph_boundary(text, end - text, &delim, &next);
+    l->push_back(T(text, text + delim));
+    *open = (next != delim);
+    text += next;
+  }
+  return true;
+}
+
 void Document::get_lines(Gtk::TextIter &start, Gtk::TextIter &end, std::vector<std::string> &l)
 {
-  Gtk::TextIter dummy;
-  while (start <= end) {
-    dummy = start;
-    if (!dummy.ends_line()) {
-      dummy.forward_to_line_end();
-    }
+  if (start > end) {
+    return;
+  }
 
-    l.push_back(_text_view.get_buffer()->get_text(start, dummy, false));
+  // The last line is included, without its delimiter.
+  Gtk::TextIter stop = end;
+  if (!stop.ends_line()) {
+    stop.forward_to_line_end();
+  }
 
-    if (!start.forward_line()) {
-      break;
-    }
+  bool open = true;
+  foreach_segment(start, stop, sigc::bind(sigc::ptr_fun(&split_lines<std::string>), &l, &open));
+  if (open) {
+    l.push_back(std::string());
   }
 }
 
 void Document::get_lines(Gtk::TextIter &start, Gtk::TextIter &end, std::vector<Glib::ustring> &l)
 {
-  Gtk::TextIter dummy;
-  while (start <= end) {
-    dummy = start;
-    if (!dummy.ends_line()) {
-      dummy.forward_to_line_end();
+  if (start > end) {
+    return;
+  }
+
+  // The last line is included, without its delimiter.
+  Gtk::TextIter stop = end;
+  if (!stop.ends_line()) {
+    stop.forward_to_line_end();
+  }
+
+  bool open = true;
+  foreach_segment(start, stop, sigc::bind(sigc::ptr_fun(&split_lines<Glib::ustring>), &l, &open));
+  if (open) {
+    l.push_back(Glib::ustring());
+  }
+}
+
+/**
+ * \brief go over the text of some lines a piece at a time, without copying all of it.
+ *
+ * Every segment ends after a line delimiter or at the end of the range so no line is split
+ * between two of them, a line longer than SEGMENT_SIZE characters makes a longer segment. The
+ * pointer is only valid while the slot runs.
+ *
+ * \param slot gets the UTF-8 text, its length in bytes, the line it starts at and its offset in
+ * characters from the start of the buffer. It returns false to stop.
+ * \param first the first line or -1 for the start of the buffer.
+ * \param last the last line, included, or -1 for the end of the buffer.
+ * \return false if the slot stopped us.
+ */
+bool Document::foreach_segment(const SegmentSlot &slot, int first, int last) const
+{
+  // We only read from it but gtkmm has no const iterators.
+  Glib::RefPtr<Gtk::TextBuffer> buffer =
+      Glib::RefPtr<Gtk::TextBuffer>::cast_const(_text_view.get_buffer());
+
+  Gtk::TextIter start = first == -1 ? buffer->begin() : buffer->get_iter_at_line(first);
+  Gtk::TextIter end = buffer->end();
+  if (last != -1) {
+    end = buffer->get_iter_at_line(last);
+    end.forward_line();
+  }
+
+  return foreach_segment(start, end, slot);
+}
+
+bool Document::foreach_segment(Gtk::TextIter start,
+                               const Gtk::TextIter &end,
+                               const SegmentSlot &slot) const
+{
+  Glib::RefPtr<Gtk::TextBuffer> buffer =
+      Glib::RefPtr<Gtk::TextBuffer>::cast_const(_text_view.get_buffer());
+
+  while (start < end) {
+    Gtk::TextIter stop = start;
+    stop.forward_chars(SEGMENT_SIZE);
+    if (!stop.starts_line()) {
+      stop.forward_line();
+    }
+    if (stop > end) {
+      stop = end;
     }
 
-    l.push_back(_text_view.get_buffer()->get_text(start, dummy, false));
+    gchar *text = gtk_text_buffer_get_text(buffer->gobj(), start.gobj(), stop.gobj(), TRUE);
+    bool go = slot(text, strlen(text), start.get_line(), start.get_offset());
+    g_free(text);
 
-    if (!start.forward_line()) {
-      break;
+    if (!go) {
+      return false;
     }
+    start = stop;
+  }
+
+  return true;
+}
+
+/**
+ * \brief take a snapshot of the text for another thread.
+ *
+ * The first one copies the text, we keep it up to date after that and the next ones are cheap.
+ */
+std::shared_ptr<const TextSnapshot> Document::snapshot()
+{
+  if (!_chunks.active()) {
+    _chunks.reset();
+    foreach_segment(sigc::mem_fun(_chunks, &TextChunks::append));
   }
+
+  return _chunks.snapshot();
+}
+
+static bool write_segment(const char *text, std::size_t len, int, int, int fd)
+{
+  return Utils::write_all(fd, text, len);
+}
+
+/**
+ * \brief write the text to a file as it is in the buffer.
+ */
+bool Document::write_segments(int fd) const
+{
+  return foreach_segment(sigc::bind(sigc::ptr_fun(&write_segment), fd));
 }
 
 void Document::select_all()
@@ -837,6 +1278,9 @@ void Document::line_numbers(bool show)
   //#else
   _line_numbers = show;
 
+  // We are resizing the border windows ourselves.
+  _gutter.reset();
+
   if (show) {
     if (_conf.get("numbers_right", true)) {
       _text_view.set_border_window_size(numbers_right, 20);
@@ -869,6 +1313,9 @@ void Document::line_numbers(bool show)
 
 void Document::emit_signals()
 {
+  // We are emitting everything anyway.
+  _updates.cancel();
+
   signal_can_undo.emit(can_undo());
   signal_can_redo.emit(can_redo());
   signal_modified_set.emit(is_modified());
@@ -876,7 +1323,7 @@ void Document::emit_signals()
   signal_file_changed.emit(_file);
   signal_encoding_changed.emit(_encoding);
   signal_overwrite_toggled.emit(_overwrite);
-  on_move_cursor();
+  emit_cursor();
   signal_title_changed.emit(get_title());
 #ifdef ENABLE_SPELL
   signal_auto_spell_set.emit(do_spell);
@@ -1087,85 +1534,16 @@ bool Document::expose_event_cb(GdkEventExpose *event)
 #ifndef ENABLE_HIGHLIGHT
   // left.
   if ((wl) && (wl->gobj() == event->window)) {
-    paint_line_numbers(wl, event);
+    _gutter.paint(wl, event);
   }
 #endif
 
   if ((wr) && (wr->gobj() == event->window)) {
-    paint_line_numbers(wr, event);
+    _gutter.paint(wr, event);
   }
   return false;
 }
 
-void Document::paint_line_numbers(Glib::RefPtr<Gdk::Window> &win, GdkEventExpose * /* event */)
-{
-  // Let's get the current line number.
-  int current_line =
-      _text_view.get_buffer()->get_iter_at_mark(_text_view.get_buffer()->get_insert()).get_line() +
-      1;
-
-  win->clear();
-
-  // We need to calculate the maximum width possible.
-  Gtk::TextIter end = _text_view.get_buffer()->end();
-
-  Gtk::TextWindowType w = _text_view.get_window_type(win);
-
-  std::stringstream width;
-  width << (end.get_line() + 1);
-  Glib::RefPtr<Pango::Layout> layout = _text_view.create_pango_layout(width.str().c_str());
-  int size = 0, dummy;
-  layout->get_pixel_size(size, dummy);
-  _text_view.set_border_window_size(w, size + 4);
-
-  // Now let's paint.
-  Gdk::Rectangle rect;
-  _text_view.get_visible_rect(rect);
-
-  Gtk::TextIter s, e;
-  int top1, top2;
-  _text_view.get_line_at_y(s, rect.get_y(), top1);
-  _text_view.get_line_at_y(e, rect.get_y() + rect.get_height(), top2);
-
-  int _s = s.get_line();
-  int _e = e.get_line();
-
-  //  Gtk::StateType st = _text_view.get_state();
-
-  Glib::ustring dummy3;
-
-  for (int x = _s; x <= _e;) {
-    // We are reusing what's declared above!!
-    end.set_line(x);
-    _text_view.get_line_yrange(end, top1, top2);
-
-    _text_view.buffer_to_window_coords(w, 0, top1, top1, top2);
-    std::string w;
-    if (current_line == x + 1) {
-      w = Utils::substitute("<b>%i</b>", ++x);
-      layout->set_markup(w.c_str());
-    } else {
-      w = Utils::substitute("%i", ++x);
-      // NOTE: Why set_text() will keep it bold ?
-      layout->set_markup(w.c_str());
-    }
-
-    // TODO: This one is not working !!!
-    //_text_view.get_style()->paint_layout(win, st, false, rect, _text_view, dummy3, 0, top2,
-    // layout);
-    gtk_paint_layout(dynamic_cast<Gtk::Widget &>(_text_view).gobj()->style,
-                     win->gobj(),
-                     (GtkStateType) GTK_WIDGET_STATE(_text_view.gobj()),
-                     FALSE,
-                     NULL,
-                     dynamic_cast<Gtk::Widget &>(_text_view).gobj(),
-                     NULL,
-                     2,
-                     top2,
-                     layout->gobj());
-  }
-}
-
 bool Document::set_encoding(int e, bool convert, std::string &err)
 {
   if (!convert) {
@@ -1180,12 +1558,12 @@ bool Document::set_encoding(int e, bool convert, std::string &err)
       // If the new encoding is utf8, We'll just insert it.
       if (e == _encodings.utf8()) {
         _encoding = e;
-        _text_view.get_buffer()->set_text(ntxt);
+        set_text(ntxt, true);
       }
       // Now let's convert it to the new encoding.
       else if (_encodings.convert_to(ntxt, txt, e) != -1) {
         _encoding = e;
-        _text_view.get_buffer()->set_text(txt);
+        set_text(txt, true);
       } else {
         err = txt;
         return false;
@@ -1198,10 +1576,10 @@ bool Document::set_encoding(int e, bool convert, std::string &err)
 
   signal_encoding_changed.emit(e);
 
-  // We are emitting the signal by ourselves because a change in the encoding is not
+  // We are queueing the signal by ourselves because a change in the encoding is not
   // considered a modification by Gtk::TextBuffer
   _text_view.get_buffer()->set_modified(true);
-  signal_modified_set.emit(true);
+  _updates.queue(UpdateBus::UPDATE_MODIFIED);
 
   // TODO: Do we need to be able to undo/redo the change in the encoding ?
   // If yes:
@@ -1218,28 +1596,28 @@ bool Document::set_encoding(int e, bool convert, std::string &err)
 bool Document::revert(std::string &err)
 {
   std::string contents;
-  if (!Utils::katoob_read(_file, contents)) {
+  if (_compression != Codec::NONE) {
+    if (!Codec::decode_file(_compression, _file, contents, err)) {
+      return false;
+    }
+  } else if (!Utils::katoob_read(_file, contents)) {
     err = contents;
     return false;
   }
 
   if (_encoding == _encodings.utf8()) {
-    _text_view.get_buffer()->set_text(contents);
+    set_text(contents);
   } else {
     std::string c;
     if (_encodings.convert_to(contents, c, _encoding) == -1) {
       err = c;
       return false;
     } else {
-      _text_view.get_buffer()->set_text(c);
+      set_text(c);
     }
   }
 
-  clear_do(_undo);
-  clear_do(_redo);
-  set_modified(false);
-  signal_can_undo.emit(false);
-  signal_can_redo.emit(false);
+  _text_view.get_buffer()->set_modified(false);
   return true;
 }
 
@@ -1530,11 +1908,41 @@ void Document::spell_checker_check(const Gtk::TextIter &iter)
 
   int s, e;
 
+  // The line is checked from scratch so forget what we knew about it.
+  spell_index.remove(start.get_offset(), end.get_offset());
+
   while (spell_checker_get_next(start, end, word, s, e)) {
     spell_checker_check_word(iter, word, s, e);
   }
 }
 
+void Document::spell_checker_flush()
+{
+  for (unsigned x = 0; x < lines.size(); x++) {
+    if (lines[x]) {
+      spell_checker_check(_text_view.get_buffer()->get_iter_at_line(x));
+      lines[x] = false;
+    }
+  }
+}
+
+void Document::spell_checker_forget(const std::string &word)
+{
+  std::vector<SpellIndex::Range> ranges;
+  for (SpellIndex::const_iterator iter = spell_index.begin(); iter != spell_index.end(); iter++) {
+    Gtk::TextIter s = _text_view.get_buffer()->get_iter_at_offset(iter->first);
+    Gtk::TextIter e = _text_view.get_buffer()->get_iter_at_offset(iter->second);
+    if (_text_view.get_buffer()->get_text(s, e, false) == word) {
+      ranges.push_back(*iter);
+      _text_view.get_buffer()->remove_tag(misspelled_tag, s, e);
+    }
+  }
+
+  for (unsigned x = 0; x < ranges.size(); x++) {
+    spell_index.remove(ranges[x].first, ranges[x].second);
+  }
+}
+
 bool Document::spell_dialog_helper_check(std::string &word)
 {
   return spell.check(word);
@@ -1549,6 +1957,7 @@ void Document::spell_dialog_helper_replace(std::string &old_word, std::string &n
   _text_view.get_buffer()->insert_at_cursor(new_word);
   _spell_end = _text_view.get_buffer()->end();
   _spell_start = _text_view.get_buffer()->get_iter_at_mark(_text_view.get_buffer()->get_insert());
+  _spell_pos = _spell_start.get_offset();
 }
 
 void Document::spell_dialog_helper_add_to_personal(std::string &old_word)
@@ -1557,6 +1966,7 @@ void Document::spell_dialog_helper_add_to_personal(std::string &old_word)
   Gtk::TextIter s, e;
   _text_view.get_buffer()->get_selection_bounds(s, e);
   _text_view.get_buffer()->remove_tag(misspelled_tag, s, e);
+  spell_checker_forget(old_word);
 }
 
 void Document::spell_dialog_helper_add_to_session(std::string &old_word)
@@ -1565,10 +1975,24 @@ void Document::spell_dialog_helper_add_to_session(std::string &old_word)
   Gtk::TextIter s, e;
   _text_view.get_buffer()->get_selection_bounds(s, e);
   _text_view.get_buffer()->remove_tag(misspelled_tag, s, e);
+  spell_checker_forget(old_word);
 }
 
 bool Document::spell_dialog_helper_has_misspelled(std::string &word)
 {
+  if (do_spell) {
+    // The index is complete, spell_dialog_mode() made sure of that.
+    if (!spell_index.next(_spell_pos, __spell_start, __spell_end)) {
+      return false;
+    }
+    Gtk::TextIter s = _text_view.get_buffer()->get_iter_at_offset(__spell_start);
+    Gtk::TextIter e = _text_view.get_buffer()->get_iter_at_offset(__spell_end);
+    word = _text_view.get_buffer()->get_text(s, e, false);
+    highlight(s, e);
+    _spell_pos = __spell_end;
+    return true;
+  }
+
   while (spell_checker_get_next(_spell_start, _spell_end, word, __spell_start, __spell_end)) {
     if (!spell_checker_check_word(_spell_start, word, __spell_start, __spell_end, false)) {
       return true;
@@ -1593,9 +2017,20 @@ void Document::spell_dialog_helper_get_suggestions(std::string &word,
   spell.suggest(word, suggestions);
 }
 
+int Document::spell_dialog_helper_misspelled_count()
+{
+  return do_spell ? spell_index.count() : -1;
+}
+
 void Document::spell_dialog_mode()
 {
   _text_view.get_buffer()->get_bounds(_spell_start, _spell_end);
+  _spell_pos = 0;
+
+  // Finish whatever the idle worker didn't get to so the index covers the whole buffer.
+  if (do_spell) {
+    spell_checker_flush();
+  }
 }
 
 bool Document::spell_checker_get_next(Gtk::TextIter &start,
@@ -1682,8 +2117,10 @@ bool Document::spell_checker_check_word(const Gtk::TextIter &iter,
   if (mark) {
     if (!st) {
       _text_view.get_buffer()->apply_tag(misspelled_tag, _s, _e);
+      spell_index.add(s, e);
     } else {
       _text_view.get_buffer()->remove_tag(misspelled_tag, _s, _e);
+      spell_index.remove(s, e);
     }
   } else {
     if (!st) {
@@ -1730,6 +2167,7 @@ void Document::set_auto_spell(bool st)
     Gtk::TextIter start = _text_view.get_buffer()->begin();
     Gtk::TextIter end = _text_view.get_buffer()->end();
     _text_view.get_buffer()->remove_tag(misspelled_tag, start, end);
+    spell_index.clear();
   }
   signal_auto_spell_set.emit(do_spell);
 }
@@ -1768,10 +2206,63 @@ bool Document::set_dictionary(std::string &dict, std::string &error)
     }
     spell_checker_connect_worker();
     spell_dict = dict;
+    if (has_file()) {
+      LangDetect::remember(_file, spell_dict);
+    }
     return true;
   }
   return false;
 }
+
+void Document::spell_detect_dictionary(const char *text, unsigned len)
+{
+  if (!_conf.get("spell_detect", true)) {
+    return;
+  }
+
+  std::string dict, error;
+
+  // We already know this one.
+  if ((has_file()) && (LangDetect::lookup(_file, dict))) {
+    if ((dict != spell_dict) && (set_dictionary(dict, error))) {
+      signal_dictionary_changed.emit(spell_dict);
+    }
+    return;
+  }
+
+  if (LangDetect::get_dictionary(LangDetect::detect(text, len), spell_dict, dict)) {
+    if (set_dictionary(dict, error)) {
+      signal_dictionary_changed.emit(spell_dict);
+      return;
+    }
+  }
+
+  if (has_file()) {
+    LangDetect::remember(_file, spell_dict);
+  }
+}
+
+bool Document::spell_detect_worker()
+{
+  Glib::RefPtr<Gtk::TextBuffer> buffer = _text_view.get_buffer();
+  Gtk::TextIter start = buffer->get_iter_at_offset(_spell_detect_offset);
+  Gtk::TextIter end = start;
+  end.forward_chars(LangDetect::sample_size);
+
+  std::string text = buffer->get_text(start, end, false);
+
+  if (_conf.get("spell_detect", true)) {
+    std::string dict, error;
+    if (LangDetect::get_dictionary(LangDetect::detect(text.c_str(), text.size()),
+                                   spell_dict,
+                                   dict) &&
+        set_dictionary(dict, error)) {
+      signal_dictionary_changed.emit(spell_dict);
+    }
+  }
+
+  return false;
+}
 #endif
 
 void Document::reset_gui()
@@ -1787,6 +2278,7 @@ void Document::reset_gui()
     Pango::FontDescription fd(font);
     _text_view.modify_font(fd);
   }
+  _gutter.reset();
 
   set_wrap_text(_conf.get("textwrap", true));
   do_undo = _conf.get("undo", true);
@@ -1868,6 +2360,11 @@ void Document::set_tab_width()
 
 void Document::autosave() const
 {
+  // Don't write the file from two threads.
+  if (_autosave_thread.joinable()) {
+    _autosave_thread.join();
+  }
+
   if (ftruncate(_tmp_file_fd, 0) == -1) {
     std::cerr << "Failed to truncate temp file: " << std::strerror(errno) << std::endl;
     return;
@@ -1877,9 +2374,45 @@ void Document::autosave() const
     std::cerr << "Failed to seek in temp file: " << std::strerror(errno) << std::endl;
   }
 
-  if (write(_tmp_file_fd,
-            _text_view.get_buffer()->get_text().c_str(),
-            _text_view.get_buffer()->get_text().size()) == -1) {
+  if (!write_segments(_tmp_file_fd)) {
     std::cerr << "Failed to write to temp file: " << std::strerror(errno) << std::endl;
   }
 }
+
+/**
+ * \brief autosave without blocking the main loop.
+ *
+ * The text is written from a snapshot on another thread. Nothing is done if the last one is
+ * still being written.
+ */
+void Document::autosave_in_background()
+{
+  if (_autosave_busy) {
+    return;
+  }
+
+  if (_autosave_thread.joinable()) {
+    _autosave_thread.join();
+  }
+
+  _autosave_busy = true;
+  _autosave_thread = std::thread(&Document::autosave_worker, this, snapshot());
+}
+
+void Document::autosave_worker(std::shared_ptr<const TextSnapshot> snapshot) const
+{
+  if (ftruncate(_tmp_file_fd, 0) == -1) {
+    std::cerr << "Failed to truncate temp file: " << std::strerror(errno) << std::endl;
+  } else if (lseek(_tmp_file_fd, 0, SEEK_SET) != 0) {
+    std::cerr << "Failed to seek in temp file: " << std::strerror(errno) << std::endl;
+  } else {
+    for (const TextSnapshot::Chunk &chunk: snapshot->chunks()) {
+      if (!Utils::write_all(_tmp_file_fd, chunk->data(), chunk->size())) {
+        std::cerr << "Failed to write to temp file: " << std::strerror(errno) << std::endl;
+        break;
+      }
+    }
+  }
+
+  _autosave_busy = false;
+}
@@ -21,16 +21,23 @@
 
 #pragma once
 
+#include "codec.hh"
 #include "conf.hh"
 #include "encodings.hh"
+#include "gutter.hh"
 #include "label.hh"
+#include "textsnapshot.hh"
 #include "undoredo.hh"
+#include "updatebus.hh"
+#include <atomic>
 #include <gtkmm.h>
 #include <map>
 #include <string>
+#include <thread>
 
 #ifdef ENABLE_SPELL
 #include "spell.hh"
+#include "spellindex.hh"
 #endif
 
 #ifdef ENABLE_HIGHLIGHT
@@ -43,6 +50,7 @@ class Document: public Gtk::ScrolledWindow {
  public:
   Document(Conf &, Encodings &, int);
   Document(Conf &, Encodings &, int, std::string &);
+  Document(Conf &, Encodings &, int, std::string &, Codec::Format, std::string &);
   Document(Conf &, Encodings &, int, int);
   ~Document();
 
@@ -65,6 +73,7 @@ class Document: public Gtk::ScrolledWindow {
   int get_line_count();
 
   void autosave() const;
+  void autosave_in_background();
 
   bool is_readonly() const
   {
@@ -117,10 +126,17 @@ class Document: public Gtk::ScrolledWindow {
     return _file;
   }
 
-  void scroll_to(int);
+  // Line and column are 1-based, a column of 0 means the start of the line.
+  void scroll_to(int, int = 0);
 
   void get_lines(std::vector<std::string> &, int = -1, int = -1);
   void get_lines(std::vector<Glib::ustring> &, int = -1, int = -1);
+
+  // The text, its length in bytes, the line it starts at and its offset in characters.
+  typedef sigc::slot<bool, const char *, std::size_t, int, int> SegmentSlot;
+  bool foreach_segment(const SegmentSlot &, int = -1, int = -1) const;
+
+  std::shared_ptr<const TextSnapshot> snapshot();
   void get_selection(std::vector<std::string> &);
 
   void select_all();
@@ -131,6 +147,7 @@ class Document: public Gtk::ScrolledWindow {
   void emit_signals();
 
   void insert(const std::string &);
+  void append(const std::string &);
 
   void grab_focus();
   bool has_focus();
@@ -232,6 +249,7 @@ class Document: public Gtk::ScrolledWindow {
   // Interaction with the spell dialog.
   void spell_dialog_mode();
   bool spell_dialog_helper_has_misspelled(std::string &word);
+  int spell_dialog_helper_misspelled_count();
   void spell_dialog_helper_get_suggestions(std::string &, std::vector<std::string> &);
   void spell_dialog_helper_add_to_personal(std::string &);
   void spell_dialog_helper_add_to_session(std::string &);
@@ -256,9 +274,14 @@ class Document: public Gtk::ScrolledWindow {
   {
     return _text_view.get_buffer()->get_text();
   }
-  void set_text(std::string &);
+  std::string get_selected_text();
+
+  // Replaces everything in one go. The undo history is cleared unless undoable is true, then the
+  // replacement becomes a single undo step.
+  void set_text(const std::string &, bool undoable = false);
 
  private:
+  void replace_text(const std::string &);
   Label _label;
 
   friend void _on_move_cursor(GtkTextView *, GtkMovementStep, gint, gboolean, gpointer);
@@ -271,6 +294,7 @@ class Document: public Gtk::ScrolledWindow {
 #else
   TextView _text_view;
 #endif
+  Gutter _gutter;
   Gtk::TextWindowType numbers_right;
 #ifndef ENABLE_HIGHLIGHT
   Gtk::TextWindowType numbers_left;
@@ -278,10 +302,14 @@ class Document: public Gtk::ScrolledWindow {
 
   void get_lines(Gtk::TextIter &, Gtk::TextIter &, std::vector<std::string> &);
   void get_lines(Gtk::TextIter &, Gtk::TextIter &, std::vector<Glib::ustring> &);
+  bool foreach_segment(Gtk::TextIter, const Gtk::TextIter &, const SegmentSlot &) const;
+  bool write_segments(int) const;
   void set_readonly(bool);
   void set_modified(bool);
   void create_ui();
   bool create(const std::string & = "");
+  void load(std::string &, std::string &, int);
+  bool write_file(std::string &, std::string &, Codec::Format, std::string &);
   void set_file(std::string &);
 
   void set_tab_width();
@@ -297,6 +325,7 @@ class Document: public Gtk::ScrolledWindow {
   int _encoding;
   bool _readonly;
   bool _line_numbers;
+  Codec::Format _compression;
 
   /* Undo/Redo */
   bool can_undo()
@@ -309,6 +338,7 @@ class Document: public Gtk::ScrolledWindow {
   }
 
   void undo(KatoobDoType, const std::string &, int);
+  void undo_push(KatoobDoElem *);
   void redo(KatoobDoElem *);
   void undo(KatoobDoElem *);
 
@@ -317,6 +347,18 @@ class Document: public Gtk::ScrolledWindow {
   void connect_signals();
 
   int calculate_column(Gtk::TextIter &);
+  void column_cache_on_insert(const Gtk::TextIter &, const Gtk::TextIter &, const Glib::ustring &);
+  void column_cache_on_erase(const Gtk::TextIter &, int, const std::string &);
+
+  // The last column we calculated. Typing walks from here instead of from the line start.
+  int _column_line, _column_offset, _column;
+
+  UpdateBus _updates;
+
+  // Follows the buffer once the first snapshot was taken.
+  TextChunks _chunks;
+  void dispatch_updates(int);
+  void emit_cursor();
 
   void block_do();
   void unblock_do();
@@ -333,19 +375,26 @@ class Document: public Gtk::ScrolledWindow {
   void highlight(Gtk::TextIter &, Gtk::TextIter &);
 
   bool expose_event_cb(GdkEventExpose *);
-  void paint_line_numbers(Glib::RefPtr<Gdk::Window> &, GdkEventExpose *);
   //  void get_line_bounds(const Gtk::TextIter&, Gtk::TextIter&, Gtk::TextIter&);
 #ifdef ENABLE_SPELL
   Spell spell;
   bool do_spell;
   std::vector<bool> lines;
+  SpellIndex spell_index;
+  sigc::connection spell_detect_conn;
+  int _spell_detect_offset;
   sigc::connection spell_worker_conn;
   Gtk::TextIter _spell_start, _spell_end;
   int __spell_start, __spell_end;
+  int _spell_pos;
   Glib::RefPtr<Gtk::TextMark> _spell_mark;
   bool spell_checker_worker();
   bool spell_checker_has_lines();
   void spell_checker_get_line(Gtk::TextIter &);
+  void spell_checker_flush();
+  void spell_detect_dictionary(const char *, unsigned);
+  bool spell_detect_worker();
+  void spell_checker_forget(const std::string &);
   void spell_checker_check(const Gtk::TextIter &);
   bool
   spell_checker_check_word(const Gtk::TextIter &, std::string &, int &, int &, bool mark = true);
@@ -384,6 +433,11 @@ class Document: public Gtk::ScrolledWindow {
 
   bool _overwrite;
 
+  // The periodic autosave writes a snapshot from this thread.
+  void autosave_worker(std::shared_ptr<const TextSnapshot>) const;
+  mutable std::thread _autosave_thread;
+  std::atomic<bool> _autosave_busy;
+
   /* Signal handlers */
   void on_insert(const Gtk::TextBuffer::iterator &, const Glib::ustring &, int);
   void on_erase(const Gtk::TextBuffer::iterator &, const Gtk::TextBuffer::iterator &);
@@ -27,11 +27,16 @@
 #include <cassert>
 #include <fstream>
 #include <glibmm.h>
-#include <iostream>
 #include <memory>
 
-Emulator::Emulator()
+// The layouts are only read the first time somebody asks for them.
+void Emulator::load()
 {
+  if (_loaded) {
+    return;
+  }
+  _loaded = true;
+
   std::unique_ptr<Glib::Dir> d;
 
   try {
@@ -51,7 +56,6 @@ Emulator::Emulator()
   while (start != end) {
     std::map<std::string, std::string> map;
     std::string file = Glib::build_filename(EMULATOR_DIR, *start);
-    std::cout << "Found emulator file: " << file << std::endl;
     if (parse_file(file, map)) {
 #ifdef GLIBMM_EXCEPTIONS_ENABLED
       try {
@@ -74,23 +78,17 @@ Emulator::Emulator()
     }
     start++;
   }
-
-  if (!_ok) {
-    std::cout << "Emulator will not work" << std::endl;
-  }
-}
-
-Emulator::~Emulator()
-{
 }
 
 std::vector<std::string> &Emulator::list_layouts()
 {
+  load();
   return names;
 }
 
 bool Emulator::ok(std::string &e)
 {
+  load();
   e = _err;
   return _ok;
 }
@@ -146,6 +144,7 @@ std::map<std::string, std::string> &Emulator::get_layout()
 
 std::vector<std::string> Emulator::names;
 std::vector<std::map<std::string, std::string> > Emulator::layouts;
+bool Emulator::_loaded = false;
 bool Emulator::_ok = false;
 int Emulator::layout = -1;
 std::string Emulator::_err;
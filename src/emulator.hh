@@ -27,8 +27,6 @@
 
 class Emulator {
  public:
-  Emulator();
-  ~Emulator();
   static bool ok(std::string &);
   static std::vector<std::string> &list_layouts();
   static bool get(const std::string &, std::string &);
@@ -39,8 +37,11 @@ class Emulator {
   static std::map<std::string, std::string> &get_layout();
 
  private:
+  static void load();
+
   static std::vector<std::string> names;
   static std::vector<std::map<std::string, std::string> > layouts;
+  static bool _loaded;
   static bool _ok;
   static std::string _err;
   static int layout;
@@ -21,30 +21,33 @@
 
 #include <config.h>
 
+#include "codec.hh"
 #include "export.hh"
+#include "html.hh"
 #include "macros.h"
 #include "utils.hh"
-
-#ifdef HAVE_GZIP
-#include "tempfile.hh"
-#include <zlib.h>
-#endif
-
-#ifdef HAVE_BZIP2
-#include <bzlib.h>
-#endif
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <pango/pango.h>
+#include <thread>
 
 #ifdef HAVE_FRIBIDI
-#include "shape_arabic.h"
-#include <fribidi/fribidi.h>
+#include "ucs4string.hh"
 #endif
 
-// TODO: Export HTML character references.
+// Line exports collect that many bytes of the text, then process them in parallel.
+#define ROUND_SIZE 16777216
 
 void export_init(std::vector<Export> &exprt)
 {
   Export exp;
 
+  exp.name = _("_HTML Character Reference...");
+  exp.func = katoob_export_html;
+  exp.lines = false;
+  exprt.push_back(exp);
+
 #ifdef HAVE_FRIBIDI
   exp.name = _("_Text file with no unicode control characters...");
   exp.func = katoob_export_plain;
@@ -66,6 +69,20 @@ void export_init(std::vector<Export> &exprt)
   exprt.push_back(exp);
 #endif
 
+#ifdef HAVE_XZ
+  exp.name = _("Text file compressed with _xz");
+  exp.func = katoob_export_xz;
+  exp.lines = false;
+  exprt.push_back(exp);
+#endif
+
+#ifdef HAVE_ZSTD
+  exp.name = _("Text file compressed with _zstd");
+  exp.func = katoob_export_zstd;
+  exp.lines = false;
+  exprt.push_back(exp);
+#endif
+
 #ifdef HAVE_FRIBIDI
   exp.name = _("Text with _shaping and bidi applied");
   exp.func = katoob_export_bidi_shape;
@@ -74,85 +91,207 @@ void export_init(std::vector<Export> &exprt)
 #endif
 }
 
-#ifdef HAVE_FRIBIDI
-bool katoob_export_plain(Glib::ustring &text, std::string &out, std::string &error)
+/**
+ * \brief run a line export on one batch after another until none are left.
+ *
+ * A batch holds whole lines, the delimiters are replaced with a new line.
+ */
+static void export_batches(const Export &ex,
+                           const std::vector<std::string> &batches,
+                           std::vector<std::string> &outs,
+                           std::vector<char> &failed,
+                           std::vector<std::string> &errors,
+                           std::atomic<std::size_t> &next)
 {
-  gunichar *ch = new gunichar[text.size() + 1];
-  for (unsigned i = 0; i < text.size(); i++) {
-    ch[i] = text[i];
+  Glib::ustring line;
+  std::string tout;
+
+  while (true) {
+    std::size_t x = next++;
+    if (x >= batches.size()) {
+      return;
+    }
+
+    const char *text = batches[x].data();
+    const char *end = text + batches[x].size();
+    while (text < end) {
+      gint delim, next_line;
+      pango_find_paragraph_boundary(text, end - text, &delim, &next_line);
+      line.assign(text, text + delim);
+      text += next_line;
+
+      if (!ex.func(line, tout, errors[x])) {
+        failed[x] = true;
+        return;
+      }
+      outs[x] += tout;
+      // TODO: We need to check whether the document has a \n at the end or not.
+      outs[x] += '\n';
+    }
   }
-  ch[text.size()] = 0x0;
+}
 
-  unsigned int len = fribidi_remove_bidi_marks(ch, text.size(), NULL, NULL, NULL);
+LineExporter::LineExporter(const Export &ex, std::string &out):
+ _ex(ex),
+ _out(out),
+ bytes(0),
+ failed(false),
+ open(true)
+{
+}
 
-  Glib::ustring _out;
-  for (unsigned i = 0; i < len; i++) {
-    _out += ch[i];
+/**
+ * \brief take the next segment of the text, see Document::foreach_segment().
+ * \return false if the export failed.
+ */
+bool LineExporter::add(const char *text, std::size_t len, int, int)
+{
+  if (len == 0) {
+    return true;
   }
-  out = _out;
 
-  delete[] ch;
+  batches.push_back(std::string(text, len));
+  bytes += len;
+
+  // A segment ends after a delimiter unless it's the last one.
+  char last = text[len - 1];
+  open = (last == '\n' || last == '\r' || (len >= 3 && !memcmp(text + len - 3, "\xe2\x80\xa9", 3)));
+
+  if (bytes >= ROUND_SIZE) {
+    return flush();
+  }
 
   return true;
 }
-#endif
 
-#ifdef HAVE_GZIP
-bool katoob_export_gz(Glib::ustring &text, std::string &out, std::string &error)
+/**
+ * \brief export what's left.
+ * \param error contains the error, if any.
+ * \return true on success.
+ */
+bool LineExporter::finish(std::string &error)
 {
-  TempFile tf;
-  if (!tf.ok(error)) {
-    return false;
+  if (!failed && flush() && open) {
+    // The empty line after the last delimiter.
+    Glib::ustring line;
+    std::string tout;
+    if (_ex.func(line, tout, _error)) {
+      _out += tout;
+      _out += '\n';
+    } else {
+      failed = true;
+    }
   }
 
-  gzFile zfile = gzopen(tf.get_name().c_str(), "wb");
-  if (zfile == NULL) {
-    error = _("Can't open temporary file.");
-    return false;
+  error = _error;
+  return !failed;
+}
+
+/**
+ * \brief export the batches we have.
+ *
+ * The lines are independent of each other so the batches are processed in parallel, one thread
+ * per core. The results are put together in order.
+ */
+bool LineExporter::flush()
+{
+  const std::size_t n = batches.size();
+  const unsigned jobs = std::min<std::size_t>(std::thread::hardware_concurrency(), n);
+
+  std::vector<std::string> outs(n), errors(n);
+  // Not a vector<bool>, the threads write to it.
+  std::vector<char> failures(n, false);
+  std::atomic<std::size_t> next(0);
+
+  if (jobs < 2) {
+    export_batches(_ex, batches, outs, failures, errors, next);
+  } else {
+    std::vector<std::thread> threads;
+    for (unsigned x = 0; x < jobs; x++) {
+      threads.push_back(std::thread(export_batches,
+                                    std::cref(_ex),
+                                    std::cref(batches),
+                                    std::ref(outs),
+                                    std::ref(failures),
+                                    std::ref(errors),
+                                    std::ref(next)));
+    }
+
+    for (std::thread &thread: threads) {
+      thread.join();
+    }
   }
 
-  int state = gzwrite(zfile, text.c_str(), text.bytes());
-  if (state == 0) {
-    error = _("Error writing to temporary file.");
-    gzclose(zfile);
-    return false;
+  batches.clear();
+  bytes = 0;
+
+  std::size_t size = _out.size();
+  for (std::size_t x = 0; x < n; x++) {
+    if (failures[x]) {
+      _error = errors[x];
+      failed = true;
+      return false;
+    }
+    size += outs[x].size();
+  }
+
+  _out.reserve(size);
+  for (std::size_t x = 0; x < n; x++) {
+    _out += outs[x];
+    std::string().swap(outs[x]);
   }
-  gzclose(zfile);
-  return tf.read(out, error);
+
+  return true;
+}
+
+bool katoob_export_html(Glib::ustring &text, std::string &out, std::string &error)
+{
+  out.clear();
+  out.reserve(text.bytes());
+  HtmlEncoder::encode(text.data(), text.bytes(), out);
+  return true;
+}
+
+#ifdef HAVE_FRIBIDI
+bool katoob_export_plain(Glib::ustring &text, std::string &out, std::string &error)
+{
+  static thread_local Ucs4String ch;
+
+  ch.assign(text.data(), text.bytes());
+  ch.remove_bidi_marks();
+
+  out.clear();
+  ch.append_to(out);
+
+  return true;
+}
+#endif
+
+#ifdef HAVE_GZIP
+bool katoob_export_gz(Glib::ustring &text, std::string &out, std::string &error)
+{
+  return Codec::encode(Codec::GZIP, -1, text.data(), text.bytes(), out, error);
 }
 #endif
 
 #ifdef HAVE_BZIP2
 bool katoob_export_bz2(Glib::ustring &text, std::string &out, std::string &error)
 {
-  unsigned dest_len;
-
-  // From the php bzip2 extension.
-  dest_len = (unsigned) (text.bytes() + (0.01 * text.bytes()) + 600);
-  char *dest = (char *) malloc(dest_len + 1);
-  if (!dest) {
-    error = _("Couldn't allocate memory for compression.");
-    return false;
-  }
+  return Codec::encode(Codec::BZIP2, -1, text.data(), text.bytes(), out, error);
+}
+#endif
 
-  int er = BZ2_bzBuffToBuffCompress(dest,
-                                    &dest_len,
-                                    const_cast<char *>(text.c_str()),
-                                    text.bytes(),
-                                    4,
-                                    0,
-                                    0);
-  if (er != BZ_OK) {
-    error = _("Couldn't compress the text.");
-    free(dest);
-    return false;
-  }
-  for (unsigned x = 0; x < dest_len; x++) {
-    out += dest[x];
-  }
+#ifdef HAVE_XZ
+bool katoob_export_xz(Glib::ustring &text, std::string &out, std::string &error)
+{
+  return Codec::encode(Codec::XZ, -1, text.data(), text.bytes(), out, error);
+}
+#endif
 
-  free(dest);
-  return true;
+#ifdef HAVE_ZSTD
+bool katoob_export_zstd(Glib::ustring &text, std::string &out, std::string &error)
+{
+  return Codec::encode(Codec::ZSTD, -1, text.data(), text.bytes(), out, error);
 }
 #endif
 
@@ -167,44 +306,23 @@ bool katoob_export_bidi_shape(Glib::ustring &text, std::string &out, std::string
   // considered final although it's initial
   // So we shape first then we apply the bidi.
 
-  Glib::ustring no_lam_alef;
-  if (!Utils::is_lam_alef(text, no_lam_alef)) {
-    no_lam_alef = text;
-  }
+  // This runs for every line so we keep the buffers around.
+  static thread_local Ucs4String ch, no_lam_alef, shaped, visual;
 
-  gunichar *ch = new gunichar[no_lam_alef.size() + 1], *_ch;
-
-  for (unsigned i = 0; i < no_lam_alef.size(); i++) {
-    ch[i] = no_lam_alef[i];
-  }
-  ch[no_lam_alef.size()] = 0x0;
+  ch.assign(text.data(), text.bytes());
+  ch.split_lam_alef(no_lam_alef);
 
   // Now shaping.
-  unsigned new_len;
-  _ch = shape_arabic(ch, no_lam_alef.size(), &new_len);
-
-  delete[] ch;
-
-  ch = new gunichar[new_len + 1];
-
-  FriBidiCharType base = FRIBIDI_TYPE_RTL;
+  no_lam_alef.shape(shaped);
 
   // then bidi.
-  if (!fribidi_log2vis(_ch, new_len, &base, ch, NULL, NULL, NULL)) {
-    delete[] ch;
-    g_free(_ch);   // _ch is allocated via g_new();
+  if (!shaped.log2vis(visual)) {
     error = _("Couldn't apply the bidi algorithm.");
     return false;
   }
-  g_free(_ch);
-
-  Glib::ustring _out;
-  for (unsigned i = 0; i < new_len; i++) {
-    _out += ch[i];
-  }
-  out = _out;
 
-  delete[] ch;
+  out.clear();
+  visual.append_to(out);
 
   return true;
 }
@@ -30,11 +30,39 @@
 class Export {
  public:
   std::string name;
+  // Line exports get called from several threads at once.
   bool (*func)(Glib::ustring &, std::string &, std::string &);
   bool lines;
 };
 
 void export_init(std::vector<Export> &);
+
+/**
+ * \brief Run a line export over a text that comes a few lines at a time.
+ *
+ * The text is given with Document::foreach_segment() so the document is never copied as a
+ * whole. Every line is passed to the export and the results are joined with new lines.
+ */
+class LineExporter {
+ public:
+  LineExporter(const Export &, std::string &);
+
+  bool add(const char *, std::size_t, int, int);
+  bool finish(std::string &);
+
+ private:
+  bool flush();
+
+  const Export &_ex;
+  std::string &_out;
+  std::vector<std::string> batches;
+  std::size_t bytes;
+  bool failed;
+  std::string _error;
+  // The text so far is empty or ends with a delimiter.
+  bool open;
+};
+bool katoob_export_html(Glib::ustring &, std::string &, std::string &);
 #ifdef HAVE_FRIBIDI
 bool katoob_export_plain(Glib::ustring &, std::string &, std::string &);
 #endif
@@ -44,6 +72,12 @@ bool katoob_export_gz(Glib::ustring &, std::string &, std::string &);
 #ifdef HAVE_BZIP2
 bool katoob_export_bz2(Glib::ustring &, std::string &, std::string &);
 #endif
+#ifdef HAVE_XZ
+bool katoob_export_xz(Glib::ustring &, std::string &, std::string &);
+#endif
+#ifdef HAVE_ZSTD
+bool katoob_export_zstd(Glib::ustring &, std::string &, std::string &);
+#endif
 #ifdef HAVE_FRIBIDI
 bool katoob_export_bidi_shape(Glib::ustring &, std::string &, std::string &);
 #endif
@@ -0,0 +1,171 @@
+/*
+ * gutter.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "gutter.hh"
+#include <algorithm>
+
+Gutter::Gutter(Gtk::TextView &view): _view(view), _digit_width(0), _current(-1) {}
+
+/**
+ * \brief forget the cached layouts and sizes.
+ *
+ * Call this when the font changes or when the border windows are resized by someone else.
+ */
+void Gutter::reset()
+{
+  for (int x = 0; x < 10; x++) {
+    _digits[x].clear();
+    _bold[x].clear();
+  }
+  _digit_width = 0;
+  _widths.clear();
+}
+
+void Gutter::create_layouts()
+{
+  char digit[] = "0";
+  char bold[] = "<b>0</b>";
+  int width, height;
+
+  for (int x = 0; x < 10; x++) {
+    digit[0] = bold[3] = '0' + x;
+
+    _digits[x] = _view.create_pango_layout(digit);
+    _digits[x]->get_pixel_size(width, height);
+    _digit_width = std::max(_digit_width, width);
+
+    _bold[x] = _view.create_pango_layout("");
+    _bold[x]->set_markup(bold);
+    _bold[x]->get_pixel_size(width, height);
+    _digit_width = std::max(_digit_width, width);
+  }
+}
+
+/**
+ * \brief track the line the cursor is on.
+ *
+ * The current line is painted in bold so we repaint the old and the new lines when it changes.
+ */
+void Gutter::set_current_line(int line)
+{
+  if (line == _current) {
+    return;
+  }
+
+  invalidate_line(_current);
+  _current = line;
+  invalidate_line(_current);
+}
+
+void Gutter::invalidate_line(int line)
+{
+  if ((line < 0) || (line >= _view.get_buffer()->get_line_count())) {
+    return;
+  }
+
+  int y, height, x, wy;
+  _view.get_line_yrange(_view.get_buffer()->get_iter_at_line(line), y, height);
+
+  for (std::map<Gtk::TextWindowType, int>::iterator iter = _widths.begin(); iter != _widths.end();
+       iter++) {
+    Glib::RefPtr<Gdk::Window> win = _view.get_window(iter->first);
+    if (win) {
+      _view.buffer_to_window_coords(iter->first, 0, y, x, wy);
+      win->invalidate_rect(Gdk::Rectangle(0, wy, iter->second * _digit_width + 4, height), false);
+    }
+  }
+}
+
+/**
+ * \brief paint the line numbers inside the exposed area of a border window.
+ */
+void Gutter::paint(Glib::RefPtr<Gdk::Window> &win, GdkEventExpose *event)
+{
+  if (_digit_width == 0) {
+    create_layouts();
+  }
+
+  Glib::RefPtr<Gtk::TextBuffer> buffer = _view.get_buffer();
+  Gtk::TextWindowType type = _view.get_window_type(win);
+
+  int digits = 1;
+  for (int lines = buffer->get_line_count(); lines >= 10; lines /= 10) {
+    ++digits;
+  }
+
+  // Resizing can trigger a relayout so we only do it when the width really changes.
+  std::map<Gtk::TextWindowType, int>::iterator width = _widths.find(type);
+  if ((width == _widths.end()) || (width->second != digits)) {
+    _widths[type] = digits;
+    _view.set_border_window_size(type, digits * _digit_width + 4);
+  }
+
+  GdkRectangle &area = event->area;
+  win->clear_area(area.x, area.y, area.width, area.height);
+
+  _current = buffer->get_iter_at_mark(buffer->get_insert()).get_line();
+
+  int x, top, bottom;
+  _view.window_to_buffer_coords(type, 0, area.y, x, top);
+  _view.window_to_buffer_coords(type, 0, area.y + area.height, x, bottom);
+
+  GtkWidget *widget = GTK_WIDGET(_view.gobj());
+  Gtk::TextIter iter;
+  int y, height;
+  _view.get_line_at_y(iter, top, y);
+
+  // Big enough for any int.
+  char number[16];
+
+  while (true) {
+    _view.get_line_yrange(iter, y, height);
+    if (y > bottom) {
+      break;
+    }
+
+    int wy;
+    _view.buffer_to_window_coords(type, 0, y, x, wy);
+
+    int len = 0;
+    for (int n = iter.get_line() + 1; n > 0; n /= 10) {
+      number[len++] = '0' + n % 10;
+    }
+
+    Glib::RefPtr<Pango::Layout> *layouts = iter.get_line() == _current ? _bold : _digits;
+    for (int d = 0; d < len; d++) {
+      gtk_paint_layout(widget->style,
+                       win->gobj(),
+                       (GtkStateType) GTK_WIDGET_STATE(widget),
+                       FALSE,
+                       &area,
+                       widget,
+                       NULL,
+                       2 + d * _digit_width,
+                       wy,
+                       layouts[number[len - d - 1] - '0']->gobj());
+    }
+
+    if (!iter.forward_line()) {
+      break;
+    }
+  }
+}
@@ -0,0 +1,54 @@
+/*
+ * gutter.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include <gtkmm.h>
+#include <map>
+
+/**
+ * \brief Paints line numbers in the border windows of a Gtk::TextView.
+ *
+ * Numbers are drawn from one cached layout per digit instead of laying out every number on
+ * every expose. The border window is only resized when the number of digits of the line count
+ * changes and only the lines inside the exposed area are painted.
+ */
+class Gutter {
+ public:
+  Gutter(Gtk::TextView &);
+
+  void reset();
+  void paint(Glib::RefPtr<Gdk::Window> &, GdkEventExpose *);
+  void set_current_line(int);
+
+ private:
+  void create_layouts();
+  void invalidate_line(int);
+
+  Gtk::TextView &_view;
+
+  /** \brief one layout per digit for normal lines and for the current line. */
+  Glib::RefPtr<Pango::Layout> _digits[10], _bold[10];
+  int _digit_width;
+  int _current;
+
+  /** \brief the number of digits each border window is sized for. */
+  std::map<Gtk::TextWindowType, int> _widths;
+};
@@ -0,0 +1,290 @@
+/*
+ * html.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "html.hh"
+#include "htmlentities.hh"
+#include <algorithm>
+#include <cstring>
+
+// What HTML5 makes of the C1 control characters in numeric references, as windows-1252.
+/* clang-format off */
+static const gunichar c1_table[32] = {
+  0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+  0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+  0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+  0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+};
+/* clang-format on */
+
+enum {
+  DIGIT = 1,
+  HEX = 2,
+  ALNUM = 4,
+};
+
+class CharClasses {
+ public:
+  CharClasses()
+  {
+    memset(table, 0, sizeof(table));
+    for (int c = '0'; c <= '9'; c++) {
+      table[c] = DIGIT | HEX | ALNUM;
+    }
+    for (int c = 'a'; c <= 'z'; c++) {
+      table[c] = ALNUM;
+      table[c - 'a' + 'A'] = ALNUM;
+    }
+    for (int c = 'a'; c <= 'f'; c++) {
+      table[c] |= HEX;
+      table[c - 'a' + 'A'] |= HEX;
+    }
+  }
+
+  bool is(char c, int what) const
+  {
+    return table[static_cast<unsigned char>(c)] & what;
+  }
+
+ private:
+  unsigned char table[256];
+};
+
+static const CharClasses classes;
+
+// The reference goes on after the end of the data we have.
+#define NEED_MORE static_cast<std::size_t>(-1)
+
+static inline void append_unichar(std::string &out, gunichar ch)
+{
+  char buf[6];
+  out.append(buf, g_unichar_to_utf8(ch, buf));
+}
+
+HtmlDecoder::HtmlDecoder()
+{
+}
+
+/**
+ * \brief decode a chunk.
+ * \param data the chunk.
+ * \param len the length of data.
+ * \param out the decoded text is appended to it.
+ */
+void HtmlDecoder::decode(const char *data, std::size_t len, std::string &out)
+{
+  if (pending.size() > 0) {
+    // Most references are complete with a few more bytes so we don't copy the whole chunk.
+    std::size_t n = std::min<std::size_t>(len, HTML_ENTITY_MAX_NAME + 2);
+    std::string buf;
+    buf.swap(pending);
+    buf.append(data, n);
+    if (process(buf.data(), buf.size(), false, out) < buf.size() && n < len) {
+      // A reference started in there and goes on, it's in pending now.
+      buf.clear();
+      buf.swap(pending);
+      buf.append(data + n, len - n);
+      process(buf.data(), buf.size(), false, out);
+      return;
+    }
+    data += n;
+    len -= n;
+  }
+
+  process(data, len, false, out);
+}
+
+/**
+ * \brief decode whatever is left at the end of the input.
+ * \param out the decoded text is appended to it.
+ */
+void HtmlDecoder::finish(std::string &out)
+{
+  process(pending.data(), pending.size(), true, out);
+  pending.clear();
+}
+
+/**
+ * \brief decode as much of data as possible.
+ *
+ * An incomplete reference at the end is kept in pending unless we're at the end of the input.
+ *
+ * \return how much of data was decoded, the rest is in pending.
+ */
+std::size_t HtmlDecoder::process(const char *data, std::size_t len, bool last, std::string &out)
+{
+  const char *p = data;
+  const char *end = data + len;
+
+  while (p < end) {
+    const char *amp = static_cast<const char *>(memchr(p, '&', end - p));
+    if (!amp) {
+      out.append(p, end - p);
+      break;
+    }
+
+    out.append(p, amp - p);
+
+    std::size_t n = reference(amp, end, last, out);
+    if (n == NEED_MORE) {
+      pending.assign(amp, end - amp);
+      return amp - data;
+    }
+
+    if (n == 0) {
+      out += '&';
+      n = 1;
+    }
+    p = amp + n;
+  }
+
+  return len;
+}
+
+/**
+ * \brief decode the reference at p.
+ * \return how many bytes it takes, 0 if it's not a reference or NEED_MORE.
+ */
+std::size_t HtmlDecoder::reference(const char *p, const char *end, bool last, std::string &out)
+{
+  if (p + 1 == end) {
+    return last ? 0 : NEED_MORE;
+  }
+
+  if (p[1] == '#') {
+    return numeric(p, end, last, out);
+  }
+
+  return named(p, end, last, out);
+}
+
+std::size_t HtmlDecoder::numeric(const char *p, const char *end, bool last, std::string &out)
+{
+  const char *q = p + 2;
+  if (q == end) {
+    return last ? 0 : NEED_MORE;
+  }
+
+  bool hex = (*q == 'x' || *q == 'X');
+  if (hex && ++q == end) {
+    return last ? 0 : NEED_MORE;
+  }
+
+  const int what = hex ? HEX : DIGIT;
+  const char *digits = q;
+  guint32 ch = 0;
+  while (q < end && classes.is(*q, what)) {
+    if (ch < 0x110000) {
+      if (hex) {
+        ch = ch * 16 + g_ascii_xdigit_value(*q);
+      } else {
+        ch = ch * 10 + (*q - '0');
+      }
+    }
+    ++q;
+  }
+
+  if (q == end && !last) {
+    return NEED_MORE;
+  }
+
+  if (q == digits) {
+    return 0;
+  }
+
+  if (q < end && *q == ';') {
+    ++q;
+  }
+
+  if (ch == 0 || ch >= 0x110000 || (ch >= 0xD800 && ch <= 0xDFFF)) {
+    ch = 0xFFFD;
+  } else if (ch >= 0x80 && ch <= 0x9F) {
+    ch = c1_table[ch - 0x80];
+  }
+
+  append_unichar(out, ch);
+
+  return q - p;
+}
+
+std::size_t HtmlDecoder::named(const char *p, const char *end, bool last, std::string &out)
+{
+  const char *name = p + 1;
+  const char *q = name;
+  while (q < end && q - name < HTML_ENTITY_MAX_NAME && classes.is(*q, ALNUM)) {
+    ++q;
+  }
+
+  if (q == end && !last && q - name < HTML_ENTITY_MAX_NAME) {
+    return NEED_MORE;
+  }
+
+  const HtmlEntity *entity = NULL;
+  if (q < end && *q == ';') {
+    entity = html_entity_find(name, q - name + 1);
+  }
+
+  // The legacy names without a semicolon, the longest one wins.
+  for (std::size_t n = std::min<std::size_t>(q - name, HTML_ENTITY_MAX_LEGACY); !entity && n > 0;
+       n--) {
+    entity = html_entity_find(name, n);
+  }
+
+  if (!entity) {
+    return 0;
+  }
+
+  append_unichar(out, entity->value[0]);
+  if (entity->value[1]) {
+    append_unichar(out, entity->value[1]);
+  }
+
+  return entity->len + 1;
+}
+
+/**
+ * \brief encode text.
+ * \param data UTF-8 text, it must be valid.
+ * \param len the length of data in bytes.
+ * \param out the encoded text is appended to it.
+ */
+void HtmlEncoder::encode(const char *data, std::size_t len, std::string &out)
+{
+  const char *p = data;
+  const char *end = data + len;
+
+  while (p < end) {
+    // Copy the ASCII in one go.
+    const char *q = p;
+    while (q < end && !(*q & 0x80)) {
+      ++q;
+    }
+    out.append(p, q - p);
+    if (q == end) {
+      break;
+    }
+
+    char buf[16];
+    int n = g_snprintf(buf, sizeof(buf), "&#%u;", g_utf8_get_char(q));
+    out.append(buf, n);
+    p = g_utf8_next_char(q);
+  }
+}
@@ -0,0 +1,59 @@
+/*
+ * html.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include <glib.h>
+#include <string>
+
+/**
+ * \brief Replace HTML character references with the characters they stand for.
+ *
+ * Decimal, hexadecimal and all the HTML5 named references are understood, the way an HTML5
+ * parser reads them in text. The input is given in chunks of any size, a reference may be split
+ * between two of them. Everything else is copied as it is.
+ */
+class HtmlDecoder {
+ public:
+  HtmlDecoder();
+
+  void decode(const char *, std::size_t, std::string &);
+  void finish(std::string &);
+
+ private:
+  HtmlDecoder(const HtmlDecoder &);
+  HtmlDecoder &operator=(const HtmlDecoder &);
+
+  std::size_t process(const char *, std::size_t, bool, std::string &);
+  std::size_t reference(const char *, const char *, bool, std::string &);
+  std::size_t numeric(const char *, const char *, bool, std::string &);
+  std::size_t named(const char *, const char *, bool, std::string &);
+
+  // The start of a reference we haven't got all of.
+  std::string pending;
+};
+
+/**
+ * \brief Write the characters which are not ASCII as HTML character references.
+ */
+class HtmlEncoder {
+ public:
+  static void encode(const char *, std::size_t, std::string &);
+};
@@ -0,0 +1,2343 @@
+/*
+ * htmlentities.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+/* Generated by misc/htmlentities.py, do not edit. */
+
+#include <config.h>
+
+#include "htmlentities.hh"
+#include <cstring>
+
+#define ENTITIES 2231
+#define BUCKETS 558
+
+static_assert(HTML_ENTITY_MAX_NAME == 32, "Update htmlentities.hh");
+static_assert(HTML_ENTITY_MAX_LEGACY == 6, "Update htmlentities.hh");
+
+/* clang-format off */
+static const HtmlEntity entities[ENTITIES] = {
+  {"Product;", 8, {0x220F, 0x0000}},
+  {"angmsdag;", 9, {0x29AE, 0x0000}},
+  {"angmsdah;", 9, {0x29AF, 0x0000}},
+  {"lrm;", 4, {0x200E, 0x0000}},
+  {"LeftTriangle;", 13, {0x22B2, 0x0000}},
+  {"fallingdotseq;", 14, {0x2252, 0x0000}},
+  {"yen;", 4, {0x00A5, 0x0000}},
+  {"andd;", 5, {0x2A5C, 0x0000}},
+  {"bernou;", 7, {0x212C, 0x0000}},
+  {"gl;", 3, {0x2277, 0x0000}},
+  {"Rcedil;", 7, {0x0156, 0x0000}},
+  {"xuplus;", 7, {0x2A04, 0x0000}},
+  {"RightUpTeeVector;", 17, {0x295C, 0x0000}},
+  {"spadesuit;", 10, {0x2660, 0x0000}},
+  {"ni;", 3, {0x220B, 0x0000}},
+  {"fjlig;", 6, {0x0066, 0x006A}},
+  {"pr;", 3, {0x227A, 0x0000}},
+  {"simplus;", 8, {0x2A24, 0x0000}},
+  {"rdca;", 5, {0x2937, 0x0000}},
+  {"ncedil;", 7, {0x0146, 0x0000}},
+  {"ncongdot;", 9, {0x2A6D, 0x0338}},
+  {"Ntilde;", 7, {0x00D1, 0x0000}},
+  {"Eta;", 4, {0x0397, 0x0000}},
+  {"nsim;", 5, {0x2241, 0x0000}},
+  {"easter;", 7, {0x2A6E, 0x0000}},
+  {"plusacir;", 9, {0x2A23, 0x0000}},
+  {"bopf;", 5, {0x1D553, 0x0000}},
+  {"rtimes;", 7, {0x22CA, 0x0000}},
+  {"subsetneq;", 10, {0x228A, 0x0000}},
+  {"nleftarrow;", 11, {0x219A, 0x0000}},
+  {"Poincareplane;", 14, {0x210C, 0x0000}},
+  {"loz;", 4, {0x25CA, 0x0000}},
+  {"boxDR;", 6, {0x2554, 0x0000}},
+  {"alpha;", 6, {0x03B1, 0x0000}},
+  {"aopf;", 5, {0x1D552, 0x0000}},
+  {"circ;", 5, {0x02C6, 0x0000}},
+  {"LT", 2, {0x003C, 0x0000}},
+  {"biguplus;", 9, {0x2A04, 0x0000}},
+  {"leftarrowtail;", 14, {0x21A2, 0x0000}},
+  {"hcirc;", 6, {0x0125, 0x0000}},
+  {"Wopf;", 5, {0x1D54E, 0x0000}},
+  {"vert;", 5, {0x007C, 0x0000}},
+  {"ExponentialE;", 13, {0x2147, 0x0000}},
+  {"twoheadleftarrow;", 17, {0x219E, 0x0000}},
+  {"Agrave;", 7, {0x00C0, 0x0000}},
+  {"And;", 4, {0x2A53, 0x0000}},
+  {"LeftRightArrow;", 15, {0x2194, 0x0000}},
+  {"nsucceq;", 8, {0x2AB0, 0x0338}},
+  {"nsubseteq;", 10, {0x2288, 0x0000}},
+  {"nsupE;", 6, {0x2AC6, 0x0338}},
+  {"CapitalDifferentialD;", 21, {0x2145, 0x0000}},
+  {"ocirc", 5, {0x00F4, 0x0000}},
+  {"vBarv;", 6, {0x2AE9, 0x0000}},
+  {"jcy;", 4, {0x0439, 0x0000}},
+  {"apos;", 5, {0x0027, 0x0000}},
+  {"yopf;", 5, {0x1D56A, 0x0000}},
+  {"NotSubset;", 10, {0x2282, 0x20D2}},
+  {"nless;", 6, {0x226E, 0x0000}},
+  {"Omacr;", 6, {0x014C, 0x0000}},
+  {"Zcaron;", 7, {0x017D, 0x0000}},
+  {"numsp;", 6, {0x2007, 0x0000}},
+  {"curlywedge;", 11, {0x22CF, 0x0000}},
+  {"NotSquareSubset;", 16, {0x228F, 0x0338}},
+  {"it;", 3, {0x2062, 0x0000}},
+  {"rightleftharpoons;", 18, {0x21CC, 0x0000}},
+  {"gesdoto;", 8, {0x2A82, 0x0000}},
+  {"Or;", 3, {0x2A54, 0x0000}},
+  {"rHar;", 5, {0x2964, 0x0000}},
+  {"elsdot;", 7, {0x2A97, 0x0000}},
+  {"apE;", 4, {0x2A70, 0x0000}},
+  {"ldrushar;", 9, {0x294B, 0x0000}},
+  {"gfr;", 4, {0x1D524, 0x0000}},
+  {"Zscr;", 5, {0x1D4B5, 0x0000}},
+  {"lharu;", 6, {0x21BC, 0x0000}},
+  {"Uring;", 6, {0x016E, 0x0000}},
+  {"SquareUnion;", 12, {0x2294, 0x0000}},
+  {"Iacute", 6, {0x00CD, 0x0000}},
+  {"notinE;", 7, {0x22F9, 0x0338}},
+  {"nbumpe;", 7, {0x224F, 0x0338}},
+  {"supsetneq;", 10, {0x228B, 0x0000}},
+  {"ruluhar;", 8, {0x2968, 0x0000}},
+  {"bsol;", 5, {0x005C, 0x0000}},
+  {"varepsilon;", 11, {0x03F5, 0x0000}},
+  {"Mscr;", 5, {0x2133, 0x0000}},
+  {"Map;", 4, {0x2905, 0x0000}},
+  {"gamma;", 6, {0x03B3, 0x0000}},
+  {"gdot;", 5, {0x0121, 0x0000}},
+  {"bigcup;", 7, {0x22C3, 0x0000}},
+  {"ijlig;", 6, {0x0133, 0x0000}},
+  {"rharu;", 6, {0x21C0, 0x0000}},
+  {"nrarrw;", 7, {0x219D, 0x0338}},
+  {"square;", 7, {0x25A1, 0x0000}},
+  {"complement;", 11, {0x2201, 0x0000}},
+  {"ClockwiseContourIntegral;", 25, {0x2232, 0x0000}},
+  {"clubs;", 6, {0x2663, 0x0000}},
+  {"lotimes;", 8, {0x2A34, 0x0000}},
+  {"twixt;", 6, {0x226C, 0x0000}},
+  {"otilde;", 7, {0x00F5, 0x0000}},
+  {"xutri;", 6, {0x25B3, 0x0000}},
+  {"rarrlp;", 7, {0x21AC, 0x0000}},
+  {"GT", 2, {0x003E, 0x0000}},
+  {"eth", 3, {0x00F0, 0x0000}},
+  {"Cross;", 6, {0x2A2F, 0x0000}},
+  {"frasl;", 6, {0x2044, 0x0000}},
+  {"nhArr;", 6, {0x21CE, 0x0000}},
+  {"rho;", 4, {0x03C1, 0x0000}},
+  {"clubsuit;", 9, {0x2663, 0x0000}},
+  {"gnE;", 4, {0x2269, 0x0000}},
+  {"nsmid;", 6, {0x2224, 0x0000}},
+  {"tcedil;", 7, {0x0163, 0x0000}},
+  {"omega;", 6, {0x03C9, 0x0000}},
+  {"Vert;", 5, {0x2016, 0x0000}},
+  {"DownLeftRightVector;", 20, {0x2950, 0x0000}},
+  {"bottom;", 7, {0x22A5, 0x0000}},
+  {"nlt;", 4, {0x226E, 0x0000}},
+  {"varpi;", 6, {0x03D6, 0x0000}},
+  {"reg", 3, {0x00AE, 0x0000}},
+  {"circledcirc;", 12, {0x229A, 0x0000}},
+  {"ddotseq;", 8, {0x2A77, 0x0000}},
+  {"Aring", 5, {0x00C5, 0x0000}},
+  {"uml", 3, {0x00A8, 0x0000}},
+  {"RightTriangleEqual;", 19, {0x22B5, 0x0000}},
+  {"geq;", 4, {0x2265, 0x0000}},
+  {"opar;", 5, {0x29B7, 0x0000}},
+  {"boxHU;", 6, {0x2569, 0x0000}},
+  {"curlyeqsucc;", 12, {0x22DF, 0x0000}},
+  {"vdash;", 6, {0x22A2, 0x0000}},
+  {"blank;", 6, {0x2423, 0x0000}},
+  {"Igrave;", 7, {0x00CC, 0x0000}},
+  {"DownTee;", 8, {0x22A4, 0x0000}},
+  {"chcy;", 5, {0x0447, 0x0000}},
+  {"DownLeftVector;", 15, {0x21BD, 0x0000}},
+  {"Hcirc;", 6, {0x0124, 0x0000}},
+  {"oslash;", 7, {0x00F8, 0x0000}},
+  {"Tscr;", 5, {0x1D4AF, 0x0000}},
+  {"Cfr;", 4, {0x212D, 0x0000}},
+  {"oror;", 5, {0x2A56, 0x0000}},
+  {"macr", 4, {0x00AF, 0x0000}},
+  {"Auml", 4, {0x00C4, 0x0000}},
+  {"Ascr;", 5, {0x1D49C, 0x0000}},
+  {"circlearrowright;", 17, {0x21BB, 0x0000}},
+  {"boxDr;", 6, {0x2553, 0x0000}},
+  {"awint;", 6, {0x2A11, 0x0000}},
+  {"subne;", 6, {0x228A, 0x0000}},
+  {"notinvb;", 8, {0x22F7, 0x0000}},
+  {"rpar;", 5, {0x0029, 0x0000}},
+  {"Gg;", 3, {0x22D9, 0x0000}},
+  {"UnderBar;", 9, {0x005F, 0x0000}},
+  {"nabla;", 6, {0x2207, 0x0000}},
+  {"becaus;", 7, {0x2235, 0x0000}},
+  {"ogon;", 5, {0x02DB, 0x0000}},
+  {"yacute", 6, {0x00FD, 0x0000}},
+  {"ltquest;", 8, {0x2A7B, 0x0000}},
+  {"Lsh;", 4, {0x21B0, 0x0000}},
+  {"ycy;", 4, {0x044B, 0x0000}},
+  {"ogt;", 4, {0x29C1, 0x0000}},
+  {"LeftArrow;", 10, {0x2190, 0x0000}},
+  {"Lcy;", 4, {0x041B, 0x0000}},
+  {"Rsh;", 4, {0x21B1, 0x0000}},
+  {"prurel;", 7, {0x22B0, 0x0000}},
+  {"uparrow;", 8, {0x2191, 0x0000}},
+  {"acirc", 5, {0x00E2, 0x0000}},
+  {"eDot;", 5, {0x2251, 0x0000}},
+  {"cudarrl;", 8, {0x2938, 0x0000}},
+  {"nLeftrightarrow;", 16, {0x21CE, 0x0000}},
+  {"supsetneqq;", 11, {0x2ACC, 0x0000}},
+  {"Implies;", 8, {0x21D2, 0x0000}},
+  {"ncong;", 6, {0x2247, 0x0000}},
+  {"vsupne;", 7, {0x228B, 0xFE00}},
+  {"RightArrowLeftArrow;", 20, {0x21C4, 0x0000}},
+  {"Bernoullis;", 11, {0x212C, 0x0000}},
+  {"vartriangleleft;", 16, {0x22B2, 0x0000}},
+  {"piv;", 4, {0x03D6, 0x0000}},
+  {"iscr;", 5, {0x1D4BE, 0x0000}},
+  {"prod;", 5, {0x220F, 0x0000}},
+  {"aleph;", 6, {0x2135, 0x0000}},
+  {"DoubleLongLeftRightArrow;", 25, {0x27FA, 0x0000}},
+  {"DownArrowBar;", 13, {0x2913, 0x0000}},
+  {"lvertneqq;", 10, {0x2268, 0xFE00}},
+  {"lne;", 4, {0x2A87, 0x0000}},
+  {"Ycy;", 4, {0x042B, 0x0000}},
+  {"micro;", 6, {0x00B5, 0x0000}},
+  {"gnap;", 5, {0x2A8A, 0x0000}},
+  {"roplus;", 7, {0x2A2E, 0x0000}},
+  {"thorn;", 6, {0x00FE, 0x0000}},
+  {"subrarr;", 8, {0x2979, 0x0000}},
+  {"qprime;", 7, {0x2057, 0x0000}},
+  {"barvee;", 7, {0x22BD, 0x0000}},
+  {"langle;", 7, {0x27E8, 0x0000}},
+  {"DiacriticalTilde;", 17, {0x02DC, 0x0000}},
+  {"half;", 5, {0x00BD, 0x0000}},
+  {"gE;", 3, {0x2267, 0x0000}},
+  {"Lang;", 5, {0x27EA, 0x0000}},
+  {"icirc", 5, {0x00EE, 0x0000}},
+  {"Hstrok;", 7, {0x0126, 0x0000}},
+  {"bbrk;", 5, {0x23B5, 0x0000}},
+  {"lgE;", 4, {0x2A91, 0x0000}},
+  {"Vfr;", 4, {0x1D519, 0x0000}},
+  {"larr;", 5, {0x2190, 0x0000}},
+  {"apacir;", 7, {0x2A6F, 0x0000}},
+  {"delta;", 6, {0x03B4, 0x0000}},
+  {"afr;", 4, {0x1D51E, 0x0000}},
+  {"DownArrowUpArrow;", 17, {0x21F5, 0x0000}},
+  {"Hscr;", 5, {0x210B, 0x0000}},
+  {"odblac;", 7, {0x0151, 0x0000}},
+  {"pi;", 3, {0x03C0, 0x0000}},
+  {"scnE;", 5, {0x2AB6, 0x0000}},
+  {"PartialD;", 9, {0x2202, 0x0000}},
+  {"leqslant;", 9, {0x2A7D, 0x0000}},
+  {"Gamma;", 6, {0x0393, 0x0000}},
+  {"ntilde;", 7, {0x00F1, 0x0000}},
+  {"LeftTee;", 8, {0x22A3, 0x0000}},
+  {"trie;", 5, {0x225C, 0x0000}},
+  {"rationals;", 10, {0x211A, 0x0000}},
+  {"ccaps;", 6, {0x2A4D, 0x0000}},
+  {"NotEqualTilde;", 14, {0x2242, 0x0338}},
+  {"iinfin;", 7, {0x29DC, 0x0000}},
+  {"dlcrop;", 7, {0x230D, 0x0000}},
+  {"Uacute;", 7, {0x00DA, 0x0000}},
+  {"npart;", 6, {0x2202, 0x0338}},
+  {"RightTriangle;", 14, {0x22B3, 0x0000}},
+  {"wr;", 3, {0x2240, 0x0000}},
+  {"copysr;", 7, {0x2117, 0x0000}},
+  {"mlcp;", 5, {0x2ADB, 0x0000}},
+  {"cent", 4, {0x00A2, 0x0000}},
+  {"boxuL;", 6, {0x255B, 0x0000}},
+  {"parsim;", 7, {0x2AF3, 0x0000}},
+  {"smile;", 6, {0x2323, 0x0000}},
+  {"NotHumpEqual;", 13, {0x224F, 0x0338}},
+  {"NegativeThinSpace;", 18, {0x200B, 0x0000}},
+  {"excl;", 5, {0x0021, 0x0000}},
+  {"ropf;", 5, {0x1D563, 0x0000}},
+  {"perp;", 5, {0x22A5, 0x0000}},
+  {"curlyeqprec;", 12, {0x22DE, 0x0000}},
+  {"otimes;", 7, {0x2297, 0x0000}},
+  {"smtes;", 6, {0x2AAC, 0xFE00}},
+  {"imagpart;", 9, {0x2111, 0x0000}},
+  {"DownLeftTeeVector;", 18, {0x295E, 0x0000}},
+  {"ncap;", 5, {0x2A43, 0x0000}},
+  {"Equal;", 6, {0x2A75, 0x0000}},
+  {"vltri;", 6, {0x22B2, 0x0000}},
+  {"ordm", 4, {0x00BA, 0x0000}},
+  {"curlyvee;", 9, {0x22CE, 0x0000}},
+  {"nLeftarrow;", 11, {0x21CD, 0x0000}},
+  {"hellip;", 7, {0x2026, 0x0000}},
+  {"Subset;", 7, {0x22D0, 0x0000}},
+  {"leftrightarrow;", 15, {0x2194, 0x0000}},
+  {"rArr;", 5, {0x21D2, 0x0000}},
+  {"plankv;", 7, {0x210F, 0x0000}},
+  {"lmoustache;", 11, {0x23B0, 0x0000}},
+  {"jopf;", 5, {0x1D55B, 0x0000}},
+  {"bdquo;", 6, {0x201E, 0x0000}},
+  {"marker;", 7, {0x25AE, 0x0000}},
+  {"ordm;", 5, {0x00BA, 0x0000}},
+  {"sup2", 4, {0x00B2, 0x0000}},
+  {"Kfr;", 4, {0x1D50E, 0x0000}},
+  {"backsim;", 8, {0x223D, 0x0000}},
+  {"boxvR;", 6, {0x255E, 0x0000}},
+  {"nbsp;", 5, {0x00A0, 0x0000}},
+  {"Gcedil;", 7, {0x0122, 0x0000}},
+  {"nsupset;", 8, {0x2283, 0x20D2}},
+  {"ETH", 3, {0x00D0, 0x0000}},
+  {"mapstodown;", 11, {0x21A7, 0x0000}},
+  {"Pfr;", 4, {0x1D513, 0x0000}},
+  {"PrecedesSlantEqual;", 19, {0x227C, 0x0000}},
+  {"vopf;", 5, {0x1D567, 0x0000}},
+  {"eqvparsl;", 9, {0x29E5, 0x0000}},
+  {"rarrtl;", 7, {0x21A3, 0x0000}},
+  {"otimesas;", 9, {0x2A36, 0x0000}},
+  {"Element;", 8, {0x2208, 0x0000}},
+  {"supsim;", 7, {0x2AC8, 0x0000}},
+  {"sqcups;", 7, {0x2294, 0xFE00}},
+  {"rdldhar;", 8, {0x2969, 0x0000}},
+  {"squarf;", 7, {0x25AA, 0x0000}},
+  {"lnapprox;", 9, {0x2A89, 0x0000}},
+  {"commat;", 7, {0x0040, 0x0000}},
+  {"Delta;", 6, {0x0394, 0x0000}},
+  {"erDot;", 6, {0x2253, 0x0000}},
+  {"rarrb;", 6, {0x21E5, 0x0000}},
+  {"nacute;", 7, {0x0144, 0x0000}},
+  {"TSHcy;", 6, {0x040B, 0x0000}},
+  {"nltri;", 6, {0x22EA, 0x0000}},
+  {"iukcy;", 6, {0x0456, 0x0000}},
+  {"emptyset;", 9, {0x2205, 0x0000}},
+  {"iacute;", 7, {0x00ED, 0x0000}},
+  {"cedil", 5, {0x00B8, 0x0000}},
+  {"sext;", 5, {0x2736, 0x0000}},
+  {"lowbar;", 7, {0x005F, 0x0000}},
+  {"hairsp;", 7, {0x200A, 0x0000}},
+  {"angsph;", 7, {0x2222, 0x0000}},
+  {"lessdot;", 8, {0x22D6, 0x0000}},
+  {"Congruent;", 10, {0x2261, 0x0000}},
+  {"triangleright;", 14, {0x25B9, 0x0000}},
+  {"boxHd;", 6, {0x2564, 0x0000}},
+  {"smashp;", 7, {0x2A33, 0x0000}},
+  {"minusd;", 7, {0x2238, 0x0000}},
+  {"NotEqual;", 9, {0x2260, 0x0000}},
+  {"bumpeq;", 7, {0x224F, 0x0000}},
+  {"subsim;", 7, {0x2AC7, 0x0000}},
+  {"precnapprox;", 12, {0x2AB9, 0x0000}},
+  {"Rarrtl;", 7, {0x2916, 0x0000}},
+  {"telrec;", 7, {0x2315, 0x0000}},
+  {"rarrc;", 6, {0x2933, 0x0000}},
+  {"shortparallel;", 14, {0x2225, 0x0000}},
+  {"notnivc;", 8, {0x22FD, 0x0000}},
+  {"ifr;", 4, {0x1D526, 0x0000}},
+  {"LeftRightVector;", 16, {0x294E, 0x0000}},
+  {"dcaron;", 7, {0x010F, 0x0000}},
+  {"REG", 3, {0x00AE, 0x0000}},
+  {"djcy;", 5, {0x0452, 0x0000}},
+  {"rsquo;", 6, {0x2019, 0x0000}},
+  {"ofcir;", 6, {0x29BF, 0x0000}},
+  {"Gopf;", 5, {0x1D53E, 0x0000}},
+  {"sqsupe;", 7, {0x2292, 0x0000}},
+  {"Lt;", 3, {0x226A, 0x0000}},
+  {"heartsuit;", 10, {0x2665, 0x0000}},
+  {"kappa;", 6, {0x03BA, 0x0000}},
+  {"LessGreater;", 12, {0x2276, 0x0000}},
+  {"ggg;", 4, {0x22D9, 0x0000}},
+  {"iuml;", 5, {0x00EF, 0x0000}},
+  {"asymp;", 6, {0x2248, 0x0000}},
+  {"xotime;", 7, {0x2A02, 0x0000}},
+  {"rsh;", 4, {0x21B1, 0x0000}},
+  {"Uarr;", 5, {0x219F, 0x0000}},
+  {"Vee;", 4, {0x22C1, 0x0000}},
+  {"leftrightarrows;", 16, {0x21C6, 0x0000}},
+  {"circeq;", 7, {0x2257, 0x0000}},
+  {"nRightarrow;", 12, {0x21CF, 0x0000}},
+  {"uopf;", 5, {0x1D566, 0x0000}},
+  {"nwarrow;", 8, {0x2196, 0x0000}},
+  {"Vopf;", 5, {0x1D54D, 0x0000}},
+  {"kjcy;", 5, {0x045C, 0x0000}},
+  {"ll;", 3, {0x226A, 0x0000}},
+  {"starf;", 6, {0x2605, 0x0000}},
+  {"escr;", 5, {0x212F, 0x0000}},
+  {"Cedilla;", 8, {0x00B8, 0x0000}},
+  {"divideontimes;", 14, {0x22C7, 0x0000}},
+  {"Ecirc", 5, {0x00CA, 0x0000}},
+  {"Colon;", 6, {0x2237, 0x0000}},
+  {"TildeEqual;", 11, {0x2243, 0x0000}},
+  {"thkap;", 6, {0x2248, 0x0000}},
+  {"lfisht;", 7, {0x297C, 0x0000}},
+  {"supplus;", 8, {0x2AC0, 0x0000}},
+  {"nvHarr;", 7, {0x2904, 0x0000}},
+  {"suphsub;", 8, {0x2AD7, 0x0000}},
+  {"lceil;", 6, {0x2308, 0x0000}},
+  {"radic;", 6, {0x221A, 0x0000}},
+  {"lap;", 4, {0x2A85, 0x0000}},
+  {"Pi;", 3, {0x03A0, 0x0000}},
+  {"DoubleLeftArrow;", 16, {0x21D0, 0x0000}},
+  {"rotimes;", 8, {0x2A35, 0x0000}},
+  {"Uparrow;", 8, {0x21D1, 0x0000}},
+  {"disin;", 6, {0x22F2, 0x0000}},
+  {"rightharpoondown;", 17, {0x21C1, 0x0000}},
+  {"Umacr;", 6, {0x016A, 0x0000}},
+  {"equals;", 7, {0x003D, 0x0000}},
+  {"Oacute;", 7, {0x00D3, 0x0000}},
+  {"notin;", 6, {0x2209, 0x0000}},
+  {"Dstrok;", 7, {0x0110, 0x0000}},
+  {"DD;", 3, {0x2145, 0x0000}},
+  {"Zacute;", 7, {0x0179, 0x0000}},
+  {"gneq;", 5, {0x2A88, 0x0000}},
+  {"Sc;", 3, {0x2ABC, 0x0000}},
+  {"gEl;", 4, {0x2A8C, 0x0000}},
+  {"Oslash;", 7, {0x00D8, 0x0000}},
+  {"tstrok;", 7, {0x0167, 0x0000}},
+  {"LeftVector;", 11, {0x21BC, 0x0000}},
+  {"sdot;", 5, {0x22C5, 0x0000}},
+  {"LeftArrowBar;", 13, {0x21E4, 0x0000}},
+  {"xrArr;", 6, {0x27F9, 0x0000}},
+  {"Cap;", 4, {0x22D2, 0x0000}},
+  {"Zfr;", 4, {0x2128, 0x0000}},
+  {"nltrie;", 7, {0x22EC, 0x0000}},
+  {"isinE;", 6, {0x22F9, 0x0000}},
+  {"epar;", 5, {0x22D5, 0x0000}},
+  {"zdot;", 5, {0x017C, 0x0000}},
+  {"nprcue;", 7, {0x22E0, 0x0000}},
+  {"nleqslant;", 10, {0x2A7D, 0x0338}},
+  {"chi;", 4, {0x03C7, 0x0000}},
+  {"efr;", 4, {0x1D522, 0x0000}},
+  {"boxtimes;", 9, {0x22A0, 0x0000}},
+  {"sharp;", 6, {0x266F, 0x0000}},
+  {"subseteq;", 9, {0x2286, 0x0000}},
+  {"Uacute", 6, {0x00DA, 0x0000}},
+  {"blk14;", 6, {0x2591, 0x0000}},
+  {"Hopf;", 5, {0x210D, 0x0000}},
+  {"curarrm;", 8, {0x293C, 0x0000}},
+  {"dtri;", 5, {0x25BF, 0x0000}},
+  {"jukcy;", 6, {0x0454, 0x0000}},
+  {"cir;", 4, {0x25CB, 0x0000}},
+  {"angmsd;", 7, {0x2221, 0x0000}},
+  {"GreaterEqual;", 13, {0x2265, 0x0000}},
+  {"mapsto;", 7, {0x21A6, 0x0000}},
+  {"boxdL;", 6, {0x2555, 0x0000}},
+  {"lrhard;", 7, {0x296D, 0x0000}},
+  {"DDotrahd;", 9, {0x2911, 0x0000}},
+  {"gimel;", 6, {0x2137, 0x0000}},
+  {"bepsi;", 6, {0x03F6, 0x0000}},
+  {"DScy;", 5, {0x0405, 0x0000}},
+  {"lnsim;", 6, {0x22E6, 0x0000}},
+  {"boxDl;", 6, {0x2556, 0x0000}},
+  {"cirE;", 5, {0x29C3, 0x0000}},
+  {"boxHD;", 6, {0x2566, 0x0000}},
+  {"Dot;", 4, {0x00A8, 0x0000}},
+  {"jmath;", 6, {0x0237, 0x0000}},
+  {"gesdot;", 7, {0x2A80, 0x0000}},
+  {"ltrie;", 6, {0x22B4, 0x0000}},
+  {"NotPrecedes;", 12, {0x2280, 0x0000}},
+  {"RightCeiling;", 13, {0x2309, 0x0000}},
+  {"varnothing;", 11, {0x2205, 0x0000}},
+  {"nearr;", 6, {0x2197, 0x0000}},
+  {"sung;", 5, {0x266A, 0x0000}},
+  {"Escr;", 5, {0x2130, 0x0000}},
+  {"searr;", 6, {0x2198, 0x0000}},
+  {"itilde;", 7, {0x0129, 0x0000}},
+  {"THORN", 5, {0x00DE, 0x0000}},
+  {"suphsol;", 8, {0x27C9, 0x0000}},
+  {"Prime;", 6, {0x2033, 0x0000}},
+  {"dArr;", 5, {0x21D3, 0x0000}},
+  {"sqsube;", 7, {0x2291, 0x0000}},
+  {"bsolb;", 6, {0x29C5, 0x0000}},
+  {"larrtl;", 7, {0x21A2, 0x0000}},
+  {"mu;", 3, {0x03BC, 0x0000}},
+  {"leftharpoonup;", 14, {0x21BC, 0x0000}},
+  {"LeftAngleBracket;", 17, {0x27E8, 0x0000}},
+  {"rdquo;", 6, {0x201D, 0x0000}},
+  {"Iota;", 5, {0x0399, 0x0000}},
+  {"boxhD;", 6, {0x2565, 0x0000}},
+  {"rnmid;", 6, {0x2AEE, 0x0000}},
+  {"atilde", 6, {0x00E3, 0x0000}},
+  {"nbsp", 4, {0x00A0, 0x0000}},
+  {"RightUpVector;", 14, {0x21BE, 0x0000}},
+  {"ThickSpace;", 11, {0x205F, 0x200A}},
+  {"egrave", 6, {0x00E8, 0x0000}},
+  {"longleftrightarrow;", 19, {0x27F7, 0x0000}},
+  {"ccaron;", 7, {0x010D, 0x0000}},
+  {"hardcy;", 7, {0x044A, 0x0000}},
+  {"boxv;", 5, {0x2502, 0x0000}},
+  {"SHCHcy;", 7, {0x0429, 0x0000}},
+  {"nmid;", 5, {0x2224, 0x0000}},
+  {"setmn;", 6, {0x2216, 0x0000}},
+  {"fnof;", 5, {0x0192, 0x0000}},
+  {"psi;", 4, {0x03C8, 0x0000}},
+  {"RightVectorBar;", 15, {0x2953, 0x0000}},
+  {"NotSupersetEqual;", 17, {0x2289, 0x0000}},
+  {"nesim;", 6, {0x2242, 0x0338}},
+  {"omacr;", 6, {0x014D, 0x0000}},
+  {"xsqcup;", 7, {0x2A06, 0x0000}},
+  {"num;", 4, {0x0023, 0x0000}},
+  {"Cscr;", 5, {0x1D49E, 0x0000}},
+  {"alefsym;", 8, {0x2135, 0x0000}},
+  {"ntriangleleft;", 14, {0x22EA, 0x0000}},
+  {"Union;", 6, {0x22C3, 0x0000}},
+  {"male;", 5, {0x2642, 0x0000}},
+  {"approxeq;", 9, {0x224A, 0x0000}},
+  {"lessgtr;", 8, {0x2276, 0x0000}},
+  {"DotEqual;", 9, {0x2250, 0x0000}},
+  {"Bscr;", 5, {0x212C, 0x0000}},
+  {"els;", 4, {0x2A95, 0x0000}},
+  {"caps;", 5, {0x2229, 0xFE00}},
+  {"kappav;", 7, {0x03F0, 0x0000}},
+  {"nleftrightarrow;", 16, {0x21AE, 0x0000}},
+  {"frac45;", 7, {0x2158, 0x0000}},
+  {"ltrPar;", 7, {0x2996, 0x0000}},
+  {"eqcirc;", 7, {0x2256, 0x0000}},
+  {"plussim;", 8, {0x2A26, 0x0000}},
+  {"uharr;", 6, {0x21BE, 0x0000}},
+  {"Zcy;", 4, {0x0417, 0x0000}},
+  {"Iscr;", 5, {0x2110, 0x0000}},
+  {"Iopf;", 5, {0x1D540, 0x0000}},
+  {"thinsp;", 7, {0x2009, 0x0000}},
+  {"hopf;", 5, {0x1D559, 0x0000}},
+  {"circlearrowleft;", 16, {0x21BA, 0x0000}},
+  {"PlusMinus;", 10, {0x00B1, 0x0000}},
+  {"esim;", 5, {0x2242, 0x0000}},
+  {"sfrown;", 7, {0x2322, 0x0000}},
+  {"Tilde;", 6, {0x223C, 0x0000}},
+  {"NotSucceeds;", 12, {0x2281, 0x0000}},
+  {"isindot;", 8, {0x22F5, 0x0000}},
+  {"cwconint;", 9, {0x2232, 0x0000}},
+  {"LeftUpTeeVector;", 16, {0x2960, 0x0000}},
+  {"Vvdash;", 7, {0x22AA, 0x0000}},
+  {"sigmaf;", 7, {0x03C2, 0x0000}},
+  {"NotLessLess;", 12, {0x226A, 0x0338}},
+  {"boxbox;", 7, {0x29C9, 0x0000}},
+  {"Ograve", 6, {0x00D2, 0x0000}},
+  {"Ropf;", 5, {0x211D, 0x0000}},
+  {"LessFullEqual;", 14, {0x2266, 0x0000}},
+  {"REG;", 4, {0x00AE, 0x0000}},
+  {"middot", 6, {0x00B7, 0x0000}},
+  {"prap;", 5, {0x2AB7, 0x0000}},
+  {"hearts;", 7, {0x2665, 0x0000}},
+  {"plusdo;", 7, {0x2214, 0x0000}},
+  {"siml;", 5, {0x2A9D, 0x0000}},
+  {"order;", 6, {0x2134, 0x0000}},
+  {"NotNestedGreaterGreater;", 24, {0x2AA2, 0x0338}},
+  {"ngeqq;", 6, {0x2267, 0x0338}},
+  {"racute;", 7, {0x0155, 0x0000}},
+  {"odsold;", 7, {0x29BC, 0x0000}},
+  {"lozenge;", 8, {0x25CA, 0x0000}},
+  {"gtcc;", 5, {0x2AA7, 0x0000}},
+  {"angrt;", 6, {0x221F, 0x0000}},
+  {"apid;", 5, {0x224B, 0x0000}},
+  {"RightTeeArrow;", 14, {0x21A6, 0x0000}},
+  {"agrave", 6, {0x00E0, 0x0000}},
+  {"ntrianglerighteq;", 17, {0x22ED, 0x0000}},
+  {"sol;", 4, {0x002F, 0x0000}},
+  {"sup2;", 5, {0x00B2, 0x0000}},
+  {"nsucc;", 6, {0x2281, 0x0000}},
+  {"oscr;", 5, {0x2134, 0x0000}},
+  {"qopf;", 5, {0x1D562, 0x0000}},
+  {"nwnear;", 7, {0x2927, 0x0000}},
+  {"int;", 4, {0x222B, 0x0000}},
+  {"ufisht;", 7, {0x297E, 0x0000}},
+  {"subnE;", 6, {0x2ACB, 0x0000}},
+  {"Ycirc;", 6, {0x0176, 0x0000}},
+  {"Ccaron;", 7, {0x010C, 0x0000}},
+  {"Aring;", 6, {0x00C5, 0x0000}},
+  {"cups;", 5, {0x222A, 0xFE00}},
+  {"agrave;", 7, {0x00E0, 0x0000}},
+  {"auml;", 5, {0x00E4, 0x0000}},
+  {"nrtrie;", 7, {0x22ED, 0x0000}},
+  {"bbrktbrk;", 9, {0x23B6, 0x0000}},
+  {"shy;", 4, {0x00AD, 0x0000}},
+  {"profsurf;", 9, {0x2313, 0x0000}},
+  {"ffilig;", 7, {0xFB03, 0x0000}},
+  {"dzigrarr;", 9, {0x27FF, 0x0000}},
+  {"ugrave", 6, {0x00F9, 0x0000}},
+  {"Precedes;", 9, {0x227A, 0x0000}},
+  {"incare;", 7, {0x2105, 0x0000}},
+  {"Ufr;", 4, {0x1D518, 0x0000}},
+  {"leftthreetimes;", 15, {0x22CB, 0x0000}},
+  {"planck;", 7, {0x210F, 0x0000}},
+  {"sfr;", 4, {0x1D530, 0x0000}},
+  {"Int;", 4, {0x222C, 0x0000}},
+  {"NotSubsetEqual;", 15, {0x2288, 0x0000}},
+  {"Backslash;", 10, {0x2216, 0x0000}},
+  {"prnap;", 6, {0x2AB9, 0x0000}},
+  {"jscr;", 5, {0x1D4BF, 0x0000}},
+  {"gscr;", 5, {0x210A, 0x0000}},
+  {"NotReverseElement;", 18, {0x220C, 0x0000}},
+  {"UnderBrace;", 11, {0x23DF, 0x0000}},
+  {"loarr;", 6, {0x21FD, 0x0000}},
+  {"igrave", 6, {0x00EC, 0x0000}},
+  {"wfr;", 4, {0x1D534, 0x0000}},
+  {"emsp;", 5, {0x2003, 0x0000}},
+  {"Ncaron;", 7, {0x0147, 0x0000}},
+  {"smid;", 5, {0x2223, 0x0000}},
+  {"Kscr;", 5, {0x1D4A6, 0x0000}},
+  {"napE;", 5, {0x2A70, 0x0338}},
+  {"Lcedil;", 7, {0x013B, 0x0000}},
+  {"pcy;", 4, {0x043F, 0x0000}},
+  {"Efr;", 4, {0x1D508, 0x0000}},
+  {"Longrightarrow;", 15, {0x27F9, 0x0000}},
+  {"VeryThinSpace;", 14, {0x200A, 0x0000}},
+  {"Eogon;", 6, {0x0118, 0x0000}},
+  {"sqsub;", 6, {0x228F, 0x0000}},
+  {"rlm;", 4, {0x200F, 0x0000}},
+  {"RightDownVectorBar;", 19, {0x2955, 0x0000}},
+  {"Vdash;", 6, {0x22A9, 0x0000}},
+  {"eth;", 4, {0x00F0, 0x0000}},
+  {"MinusPlus;", 10, {0x2213, 0x0000}},
+  {"ltri;", 5, {0x25C3, 0x0000}},
+  {"NotGreaterGreater;", 18, {0x226B, 0x0338}},
+  {"ccedil", 6, {0x00E7, 0x0000}},
+  {"ycirc;", 6, {0x0177, 0x0000}},
+  {"phmmat;", 7, {0x2133, 0x0000}},
+  {"rarrpl;", 7, {0x2945, 0x0000}},
+  {"longmapsto;", 11, {0x27FC, 0x0000}},
+  {"nvsim;", 6, {0x223C, 0x20D2}},
+  {"wedgeq;", 7, {0x2259, 0x0000}},
+  {"eopf;", 5, {0x1D556, 0x0000}},
+  {"Omega;", 6, {0x03A9, 0x0000}},
+  {"Amacr;", 6, {0x0100, 0x0000}},
+  {"ShortRightArrow;", 16, {0x2192, 0x0000}},
+  {"qscr;", 5, {0x1D4C6, 0x0000}},
+  {"bump;", 5, {0x224E, 0x0000}},
+  {"ensp;", 5, {0x2002, 0x0000}},
+  {"Rcaron;", 7, {0x0158, 0x0000}},
+  {"ang;", 4, {0x2220, 0x0000}},
+  {"GreaterEqualLess;", 17, {0x22DB, 0x0000}},
+  {"Rscr;", 5, {0x211B, 0x0000}},
+  {"simne;", 6, {0x2246, 0x0000}},
+  {"Conint;", 7, {0x222F, 0x0000}},
+  {"RightTriangleBar;", 17, {0x29D0, 0x0000}},
+  {"nesear;", 7, {0x2928, 0x0000}},
+  {"nsupseteq;", 10, {0x2289, 0x0000}},
+  {"QUOT;", 5, {0x0022, 0x0000}},
+  {"minus;", 6, {0x2212, 0x0000}},
+  {"Atilde", 6, {0x00C3, 0x0000}},
+  {"fscr;", 5, {0x1D4BB, 0x0000}},
+  {"succeq;", 7, {0x2AB0, 0x0000}},
+  {"lescc;", 6, {0x2AA8, 0x0000}},
+  {"frac12;", 7, {0x00BD, 0x0000}},
+  {"boxVh;", 6, {0x256B, 0x0000}},
+  {"napid;", 6, {0x224B, 0x0338}},
+  {"scap;", 5, {0x2AB8, 0x0000}},
+  {"NestedGreaterGreater;", 21, {0x226B, 0x0000}},
+  {"fllig;", 6, {0xFB02, 0x0000}},
+  {"supsup;", 7, {0x2AD6, 0x0000}},
+  {"IEcy;", 5, {0x0415, 0x0000}},
+  {"para;", 5, {0x00B6, 0x0000}},
+  {"mDDot;", 6, {0x223A, 0x0000}},
+  {"Phi;", 4, {0x03A6, 0x0000}},
+  {"darr;", 5, {0x2193, 0x0000}},
+  {"bcy;", 4, {0x0431, 0x0000}},
+  {"Udblac;", 7, {0x0170, 0x0000}},
+  {"curvearrowleft;", 15, {0x21B6, 0x0000}},
+  {"acd;", 4, {0x223F, 0x0000}},
+  {"timesb;", 7, {0x22A0, 0x0000}},
+  {"andslope;", 9, {0x2A58, 0x0000}},
+  {"TRADE;", 6, {0x2122, 0x0000}},
+  {"RightDownTeeVector;", 19, {0x295D, 0x0000}},
+  {"InvisibleTimes;", 15, {0x2062, 0x0000}},
+  {"twoheadrightarrow;", 18, {0x21A0, 0x0000}},
+  {"llarr;", 6, {0x21C7, 0x0000}},
+  {"Ifr;", 4, {0x2111, 0x0000}},
+  {"minusdu;", 8, {0x2A2A, 0x0000}},
+  {"UpTeeArrow;", 11, {0x21A5, 0x0000}},
+  {"nsup;", 5, {0x2285, 0x0000}},
+  {"boxUr;", 6, {0x2559, 0x0000}},
+  {"bigtriangleup;", 14, {0x25B3, 0x0000}},
+  {"eqsim;", 6, {0x2242, 0x0000}},
+  {"nwarr;", 6, {0x2196, 0x0000}},
+  {"compfn;", 7, {0x2218, 0x0000}},
+  {"njcy;", 5, {0x045A, 0x0000}},
+  {"cup;", 4, {0x222A, 0x0000}},
+  {"NotExists;", 10, {0x2204, 0x0000}},
+  {"tbrk;", 5, {0x23B4, 0x0000}},
+  {"NotLeftTriangleEqual;", 21, {0x22EC, 0x0000}},
+  {"Ocy;", 4, {0x041E, 0x0000}},
+  {"zwj;", 4, {0x200D, 0x0000}},
+  {"lrhar;", 6, {0x21CB, 0x0000}},
+  {"nap;", 4, {0x2249, 0x0000}},
+  {"ovbar;", 6, {0x233D, 0x0000}},
+  {"LeftDownVectorBar;", 18, {0x2959, 0x0000}},
+  {"empty;", 6, {0x2205, 0x0000}},
+  {"Not;", 4, {0x2AEC, 0x0000}},
+  {"vfr;", 4, {0x1D533, 0x0000}},
+  {"lHar;", 5, {0x2962, 0x0000}},
+  {"nGg;", 4, {0x22D9, 0x0338}},
+  {"LeftTeeVector;", 14, {0x295A, 0x0000}},
+  {"Dfr;", 4, {0x1D507, 0x0000}},
+  {"Oslash", 6, {0x00D8, 0x0000}},
+  {"nge;", 4, {0x2271, 0x0000}},
+  {"asympeq;", 8, {0x224D, 0x0000}},
+  {"urcrop;", 7, {0x230E, 0x0000}},
+  {"Assign;", 7, {0x2254, 0x0000}},
+  {"nLl;", 4, {0x22D8, 0x0338}},
+  {"NotPrecedesEqual;", 17, {0x2AAF, 0x0338}},
+  {"questeq;", 8, {0x225F, 0x0000}},
+  {"angle;", 6, {0x2220, 0x0000}},
+  {"lesdotor;", 9, {0x2A83, 0x0000}},
+  {"pre;", 4, {0x2AAF, 0x0000}},
+  {"nharr;", 6, {0x21AE, 0x0000}},
+  {"glE;", 4, {0x2A92, 0x0000}},
+  {"capdot;", 7, {0x2A40, 0x0000}},
+  {"ominus;", 7, {0x2296, 0x0000}},
+  {"scy;", 4, {0x0441, 0x0000}},
+  {"filig;", 6, {0xFB01, 0x0000}},
+  {"macr;", 5, {0x00AF, 0x0000}},
+  {"thetav;", 7, {0x03D1, 0x0000}},
+  {"acute;", 6, {0x00B4, 0x0000}},
+  {"nsubseteqq;", 11, {0x2AC5, 0x0338}},
+  {"DJcy;", 5, {0x0402, 0x0000}},
+  {"intcal;", 7, {0x22BA, 0x0000}},
+  {"vnsup;", 6, {0x2283, 0x20D2}},
+  {"blacktriangleleft;", 18, {0x25C2, 0x0000}},
+  {"lhblk;", 6, {0x2584, 0x0000}},
+  {"part;", 5, {0x2202, 0x0000}},
+  {"sqsubset;", 9, {0x228F, 0x0000}},
+  {"larrhk;", 7, {0x21A9, 0x0000}},
+  {"theta;", 6, {0x03B8, 0x0000}},
+  {"ograve", 6, {0x00F2, 0x0000}},
+  {"gnapprox;", 9, {0x2A8A, 0x0000}},
+  {"gesdotol;", 9, {0x2A84, 0x0000}},
+  {"fopf;", 5, {0x1D557, 0x0000}},
+  {"Ccedil", 6, {0x00C7, 0x0000}},
+  {"curren;", 7, {0x00A4, 0x0000}},
+  {"race;", 5, {0x223D, 0x0331}},
+  {"Gcy;", 4, {0x0413, 0x0000}},
+  {"backepsilon;", 12, {0x03F6, 0x0000}},
+  {"crarr;", 6, {0x21B5, 0x0000}},
+  {"lurdshar;", 9, {0x294A, 0x0000}},
+  {"LeftVectorBar;", 14, {0x2952, 0x0000}},
+  {"ntriangleright;", 15, {0x22EB, 0x0000}},
+  {"LeftUpVector;", 13, {0x21BF, 0x0000}},
+  {"rbrke;", 6, {0x298C, 0x0000}},
+  {"Uuml", 4, {0x00DC, 0x0000}},
+  {"Jcy;", 4, {0x0419, 0x0000}},
+  {"frac15;", 7, {0x2155, 0x0000}},
+  {"Fopf;", 5, {0x1D53D, 0x0000}},
+  {"nearrow;", 8, {0x2197, 0x0000}},
+  {"NotNestedLessLess;", 18, {0x2AA1, 0x0338}},
+  {"precapprox;", 11, {0x2AB7, 0x0000}},
+  {"KHcy;", 5, {0x0425, 0x0000}},
+  {"eacute", 6, {0x00E9, 0x0000}},
+  {"lArr;", 5, {0x21D0, 0x0000}},
+  {"FilledSmallSquare;", 18, {0x25FC, 0x0000}},
+  {"plusdu;", 7, {0x2A25, 0x0000}},
+  {"mho;", 4, {0x2127, 0x0000}},
+  {"Ocirc;", 6, {0x00D4, 0x0000}},
+  {"sup;", 4, {0x2283, 0x0000}},
+  {"deg;", 4, {0x00B0, 0x0000}},
+  {"isinsv;", 7, {0x22F3, 0x0000}},
+  {"looparrowleft;", 14, {0x21AB, 0x0000}},
+  {"sqcup;", 6, {0x2294, 0x0000}},
+  {"Pcy;", 4, {0x041F, 0x0000}},
+  {"bprime;", 7, {0x2035, 0x0000}},
+  {"rsquor;", 7, {0x2019, 0x0000}},
+  {"nGt;", 4, {0x226B, 0x20D2}},
+  {"MediumSpace;", 12, {0x205F, 0x0000}},
+  {"Longleftrightarrow;", 19, {0x27FA, 0x0000}},
+  {"npar;", 5, {0x2226, 0x0000}},
+  {"dollar;", 7, {0x0024, 0x0000}},
+  {"boxUL;", 6, {0x255D, 0x0000}},
+  {"Sum;", 4, {0x2211, 0x0000}},
+  {"comma;", 6, {0x002C, 0x0000}},
+  {"Lopf;", 5, {0x1D543, 0x0000}},
+  {"nisd;", 5, {0x22FA, 0x0000}},
+  {"ngeq;", 5, {0x2271, 0x0000}},
+  {"varsupsetneqq;", 14, {0x2ACC, 0xFE00}},
+  {"gescc;", 6, {0x2AA9, 0x0000}},
+  {"LeftFloor;", 10, {0x230A, 0x0000}},
+  {"rightrightarrows;", 17, {0x21C9, 0x0000}},
+  {"ngt;", 4, {0x226F, 0x0000}},
+  {"tscy;", 5, {0x0446, 0x0000}},
+  {"Therefore;", 10, {0x2234, 0x0000}},
+  {"supset;", 7, {0x2283, 0x0000}},
+  {"Sup;", 4, {0x22D1, 0x0000}},
+  {"succ;", 5, {0x227B, 0x0000}},
+  {"frac38;", 7, {0x215C, 0x0000}},
+  {"rightleftarrows;", 16, {0x21C4, 0x0000}},
+  {"AElig;", 6, {0x00C6, 0x0000}},
+  {"Dashv;", 6, {0x2AE4, 0x0000}},
+  {"boxh;", 5, {0x2500, 0x0000}},
+  {"Ncedil;", 7, {0x0145, 0x0000}},
+  {"image;", 6, {0x2111, 0x0000}},
+  {"SHcy;", 5, {0x0428, 0x0000}},
+  {"seArr;", 6, {0x21D8, 0x0000}},
+  {"ldquo;", 6, {0x201C, 0x0000}},
+  {"dbkarow;", 8, {0x290F, 0x0000}},
+  {"ulcrop;", 7, {0x230F, 0x0000}},
+  {"lcy;", 4, {0x043B, 0x0000}},
+  {"suplarr;", 8, {0x297B, 0x0000}},
+  {"times", 5, {0x00D7, 0x0000}},
+  {"trpezium;", 9, {0x23E2, 0x0000}},
+  {"malt;", 5, {0x2720, 0x0000}},
+  {"lscr;", 5, {0x1D4C1, 0x0000}},
+  {"doteq;", 6, {0x2250, 0x0000}},
+  {"upsilon;", 8, {0x03C5, 0x0000}},
+  {"coprod;", 7, {0x2210, 0x0000}},
+  {"Iacute;", 7, {0x00CD, 0x0000}},
+  {"sup3", 4, {0x00B3, 0x0000}},
+  {"Downarrow;", 10, {0x21D3, 0x0000}},
+  {"nopf;", 5, {0x1D55F, 0x0000}},
+  {"zscr;", 5, {0x1D4CF, 0x0000}},
+  {"rrarr;", 6, {0x21C9, 0x0000}},
+  {"LessTilde;", 10, {0x2272, 0x0000}},
+  {"Scirc;", 6, {0x015C, 0x0000}},
+  {"lfloor;", 7, {0x230A, 0x0000}},
+  {"notniva;", 8, {0x220C, 0x0000}},
+  {"prE;", 4, {0x2AB3, 0x0000}},
+  {"rsqb;", 5, {0x005D, 0x0000}},
+  {"lopf;", 5, {0x1D55D, 0x0000}},
+  {"maltese;", 8, {0x2720, 0x0000}},
+  {"Cconint;", 8, {0x2230, 0x0000}},
+  {"phi;", 4, {0x03C6, 0x0000}},
+  {"orarr;", 6, {0x21BB, 0x0000}},
+  {"Omicron;", 8, {0x039F, 0x0000}},
+  {"ropar;", 6, {0x2986, 0x0000}},
+  {"Tau;", 4, {0x03A4, 0x0000}},
+  {"RightTeeVector;", 15, {0x295B, 0x0000}},
+  {"plusb;", 6, {0x229E, 0x0000}},
+  {"euro;", 5, {0x20AC, 0x0000}},
+  {"RightDownVector;", 16, {0x21C2, 0x0000}},
+  {"Aopf;", 5, {0x1D538, 0x0000}},
+  {"Kcedil;", 7, {0x0136, 0x0000}},
+  {"olt;", 4, {0x29C0, 0x0000}},
+  {"weierp;", 7, {0x2118, 0x0000}},
+  {"zwnj;", 5, {0x200C, 0x0000}},
+  {"AMP;", 4, {0x0026, 0x0000}},
+  {"Lcaron;", 7, {0x013D, 0x0000}},
+  {"capcup;", 7, {0x2A47, 0x0000}},
+  {"Supset;", 7, {0x22D1, 0x0000}},
+  {"NotLeftTriangle;", 16, {0x22EA, 0x0000}},
+  {"wscr;", 5, {0x1D4CC, 0x0000}},
+  {"imath;", 6, {0x0131, 0x0000}},
+  {"Wfr;", 4, {0x1D51A, 0x0000}},
+  {"NotRightTriangleBar;", 20, {0x29D0, 0x0338}},
+  {"copy", 4, {0x00A9, 0x0000}},
+  {"NotGreaterLess;", 15, {0x2279, 0x0000}},
+  {"ImaginaryI;", 11, {0x2148, 0x0000}},
+  {"dzcy;", 5, {0x045F, 0x0000}},
+  {"NotSquareSubsetEqual;", 21, {0x22E2, 0x0000}},
+  {"Beta;", 5, {0x0392, 0x0000}},
+  {"nsubE;", 6, {0x2AC5, 0x0338}},
+  {"Ubreve;", 7, {0x016C, 0x0000}},
+  {"supseteq;", 9, {0x2287, 0x0000}},
+  {"NotGreaterTilde;", 16, {0x2275, 0x0000}},
+  {"csupe;", 6, {0x2AD2, 0x0000}},
+  {"smallsetminus;", 14, {0x2216, 0x0000}},
+  {"VerticalLine;", 13, {0x007C, 0x0000}},
+  {"xcap;", 5, {0x22C2, 0x0000}},
+  {"rhov;", 5, {0x03F1, 0x0000}},
+  {"oast;", 5, {0x229B, 0x0000}},
+  {"ecy;", 4, {0x044D, 0x0000}},
+  {"boxvl;", 6, {0x2524, 0x0000}},
+  {"triplus;", 8, {0x2A39, 0x0000}},
+  {"dharl;", 6, {0x21C3, 0x0000}},
+  {"iexcl", 5, {0x00A1, 0x0000}},
+  {"ratail;", 7, {0x291A, 0x0000}},
+  {"angmsdaa;", 9, {0x29A8, 0x0000}},
+  {"lesseqgtr;", 10, {0x22DA, 0x0000}},
+  {"rarrap;", 7, {0x2975, 0x0000}},
+  {"dotsquare;", 10, {0x22A1, 0x0000}},
+  {"mp;", 3, {0x2213, 0x0000}},
+  {"capbrcup;", 9, {0x2A49, 0x0000}},
+  {"micro", 5, {0x00B5, 0x0000}},
+  {"eparsl;", 7, {0x29E3, 0x0000}},
+  {"ape;", 4, {0x224A, 0x0000}},
+  {"ubreve;", 7, {0x016D, 0x0000}},
+  {"bnot;", 5, {0x2310, 0x0000}},
+  {"lmoust;", 7, {0x23B0, 0x0000}},
+  {"boxUl;", 6, {0x255C, 0x0000}},
+  {"bigstar;", 8, {0x2605, 0x0000}},
+  {"uml;", 4, {0x00A8, 0x0000}},
+  {"scnap;", 6, {0x2ABA, 0x0000}},
+  {"trianglelefteq;", 15, {0x22B4, 0x0000}},
+  {"Ccirc;", 6, {0x0108, 0x0000}},
+  {"VDash;", 6, {0x22AB, 0x0000}},
+  {"aogon;", 6, {0x0105, 0x0000}},
+  {"mapstoup;", 9, {0x21A5, 0x0000}},
+  {"NotCupCap;", 10, {0x226D, 0x0000}},
+  {"swarhk;", 7, {0x2926, 0x0000}},
+  {"RuleDelayed;", 12, {0x29F4, 0x0000}},
+  {"frac58;", 7, {0x215D, 0x0000}},
+  {"SucceedsTilde;", 14, {0x227F, 0x0000}},
+  {"emptyv;", 7, {0x2205, 0x0000}},
+  {"lbrke;", 6, {0x298B, 0x0000}},
+  {"aring", 5, {0x00E5, 0x0000}},
+  {"simgE;", 6, {0x2AA0, 0x0000}},
+  {"HARDcy;", 7, {0x042A, 0x0000}},
+  {"NotTildeEqual;", 14, {0x2244, 0x0000}},
+  {"boxH;", 5, {0x2550, 0x0000}},
+  {"gtrapprox;", 10, {0x2A86, 0x0000}},
+  {"ZeroWidthSpace;", 15, {0x200B, 0x0000}},
+  {"sqsup;", 6, {0x2290, 0x0000}},
+  {"bkarow;", 7, {0x290D, 0x0000}},
+  {"intercal;", 9, {0x22BA, 0x0000}},
+  {"eqslantgtr;", 11, {0x2A96, 0x0000}},
+  {"tau;", 4, {0x03C4, 0x0000}},
+  {"rmoustache;", 11, {0x23B1, 0x0000}},
+  {"Wedge;", 6, {0x22C0, 0x0000}},
+  {"curvearrowright;", 16, {0x21B7, 0x0000}},
+  {"vzigzag;", 8, {0x299A, 0x0000}},
+  {"check;", 6, {0x2713, 0x0000}},
+  {"tint;", 5, {0x222D, 0x0000}},
+  {"rharul;", 7, {0x296C, 0x0000}},
+  {"scpolint;", 9, {0x2A13, 0x0000}},
+  {"Lleftarrow;", 11, {0x21DA, 0x0000}},
+  {"Hfr;", 4, {0x210C, 0x0000}},
+  {"efDot;", 6, {0x2252, 0x0000}},
+  {"NotLeftTriangleBar;", 19, {0x29CF, 0x0338}},
+  {"Dcaron;", 7, {0x010E, 0x0000}},
+  {"varkappa;", 9, {0x03F0, 0x0000}},
+  {"DoubleRightTee;", 15, {0x22A8, 0x0000}},
+  {"thksim;", 7, {0x223C, 0x0000}},
+  {"bigoplus;", 9, {0x2A01, 0x0000}},
+  {"CloseCurlyDoubleQuote;", 22, {0x201D, 0x0000}},
+  {"Bumpeq;", 7, {0x224E, 0x0000}},
+  {"leftleftarrows;", 15, {0x21C7, 0x0000}},
+  {"cscr;", 5, {0x1D4B8, 0x0000}},
+  {"NotLessTilde;", 13, {0x2274, 0x0000}},
+  {"Utilde;", 7, {0x0168, 0x0000}},
+  {"nvrtrie;", 8, {0x22B5, 0x20D2}},
+  {"yfr;", 4, {0x1D536, 0x0000}},
+  {"NotSquareSupersetEqual;", 23, {0x22E3, 0x0000}},
+  {"cylcty;", 7, {0x232D, 0x0000}},
+  {"Leftarrow;", 10, {0x21D0, 0x0000}},
+  {"Chi;", 4, {0x03A7, 0x0000}},
+  {"target;", 7, {0x2316, 0x0000}},
+  {"triminus;", 9, {0x2A3A, 0x0000}},
+  {"roarr;", 6, {0x21FE, 0x0000}},
+  {"rpargt;", 7, {0x2994, 0x0000}},
+  {"topcir;", 7, {0x2AF1, 0x0000}},
+  {"topfork;", 8, {0x2ADA, 0x0000}},
+  {"Ll;", 3, {0x22D8, 0x0000}},
+  {"quot;", 5, {0x0022, 0x0000}},
+  {"atilde;", 7, {0x00E3, 0x0000}},
+  {"xfr;", 4, {0x1D535, 0x0000}},
+  {"ord;", 4, {0x2A5D, 0x0000}},
+  {"yacute;", 7, {0x00FD, 0x0000}},
+  {"Aogon;", 6, {0x0104, 0x0000}},
+  {"Dopf;", 5, {0x1D53B, 0x0000}},
+  {"acE;", 4, {0x223E, 0x0333}},
+  {"hksearow;", 9, {0x2925, 0x0000}},
+  {"lBarr;", 6, {0x290E, 0x0000}},
+  {"Sscr;", 5, {0x1D4AE, 0x0000}},
+  {"YIcy;", 5, {0x0407, 0x0000}},
+  {"OverBrace;", 10, {0x23DE, 0x0000}},
+  {"eogon;", 6, {0x0119, 0x0000}},
+  {"larrsim;", 8, {0x2973, 0x0000}},
+  {"rang;", 5, {0x27E9, 0x0000}},
+  {"brvbar", 6, {0x00A6, 0x0000}},
+  {"nsube;", 6, {0x2288, 0x0000}},
+  {"cuvee;", 6, {0x22CE, 0x0000}},
+  {"iprod;", 6, {0x2A3C, 0x0000}},
+  {"upsi;", 5, {0x03C5, 0x0000}},
+  {"bigsqcup;", 9, {0x2A06, 0x0000}},
+  {"icirc;", 6, {0x00EE, 0x0000}},
+  {"kopf;", 5, {0x1D55C, 0x0000}},
+  {"boxuR;", 6, {0x2558, 0x0000}},
+  {"softcy;", 7, {0x044C, 0x0000}},
+  {"oline;", 6, {0x203E, 0x0000}},
+  {"cupbrcap;", 9, {0x2A48, 0x0000}},
+  {"lsim;", 5, {0x2272, 0x0000}},
+  {"ldrdhar;", 8, {0x2967, 0x0000}},
+  {"swArr;", 6, {0x21D9, 0x0000}},
+  {"nleqq;", 6, {0x2266, 0x0338}},
+  {"hookrightarrow;", 15, {0x21AA, 0x0000}},
+  {"Scaron;", 7, {0x0160, 0x0000}},
+  {"lsh;", 4, {0x21B0, 0x0000}},
+  {"Iogon;", 6, {0x012E, 0x0000}},
+  {"nvge;", 5, {0x2265, 0x20D2}},
+  {"DoubleLongRightArrow;", 21, {0x27F9, 0x0000}},
+  {"lsime;", 6, {0x2A8D, 0x0000}},
+  {"xoplus;", 7, {0x2A01, 0x0000}},
+  {"ForAll;", 7, {0x2200, 0x0000}},
+  {"ic;", 3, {0x2063, 0x0000}},
+  {"infintie;", 9, {0x29DD, 0x0000}},
+  {"OpenCurlyDoubleQuote;", 21, {0x201C, 0x0000}},
+  {"subdot;", 7, {0x2ABD, 0x0000}},
+  {"harr;", 5, {0x2194, 0x0000}},
+  {"lAtail;", 7, {0x291B, 0x0000}},
+  {"and;", 4, {0x2227, 0x0000}},
+  {"gel;", 4, {0x22DB, 0x0000}},
+  {"boxVL;", 6, {0x2563, 0x0000}},
+  {"angrtvbd;", 9, {0x299D, 0x0000}},
+  {"pointint;", 9, {0x2A15, 0x0000}},
+  {"oopf;", 5, {0x1D560, 0x0000}},
+  {"nldr;", 5, {0x2025, 0x0000}},
+  {"lsquo;", 6, {0x2018, 0x0000}},
+  {"Darr;", 5, {0x21A1, 0x0000}},
+  {"gvertneqq;", 10, {0x2269, 0xFE00}},
+  {"colone;", 7, {0x2254, 0x0000}},
+  {"Vdashl;", 7, {0x2AE6, 0x0000}},
+  {"NotElement;", 11, {0x2209, 0x0000}},
+  {"DiacriticalGrave;", 17, {0x0060, 0x0000}},
+  {"emsp14;", 7, {0x2005, 0x0000}},
+  {"swarrow;", 8, {0x2199, 0x0000}},
+  {"ldquor;", 7, {0x201E, 0x0000}},
+  {"cupor;", 6, {0x2A45, 0x0000}},
+  {"AMP", 3, {0x0026, 0x0000}},
+  {"grave;", 6, {0x0060, 0x0000}},
+  {"rfisht;", 7, {0x297D, 0x0000}},
+  {"pound", 5, {0x00A3, 0x0000}},
+  {"hbar;", 5, {0x210F, 0x0000}},
+  {"utri;", 5, {0x25B5, 0x0000}},
+  {"RightAngleBracket;", 18, {0x27E9, 0x0000}},
+  {"downarrow;", 10, {0x2193, 0x0000}},
+  {"pertenk;", 8, {0x2031, 0x0000}},
+  {"cupcap;", 7, {0x2A46, 0x0000}},
+  {"Ntilde", 6, {0x00D1, 0x0000}},
+  {"hstrok;", 7, {0x0127, 0x0000}},
+  {"phone;", 6, {0x260E, 0x0000}},
+  {"lbarr;", 6, {0x290C, 0x0000}},
+  {"subsup;", 7, {0x2AD3, 0x0000}},
+  {"rtri;", 5, {0x25B9, 0x0000}},
+  {"succnapprox;", 12, {0x2ABA, 0x0000}},
+  {"GJcy;", 5, {0x0403, 0x0000}},
+  {"beta;", 5, {0x03B2, 0x0000}},
+  {"Egrave", 6, {0x00C8, 0x0000}},
+  {"caron;", 6, {0x02C7, 0x0000}},
+  {"HorizontalLine;", 15, {0x2500, 0x0000}},
+  {"intprod;", 8, {0x2A3C, 0x0000}},
+  {"subseteqq;", 10, {0x2AC5, 0x0000}},
+  {"midcir;", 7, {0x2AF0, 0x0000}},
+  {"dscy;", 5, {0x0455, 0x0000}},
+  {"Theta;", 6, {0x0398, 0x0000}},
+  {"Square;", 7, {0x25A1, 0x0000}},
+  {"sopf;", 5, {0x1D564, 0x0000}},
+  {"supseteqq;", 10, {0x2AC6, 0x0000}},
+  {"NotPrecedesSlantEqual;", 22, {0x22E0, 0x0000}},
+  {"VerticalBar;", 12, {0x2223, 0x0000}},
+  {"thickapprox;", 12, {0x2248, 0x0000}},
+  {"integers;", 9, {0x2124, 0x0000}},
+  {"eqslantless;", 12, {0x2A95, 0x0000}},
+  {"uhblk;", 6, {0x2580, 0x0000}},
+  {"TildeFullEqual;", 15, {0x2245, 0x0000}},
+  {"DoubleContourIntegral;", 22, {0x222F, 0x0000}},
+  {"iocy;", 5, {0x0451, 0x0000}},
+  {"NotGreaterSlantEqual;", 21, {0x2A7E, 0x0338}},
+  {"frac14", 6, {0x00BC, 0x0000}},
+  {"SquareIntersection;", 19, {0x2293, 0x0000}},
+  {"late;", 5, {0x2AAD, 0x0000}},
+  {"squ;", 4, {0x25A1, 0x0000}},
+  {"Cacute;", 7, {0x0106, 0x0000}},
+  {"nvltrie;", 8, {0x22B4, 0x20D2}},
+  {"uscr;", 5, {0x1D4CA, 0x0000}},
+  {"omicron;", 8, {0x03BF, 0x0000}},
+  {"isins;", 6, {0x22F4, 0x0000}},
+  {"boxHu;", 6, {0x2567, 0x0000}},
+  {"xscr;", 5, {0x1D4CD, 0x0000}},
+  {"vee;", 4, {0x2228, 0x0000}},
+  {"AElig", 5, {0x00C6, 0x0000}},
+  {"Rightarrow;", 11, {0x21D2, 0x0000}},
+  {"simg;", 5, {0x2A9E, 0x0000}},
+  {"toea;", 5, {0x2928, 0x0000}},
+  {"DoubleUpDownArrow;", 18, {0x21D5, 0x0000}},
+  {"vDash;", 6, {0x22A8, 0x0000}},
+  {"umacr;", 6, {0x016B, 0x0000}},
+  {"Acirc;", 6, {0x00C2, 0x0000}},
+  {"euml;", 5, {0x00EB, 0x0000}},
+  {"Mu;", 3, {0x039C, 0x0000}},
+  {"uuml;", 5, {0x00FC, 0x0000}},
+  {"FilledVerySmallSquare;", 22, {0x25AA, 0x0000}},
+  {"ltrif;", 6, {0x25C2, 0x0000}},
+  {"sub;", 4, {0x2282, 0x0000}},
+  {"dfr;", 4, {0x1D521, 0x0000}},
+  {"zcaron;", 7, {0x017E, 0x0000}},
+  {"ENG;", 4, {0x014A, 0x0000}},
+  {"ordf;", 5, {0x00AA, 0x0000}},
+  {"capcap;", 7, {0x2A4B, 0x0000}},
+  {"shchcy;", 7, {0x0449, 0x0000}},
+  {"equest;", 7, {0x225F, 0x0000}},
+  {"Icirc", 5, {0x00CE, 0x0000}},
+  {"Qfr;", 4, {0x1D514, 0x0000}},
+  {"gcy;", 4, {0x0433, 0x0000}},
+  {"uuml", 4, {0x00FC, 0x0000}},
+  {"DoubleRightArrow;", 17, {0x21D2, 0x0000}},
+  {"gsiml;", 6, {0x2A90, 0x0000}},
+  {"gtquest;", 8, {0x2A7C, 0x0000}},
+  {"rdsh;", 5, {0x21B3, 0x0000}},
+  {"ldsh;", 5, {0x21B2, 0x0000}},
+  {"SOFTcy;", 7, {0x042C, 0x0000}},
+  {"lE;", 3, {0x2266, 0x0000}},
+  {"Uarrocir;", 9, {0x2949, 0x0000}},
+  {"Barv;", 5, {0x2AE7, 0x0000}},
+  {"measuredangle;", 14, {0x2221, 0x0000}},
+  {"Ouml", 4, {0x00D6, 0x0000}},
+  {"wopf;", 5, {0x1D568, 0x0000}},
+  {"COPY", 4, {0x00A9, 0x0000}},
+  {"gne;", 4, {0x2A88, 0x0000}},
+  {"laquo;", 6, {0x00AB, 0x0000}},
+  {"orslope;", 8, {0x2A57, 0x0000}},
+  {"nrtri;", 6, {0x22EB, 0x0000}},
+  {"DownTeeArrow;", 13, {0x21A7, 0x0000}},
+  {"sce;", 4, {0x2AB0, 0x0000}},
+  {"hslash;", 7, {0x210F, 0x0000}},
+  {"NotTildeFullEqual;", 18, {0x2247, 0x0000}},
+  {"succneqq;", 9, {0x2AB6, 0x0000}},
+  {"thorn", 5, {0x00FE, 0x0000}},
+  {"iuml", 4, {0x00EF, 0x0000}},
+  {"breve;", 6, {0x02D8, 0x0000}},
+  {"ohbar;", 6, {0x29B5, 0x0000}},
+  {"barwed;", 7, {0x2305, 0x0000}},
+  {"DoubleUpArrow;", 14, {0x21D1, 0x0000}},
+  {"solb;", 5, {0x29C4, 0x0000}},
+  {"sqcaps;", 7, {0x2293, 0xFE00}},
+  {"ssetmn;", 7, {0x2216, 0x0000}},
+  {"aacute", 6, {0x00E1, 0x0000}},
+  {"gtlPar;", 7, {0x2995, 0x0000}},
+  {"PrecedesTilde;", 14, {0x227E, 0x0000}},
+  {"gvnE;", 5, {0x2269, 0xFE00}},
+  {"mumap;", 6, {0x22B8, 0x0000}},
+  {"cent;", 5, {0x00A2, 0x0000}},
+  {"backprime;", 10, {0x2035, 0x0000}},
+  {"angmsdae;", 9, {0x29AC, 0x0000}},
+  {"straightepsilon;", 16, {0x03F5, 0x0000}},
+  {"epsilon;", 8, {0x03B5, 0x0000}},
+  {"nang;", 5, {0x2220, 0x20D2}},
+  {"Kcy;", 4, {0x041A, 0x0000}},
+  {"circledR;", 9, {0x00AE, 0x0000}},
+  {"nvinfin;", 8, {0x29DE, 0x0000}},
+  {"diamond;", 8, {0x22C4, 0x0000}},
+  {"SmallCircle;", 12, {0x2218, 0x0000}},
+  {"triangleleft;", 13, {0x25C3, 0x0000}},
+  {"dstrok;", 7, {0x0111, 0x0000}},
+  {"frac13;", 7, {0x2153, 0x0000}},
+  {"notindot;", 9, {0x22F5, 0x0338}},
+  {"curren", 6, {0x00A4, 0x0000}},
+  {"dHar;", 5, {0x2965, 0x0000}},
+  {"xvee;", 5, {0x22C1, 0x0000}},
+  {"ngsim;", 6, {0x2275, 0x0000}},
+  {"Eopf;", 5, {0x1D53C, 0x0000}},
+  {"top;", 4, {0x22A4, 0x0000}},
+  {"rcub;", 5, {0x007D, 0x0000}},
+  {"origof;", 7, {0x22B6, 0x0000}},
+  {"ndash;", 6, {0x2013, 0x0000}},
+  {"nexists;", 8, {0x2204, 0x0000}},
+  {"lsaquo;", 7, {0x2039, 0x0000}},
+  {"gla;", 4, {0x2AA5, 0x0000}},
+  {"supdsub;", 8, {0x2AD8, 0x0000}},
+  {"OverBar;", 8, {0x203E, 0x0000}},
+  {"iiiint;", 7, {0x2A0C, 0x0000}},
+  {"tdot;", 5, {0x20DB, 0x0000}},
+  {"varsubsetneqq;", 14, {0x2ACB, 0xFE00}},
+  {"NegativeMediumSpace;", 20, {0x200B, 0x0000}},
+  {"rbarr;", 6, {0x290D, 0x0000}},
+  {"trade;", 6, {0x2122, 0x0000}},
+  {"Lmidot;", 7, {0x013F, 0x0000}},
+  {"Upsilon;", 8, {0x03A5, 0x0000}},
+  {"Nacute;", 7, {0x0143, 0x0000}},
+  {"bigcirc;", 8, {0x25EF, 0x0000}},
+  {"mnplus;", 7, {0x2213, 0x0000}},
+  {"fcy;", 4, {0x0444, 0x0000}},
+  {"downdownarrows;", 15, {0x21CA, 0x0000}},
+  {"bigvee;", 7, {0x22C1, 0x0000}},
+  {"plustwo;", 8, {0x2A27, 0x0000}},
+  {"NotSquareSuperset;", 18, {0x2290, 0x0338}},
+  {"DownRightTeeVector;", 19, {0x295F, 0x0000}},
+  {"larrlp;", 7, {0x21AB, 0x0000}},
+  {"star;", 5, {0x2606, 0x0000}},
+  {"subset;", 7, {0x2282, 0x0000}},
+  {"lnE;", 4, {0x2268, 0x0000}},
+  {"vsubne;", 7, {0x228A, 0xFE00}},
+  {"xmap;", 5, {0x27FC, 0x0000}},
+  {"LongLeftRightArrow;", 19, {0x27F7, 0x0000}},
+  {"drcorn;", 7, {0x231F, 0x0000}},
+  {"fflig;", 6, {0xFB00, 0x0000}},
+  {"Acy;", 4, {0x0410, 0x0000}},
+  {"ljcy;", 5, {0x0459, 0x0000}},
+  {"ulcorner;", 9, {0x231C, 0x0000}},
+  {"quaternions;", 12, {0x210D, 0x0000}},
+  {"cirscir;", 8, {0x29C2, 0x0000}},
+  {"demptyv;", 8, {0x29B1, 0x0000}},
+  {"ge;", 3, {0x2265, 0x0000}},
+  {"sect", 4, {0x00A7, 0x0000}},
+  {"cuesc;", 6, {0x22DF, 0x0000}},
+  {"sigma;", 6, {0x03C3, 0x0000}},
+  {"QUOT", 4, {0x0022, 0x0000}},
+  {"frac56;", 7, {0x215A, 0x0000}},
+  {"lesdot;", 7, {0x2A7F, 0x0000}},
+  {"boxVH;", 6, {0x256C, 0x0000}},
+  {"brvbar;", 7, {0x00A6, 0x0000}},
+  {"bigotimes;", 10, {0x2A02, 0x0000}},
+  {"UnderBracket;", 13, {0x23B5, 0x0000}},
+  {"Dscr;", 5, {0x1D49F, 0x0000}},
+  {"orv;", 4, {0x2A5B, 0x0000}},
+  {"Dcy;", 4, {0x0414, 0x0000}},
+  {"lopar;", 6, {0x2985, 0x0000}},
+  {"Ouml;", 5, {0x00D6, 0x0000}},
+  {"Gfr;", 4, {0x1D50A, 0x0000}},
+  {"nlArr;", 6, {0x21CD, 0x0000}},
+  {"zopf;", 5, {0x1D56B, 0x0000}},
+  {"veebar;", 7, {0x22BB, 0x0000}},
+  {"SucceedsEqual;", 14, {0x2AB0, 0x0000}},
+  {"lessapprox;", 11, {0x2A85, 0x0000}},
+  {"subsetneqq;", 11, {0x2ACB, 0x0000}},
+  {"iiint;", 6, {0x222D, 0x0000}},
+  {"Tcy;", 4, {0x0422, 0x0000}},
+  {"DoubleVerticalBar;", 18, {0x2225, 0x0000}},
+  {"imagline;", 9, {0x2110, 0x0000}},
+  {"amacr;", 6, {0x0101, 0x0000}},
+  {"nlarr;", 6, {0x219A, 0x0000}},
+  {"dharr;", 6, {0x21C2, 0x0000}},
+  {"puncsp;", 7, {0x2008, 0x0000}},
+  {"cwint;", 6, {0x2231, 0x0000}},
+  {"bigcap;", 7, {0x22C2, 0x0000}},
+  {"block;", 6, {0x2588, 0x0000}},
+  {"boxul;", 6, {0x2518, 0x0000}},
+  {"dcy;", 4, {0x0434, 0x0000}},
+  {"inodot;", 7, {0x0131, 0x0000}},
+  {"para", 4, {0x00B6, 0x0000}},
+  {"egrave;", 7, {0x00E8, 0x0000}},
+  {"lesges;", 7, {0x2A93, 0x0000}},
+  {"vBar;", 5, {0x2AE8, 0x0000}},
+  {"imof;", 5, {0x22B7, 0x0000}},
+  {"lcaron;", 7, {0x013E, 0x0000}},
+  {"LeftDownTeeVector;", 18, {0x2961, 0x0000}},
+  {"vcy;", 4, {0x0432, 0x0000}},
+  {"xwedge;", 7, {0x22C0, 0x0000}},
+  {"fltns;", 6, {0x25B1, 0x0000}},
+  {"frac18;", 7, {0x215B, 0x0000}},
+  {"comp;", 5, {0x2201, 0x0000}},
+  {"iota;", 5, {0x03B9, 0x0000}},
+  {"Agrave", 6, {0x00C0, 0x0000}},
+  {"doteqdot;", 9, {0x2251, 0x0000}},
+  {"uHar;", 5, {0x2963, 0x0000}},
+  {"map;", 4, {0x21A6, 0x0000}},
+  {"xi;", 3, {0x03BE, 0x0000}},
+  {"divonx;", 7, {0x22C7, 0x0000}},
+  {"lcedil;", 7, {0x013C, 0x0000}},
+  {"backsimeq;", 10, {0x22CD, 0x0000}},
+  {"yucy;", 5, {0x044E, 0x0000}},
+  {"xrarr;", 6, {0x27F6, 0x0000}},
+  {"dtrif;", 6, {0x25BE, 0x0000}},
+  {"vartriangleright;", 17, {0x22B3, 0x0000}},
+  {"lsquor;", 7, {0x201A, 0x0000}},
+  {"nis;", 4, {0x22FC, 0x0000}},
+  {"ufr;", 4, {0x1D532, 0x0000}},
+  {"lEg;", 4, {0x2A8B, 0x0000}},
+  {"Barwed;", 7, {0x2306, 0x0000}},
+  {"lobrk;", 6, {0x27E6, 0x0000}},
+  {"LongRightArrow;", 15, {0x27F6, 0x0000}},
+  {"wedge;", 6, {0x2227, 0x0000}},
+  {"Cayleys;", 8, {0x212D, 0x0000}},
+  {"NegativeVeryThinSpace;", 22, {0x200B, 0x0000}},
+  {"Fscr;", 5, {0x2131, 0x0000}},
+  {"erarr;", 6, {0x2971, 0x0000}},
+  {"llhard;", 7, {0x296B, 0x0000}},
+  {"DiacriticalDot;", 15, {0x02D9, 0x0000}},
+  {"UnionPlus;", 10, {0x228E, 0x0000}},
+  {"egs;", 4, {0x2A96, 0x0000}},
+  {"oplus;", 6, {0x2295, 0x0000}},
+  {"Fouriertrf;", 11, {0x2131, 0x0000}},
+  {"Cup;", 4, {0x22D3, 0x0000}},
+  {"Tab;", 4, {0x0009, 0x0000}},
+  {"csub;", 5, {0x2ACF, 0x0000}},
+  {"DownBreve;", 10, {0x0311, 0x0000}},
+  {"le;", 3, {0x2264, 0x0000}},
+  {"napprox;", 8, {0x2249, 0x0000}},
+  {"gtrless;", 8, {0x2277, 0x0000}},
+  {"szlig;", 6, {0x00DF, 0x0000}},
+  {"lt", 2, {0x003C, 0x0000}},
+  {"looparrowright;", 15, {0x21AC, 0x0000}},
+  {"OverBracket;", 12, {0x23B4, 0x0000}},
+  {"nshortmid;", 10, {0x2224, 0x0000}},
+  {"amp", 3, {0x0026, 0x0000}},
+  {"andand;", 7, {0x2A55, 0x0000}},
+  {"gtrsim;", 7, {0x2273, 0x0000}},
+  {"Popf;", 5, {0x2119, 0x0000}},
+  {"xlarr;", 6, {0x27F5, 0x0000}},
+  {"rightharpoonup;", 15, {0x21C0, 0x0000}},
+  {"cedil;", 6, {0x00B8, 0x0000}},
+  {"natural;", 8, {0x266E, 0x0000}},
+  {"plusmn;", 7, {0x00B1, 0x0000}},
+  {"gsime;", 6, {0x2A8E, 0x0000}},
+  {"downharpoonleft;", 16, {0x21C3, 0x0000}},
+  {"Re;", 3, {0x211C, 0x0000}},
+  {"geqslant;", 9, {0x2A7E, 0x0000}},
+  {"cupcup;", 7, {0x2A4A, 0x0000}},
+  {"nscr;", 5, {0x1D4C3, 0x0000}},
+  {"nedot;", 6, {0x2250, 0x0338}},
+  {"bnequiv;", 8, {0x2261, 0x20E5}},
+  {"laquo", 5, {0x00AB, 0x0000}},
+  {"trianglerighteq;", 16, {0x22B5, 0x0000}},
+  {"parallel;", 9, {0x2225, 0x0000}},
+  {"qint;", 5, {0x2A0C, 0x0000}},
+  {"supne;", 6, {0x228B, 0x0000}},
+  {"hfr;", 4, {0x1D525, 0x0000}},
+  {"varsigma;", 9, {0x03C2, 0x0000}},
+  {"RightTee;", 9, {0x22A2, 0x0000}},
+  {"kcedil;", 7, {0x0137, 0x0000}},
+  {"rarrfs;", 7, {0x291E, 0x0000}},
+  {"pitchfork;", 10, {0x22D4, 0x0000}},
+  {"lagran;", 7, {0x2112, 0x0000}},
+  {"UpArrow;", 8, {0x2191, 0x0000}},
+  {"harrcir;", 8, {0x2948, 0x0000}},
+  {"Mcy;", 4, {0x041C, 0x0000}},
+  {"qfr;", 4, {0x1D52E, 0x0000}},
+  {"frac14;", 7, {0x00BC, 0x0000}},
+  {"sstarf;", 7, {0x22C6, 0x0000}},
+  {"Psi;", 4, {0x03A8, 0x0000}},
+  {"dscr;", 5, {0x1D4B9, 0x0000}},
+  {"lates;", 6, {0x2AAD, 0xFE00}},
+  {"NotSuperset;", 12, {0x2283, 0x20D2}},
+  {"GT;", 3, {0x003E, 0x0000}},
+  {"Epsilon;", 8, {0x0395, 0x0000}},
+  {"zeta;", 5, {0x03B6, 0x0000}},
+  {"cupdot;", 7, {0x228D, 0x0000}},
+  {"RoundImplies;", 13, {0x2970, 0x0000}},
+  {"CloseCurlyQuote;", 16, {0x2019, 0x0000}},
+  {"DownRightVector;", 16, {0x21C1, 0x0000}},
+  {"precsim;", 8, {0x227E, 0x0000}},
+  {"ShortLeftArrow;", 15, {0x2190, 0x0000}},
+  {"DoubleDownArrow;", 16, {0x21D3, 0x0000}},
+  {"succapprox;", 11, {0x2AB8, 0x0000}},
+  {"abreve;", 7, {0x0103, 0x0000}},
+  {"lrcorner;", 9, {0x231F, 0x0000}},
+  {"gesl;", 5, {0x22DB, 0xFE00}},
+  {"ocy;", 4, {0x043E, 0x0000}},
+  {"nexist;", 7, {0x2204, 0x0000}},
+  {"popf;", 5, {0x1D561, 0x0000}},
+  {"Igrave", 6, {0x00CC, 0x0000}},
+  {"NotGreaterFullEqual;", 20, {0x2267, 0x0338}},
+  {"frac16;", 7, {0x2159, 0x0000}},
+  {"reals;", 6, {0x211D, 0x0000}},
+  {"ecolon;", 7, {0x2255, 0x0000}},
+  {"hscr;", 5, {0x1D4BD, 0x0000}},
+  {"shy", 3, {0x00AD, 0x0000}},
+  {"langd;", 6, {0x2991, 0x0000}},
+  {"Otilde;", 7, {0x00D5, 0x0000}},
+  {"bfr;", 4, {0x1D51F, 0x0000}},
+  {"sup1;", 5, {0x00B9, 0x0000}},
+  {"rtrie;", 6, {0x22B5, 0x0000}},
+  {"equivDD;", 8, {0x2A78, 0x0000}},
+  {"forkv;", 6, {0x2AD9, 0x0000}},
+  {"frac35;", 7, {0x2157, 0x0000}},
+  {"gopf;", 5, {0x1D558, 0x0000}},
+  {"uogon;", 6, {0x0173, 0x0000}},
+  {"rAarr;", 6, {0x21DB, 0x0000}},
+  {"leftarrow;", 10, {0x2190, 0x0000}},
+  {"reg;", 4, {0x00AE, 0x0000}},
+  {"sdotb;", 6, {0x22A1, 0x0000}},
+  {"dwangle;", 8, {0x29A6, 0x0000}},
+  {"lsimg;", 6, {0x2A8F, 0x0000}},
+  {"tcaron;", 7, {0x0165, 0x0000}},
+  {"Cdot;", 5, {0x010A, 0x0000}},
+  {"edot;", 5, {0x0117, 0x0000}},
+  {"NotVerticalBar;", 15, {0x2224, 0x0000}},
+  {"Jsercy;", 7, {0x0408, 0x0000}},
+  {"nearhk;", 7, {0x2924, 0x0000}},
+  {"sigmav;", 7, {0x03C2, 0x0000}},
+  {"Afr;", 4, {0x1D504, 0x0000}},
+  {"Atilde;", 7, {0x00C3, 0x0000}},
+  {"robrk;", 6, {0x27E7, 0x0000}},
+  {"semi;", 5, {0x003B, 0x0000}},
+  {"copf;", 5, {0x1D554, 0x0000}},
+  {"planckh;", 8, {0x210E, 0x0000}},
+  {"shortmid;", 9, {0x2223, 0x0000}},
+  {"diam;", 5, {0x22C4, 0x0000}},
+  {"Kopf;", 5, {0x1D542, 0x0000}},
+  {"cross;", 6, {0x2717, 0x0000}},
+  {"zfr;", 4, {0x1D537, 0x0000}},
+  {"lozf;", 5, {0x29EB, 0x0000}},
+  {"Iuml", 4, {0x00CF, 0x0000}},
+  {"circledS;", 9, {0x24C8, 0x0000}},
+  {"LeftTriangleEqual;", 18, {0x22B4, 0x0000}},
+  {"circledast;", 11, {0x229B, 0x0000}},
+  {"Ugrave", 6, {0x00D9, 0x0000}},
+  {"Euml", 4, {0x00CB, 0x0000}},
+  {"Euml;", 5, {0x00CB, 0x0000}},
+  {"xcirc;", 6, {0x25EF, 0x0000}},
+  {"numero;", 7, {0x2116, 0x0000}},
+  {"lowast;", 7, {0x2217, 0x0000}},
+  {"nleq;", 5, {0x2270, 0x0000}},
+  {"Jopf;", 5, {0x1D541, 0x0000}},
+  {"aacute;", 7, {0x00E1, 0x0000}},
+  {"topbot;", 7, {0x2336, 0x0000}},
+  {"downharpoonright;", 17, {0x21C2, 0x0000}},
+  {"SquareSuperset;", 15, {0x2290, 0x0000}},
+  {"Larr;", 5, {0x219E, 0x0000}},
+  {"gtreqqless;", 11, {0x2A8C, 0x0000}},
+  {"npr;", 4, {0x2280, 0x0000}},
+  {"Oopf;", 5, {0x1D546, 0x0000}},
+  {"subedot;", 8, {0x2AC3, 0x0000}},
+  {"ngE;", 4, {0x2267, 0x0338}},
+  {"bsim;", 5, {0x223D, 0x0000}},
+  {"uArr;", 5, {0x21D1, 0x0000}},
+  {"NotRightTriangleEqual;", 22, {0x22ED, 0x0000}},
+  {"veeeq;", 6, {0x225A, 0x0000}},
+  {"lesdoto;", 8, {0x2A81, 0x0000}},
+  {"equiv;", 6, {0x2261, 0x0000}},
+  {"zacute;", 7, {0x017A, 0x0000}},
+  {"napos;", 6, {0x0149, 0x0000}},
+  {"bsemi;", 6, {0x204F, 0x0000}},
+  {"nvlArr;", 7, {0x2902, 0x0000}},
+  {"sup3;", 5, {0x00B3, 0x0000}},
+  {"aelig", 5, {0x00E6, 0x0000}},
+  {"sqsupseteq;", 11, {0x2292, 0x0000}},
+  {"CHcy;", 5, {0x0427, 0x0000}},
+  {"jfr;", 4, {0x1D527, 0x0000}},
+  {"sect;", 5, {0x00A7, 0x0000}},
+  {"Jfr;", 4, {0x1D50D, 0x0000}},
+  {"ring;", 5, {0x02DA, 0x0000}},
+  {"DoubleDot;", 10, {0x00A8, 0x0000}},
+  {"srarr;", 6, {0x2192, 0x0000}},
+  {"checkmark;", 10, {0x2713, 0x0000}},
+  {"boxplus;", 8, {0x229E, 0x0000}},
+  {"preccurlyeq;", 12, {0x227C, 0x0000}},
+  {"sacute;", 7, {0x015B, 0x0000}},
+  {"Ograve;", 7, {0x00D2, 0x0000}},
+  {"Rfr;", 4, {0x211C, 0x0000}},
+  {"RightFloor;", 11, {0x230B, 0x0000}},
+  {"oS;", 3, {0x24C8, 0x0000}},
+  {"Odblac;", 7, {0x0150, 0x0000}},
+  {"awconint;", 9, {0x2233, 0x0000}},
+  {"llcorner;", 9, {0x231E, 0x0000}},
+  {"HilbertSpace;", 13, {0x210B, 0x0000}},
+  {"cemptyv;", 8, {0x29B2, 0x0000}},
+  {"cire;", 5, {0x2257, 0x0000}},
+  {"rarrsim;", 8, {0x2974, 0x0000}},
+  {"boxvL;", 6, {0x2561, 0x0000}},
+  {"vsupnE;", 7, {0x2ACC, 0xFE00}},
+  {"not;", 4, {0x00AC, 0x0000}},
+  {"sup1", 4, {0x00B9, 0x0000}},
+  {"rBarr;", 6, {0x290F, 0x0000}},
+  {"nspar;", 6, {0x2226, 0x0000}},
+  {"khcy;", 5, {0x0445, 0x0000}},
+  {"Del;", 4, {0x2207, 0x0000}},
+  {"LessSlantEqual;", 15, {0x2A7D, 0x0000}},
+  {"hybull;", 7, {0x2043, 0x0000}},
+  {"cuepr;", 6, {0x22DE, 0x0000}},
+  {"nLt;", 4, {0x226A, 0x20D2}},
+  {"Qscr;", 5, {0x1D4AC, 0x0000}},
+  {"lat;", 4, {0x2AAB, 0x0000}},
+  {"npreceq;", 8, {0x2AAF, 0x0338}},
+  {"LeftArrowRightArrow;", 20, {0x21C6, 0x0000}},
+  {"nrarr;", 6, {0x219B, 0x0000}},
+  {"rightarrowtail;", 15, {0x21A3, 0x0000}},
+  {"ograve;", 7, {0x00F2, 0x0000}},
+  {"ange;", 5, {0x29A4, 0x0000}},
+  {"hercon;", 7, {0x22B9, 0x0000}},
+  {"rightarrow;", 11, {0x2192, 0x0000}},
+  {"yicy;", 5, {0x0457, 0x0000}},
+  {"tfr;", 4, {0x1D531, 0x0000}},
+  {"boxhd;", 6, {0x252C, 0x0000}},
+  {"nvdash;", 7, {0x22AC, 0x0000}},
+  {"cularr;", 7, {0x21B6, 0x0000}},
+  {"xdtri;", 6, {0x25BD, 0x0000}},
+  {"supE;", 5, {0x2AC6, 0x0000}},
+  {"ShortUpArrow;", 13, {0x2191, 0x0000}},
+  {"slarr;", 6, {0x2190, 0x0000}},
+  {"CounterClockwiseContourIntegral;", 32, {0x2233, 0x0000}},
+  {"CirclePlus;", 11, {0x2295, 0x0000}},
+  {"sum;", 4, {0x2211, 0x0000}},
+  {"DiacriticalDoubleAcute;", 23, {0x02DD, 0x0000}},
+  {"succnsim;", 9, {0x22E9, 0x0000}},
+  {"niv;", 4, {0x220B, 0x0000}},
+  {"npre;", 5, {0x2AAF, 0x0338}},
+  {"ltcir;", 6, {0x2A79, 0x0000}},
+  {"Vscr;", 5, {0x1D4B1, 0x0000}},
+  {"egsdot;", 7, {0x2A98, 0x0000}},
+  {"SuchThat;", 9, {0x220B, 0x0000}},
+  {"bot;", 4, {0x22A5, 0x0000}},
+  {"VerticalTilde;", 14, {0x2240, 0x0000}},
+  {"nlsim;", 6, {0x2274, 0x0000}},
+  {"middot;", 7, {0x00B7, 0x0000}},
+  {"barwedge;", 9, {0x2305, 0x0000}},
+  {"uacute", 6, {0x00FA, 0x0000}},
+  {"exist;", 6, {0x2203, 0x0000}},
+  {"gacute;", 7, {0x01F5, 0x0000}},
+  {"frac23;", 7, {0x2154, 0x0000}},
+  {"digamma;", 8, {0x03DD, 0x0000}},
+  {"LeftTriangleBar;", 16, {0x29CF, 0x0000}},
+  {"gjcy;", 5, {0x0453, 0x0000}},
+  {"Uopf;", 5, {0x1D54C, 0x0000}},
+  {"csup;", 5, {0x2AD0, 0x0000}},
+  {"swarr;", 6, {0x2199, 0x0000}},
+  {"vprop;", 6, {0x221D, 0x0000}},
+  {"realpart;", 9, {0x211C, 0x0000}},
+  {"lltri;", 6, {0x25FA, 0x0000}},
+  {"Coproduct;", 10, {0x2210, 0x0000}},
+  {"RightUpDownVector;", 18, {0x294F, 0x0000}},
+  {"npolint;", 8, {0x2A14, 0x0000}},
+  {"conint;", 7, {0x222E, 0x0000}},
+  {"larrfs;", 7, {0x291D, 0x0000}},
+  {"rcedil;", 7, {0x0157, 0x0000}},
+  {"plusmn", 6, {0x00B1, 0x0000}},
+  {"ccupssm;", 8, {0x2A50, 0x0000}},
+  {"leftharpoondown;", 16, {0x21BD, 0x0000}},
+  {"Succeeds;", 9, {0x227B, 0x0000}},
+  {"mcy;", 4, {0x043C, 0x0000}},
+  {"ddagger;", 8, {0x2021, 0x0000}},
+  {"Superset;", 9, {0x2283, 0x0000}},
+  {"Eacute;", 7, {0x00C9, 0x0000}},
+  {"ccirc;", 6, {0x0109, 0x0000}},
+  {"nges;", 5, {0x2A7E, 0x0338}},
+  {"OverParenthesis;", 16, {0x23DC, 0x0000}},
+  {"urcorn;", 7, {0x231D, 0x0000}},
+  {"lneq;", 5, {0x2A87, 0x0000}},
+  {"icy;", 4, {0x0438, 0x0000}},
+  {"NotSucceedsTilde;", 17, {0x227F, 0x0338}},
+  {"hamilt;", 7, {0x210B, 0x0000}},
+  {"Gt;", 3, {0x226B, 0x0000}},
+  {"utrif;", 6, {0x25B4, 0x0000}},
+  {"tritime;", 8, {0x2A3B, 0x0000}},
+  {"vscr;", 5, {0x1D4CB, 0x0000}},
+  {"Uscr;", 5, {0x1D4B0, 0x0000}},
+  {"rfr;", 4, {0x1D52F, 0x0000}},
+  {"auml", 4, {0x00E4, 0x0000}},
+  {"precnsim;", 9, {0x22E8, 0x0000}},
+  {"Jscr;", 5, {0x1D4A5, 0x0000}},
+  {"smt;", 4, {0x2AAA, 0x0000}},
+  {"ReverseEquilibrium;", 19, {0x21CB, 0x0000}},
+  {"ssmile;", 7, {0x2323, 0x0000}},
+  {"yuml;", 5, {0x00FF, 0x0000}},
+  {"Gscr;", 5, {0x1D4A2, 0x0000}},
+  {"cuwed;", 6, {0x22CF, 0x0000}},
+  {"gbreve;", 7, {0x011F, 0x0000}},
+  {"capand;", 7, {0x2A44, 0x0000}},
+  {"RightUpVectorBar;", 17, {0x2954, 0x0000}},
+  {"lbrkslu;", 8, {0x298D, 0x0000}},
+  {"lfr;", 4, {0x1D529, 0x0000}},
+  {"solbar;", 7, {0x233F, 0x0000}},
+  {"searrow;", 8, {0x2198, 0x0000}},
+  {"RightVector;", 12, {0x21C0, 0x0000}},
+  {"ast;", 4, {0x002A, 0x0000}},
+  {"lt;", 3, {0x003C, 0x0000}},
+  {"sime;", 5, {0x2243, 0x0000}},
+  {"cfr;", 4, {0x1D520, 0x0000}},
+  {"prime;", 6, {0x2032, 0x0000}},
+  {"Wcirc;", 6, {0x0174, 0x0000}},
+  {"ltcc;", 5, {0x2AA6, 0x0000}},
+  {"cong;", 5, {0x2245, 0x0000}},
+  {"nrightarrow;", 12, {0x219B, 0x0000}},
+  {"Ccedil;", 7, {0x00C7, 0x0000}},
+  {"kgreen;", 7, {0x0138, 0x0000}},
+  {"triangle;", 9, {0x25B5, 0x0000}},
+  {"simeq;", 6, {0x2243, 0x0000}},
+  {"DZcy;", 5, {0x040F, 0x0000}},
+  {"uwangle;", 8, {0x29A7, 0x0000}},
+  {"scirc;", 6, {0x015D, 0x0000}},
+  {"hoarr;", 6, {0x21FF, 0x0000}},
+  {"NewLine;", 8, {0x000A, 0x0000}},
+  {"NotHumpDownHump;", 16, {0x224E, 0x0338}},
+  {"Yfr;", 4, {0x1D51C, 0x0000}},
+  {"Ucirc;", 6, {0x00DB, 0x0000}},
+  {"shcy;", 5, {0x0448, 0x0000}},
+  {"boxdr;", 6, {0x250C, 0x0000}},
+  {"iogon;", 6, {0x012F, 0x0000}},
+  {"Im;", 3, {0x2111, 0x0000}},
+  {"diamondsuit;", 12, {0x2666, 0x0000}},
+  {"ascr;", 5, {0x1D4B6, 0x0000}},
+  {"bullet;", 7, {0x2022, 0x0000}},
+  {"uplus;", 6, {0x228E, 0x0000}},
+  {"strns;", 6, {0x00AF, 0x0000}},
+  {"xcup;", 5, {0x22C3, 0x0000}},
+  {"Egrave;", 7, {0x00C8, 0x0000}},
+  {"supe;", 5, {0x2287, 0x0000}},
+  {"bigodot;", 8, {0x2A00, 0x0000}},
+  {"Rang;", 5, {0x27EB, 0x0000}},
+  {"NotLessSlantEqual;", 18, {0x2A7D, 0x0338}},
+  {"dfisht;", 7, {0x297F, 0x0000}},
+  {"nfr;", 4, {0x1D52B, 0x0000}},
+  {"boxvr;", 6, {0x251C, 0x0000}},
+  {"Nopf;", 5, {0x2115, 0x0000}},
+  {"LeftCeiling;", 12, {0x2308, 0x0000}},
+  {"die;", 4, {0x00A8, 0x0000}},
+  {"frown;", 6, {0x2322, 0x0000}},
+  {"boxdl;", 6, {0x2510, 0x0000}},
+  {"rcy;", 4, {0x0440, 0x0000}},
+  {"gt;", 3, {0x003E, 0x0000}},
+  {"LowerRightArrow;", 16, {0x2198, 0x0000}},
+  {"Yacute", 6, {0x00DD, 0x0000}},
+  {"Ubrcy;", 6, {0x040E, 0x0000}},
+  {"nvlt;", 5, {0x003C, 0x20D2}},
+  {"blacktriangleright;", 19, {0x25B8, 0x0000}},
+  {"supsub;", 7, {0x2AD4, 0x0000}},
+  {"ugrave;", 7, {0x00F9, 0x0000}},
+  {"acy;", 4, {0x0430, 0x0000}},
+  {"subplus;", 8, {0x2ABF, 0x0000}},
+  {"HumpEqual;", 10, {0x224F, 0x0000}},
+  {"THORN;", 6, {0x00DE, 0x0000}},
+  {"prop;", 5, {0x221D, 0x0000}},
+  {"DownLeftVectorBar;", 18, {0x2956, 0x0000}},
+  {"Aacute;", 7, {0x00C1, 0x0000}},
+  {"dashv;", 6, {0x22A3, 0x0000}},
+  {"ShortDownArrow;", 15, {0x2193, 0x0000}},
+  {"Esim;", 5, {0x2A73, 0x0000}},
+  {"ap;", 3, {0x2248, 0x0000}},
+  {"deg", 3, {0x00B0, 0x0000}},
+  {"bscr;", 5, {0x1D4B7, 0x0000}},
+  {"nshortparallel;", 15, {0x2226, 0x0000}},
+  {"isinv;", 6, {0x2208, 0x0000}},
+  {"sbquo;", 6, {0x201A, 0x0000}},
+  {"isin;", 5, {0x2208, 0x0000}},
+  {"rbrkslu;", 8, {0x2990, 0x0000}},
+  {"succcurlyeq;", 12, {0x227D, 0x0000}},
+  {"NotTilde;", 9, {0x2241, 0x0000}},
+  {"nles;", 5, {0x2A7D, 0x0338}},
+  {"ne;", 3, {0x2260, 0x0000}},
+  {"UpEquilibrium;", 14, {0x296E, 0x0000}},
+  {"nrArr;", 6, {0x21CF, 0x0000}},
+  {"dagger;", 7, {0x2020, 0x0000}},
+  {"sqsubseteq;", 11, {0x2291, 0x0000}},
+  {"bne;", 4, {0x003D, 0x20E5}},
+  {"beth;", 5, {0x2136, 0x0000}},
+  {"emsp13;", 7, {0x2004, 0x0000}},
+  {"Sacute;", 7, {0x015A, 0x0000}},
+  {"sqcap;", 6, {0x2293, 0x0000}},
+  {"boxV;", 5, {0x2551, 0x0000}},
+  {"GreaterGreater;", 15, {0x2AA2, 0x0000}},
+  {"vartheta;", 9, {0x03D1, 0x0000}},
+  {"Leftrightarrow;", 15, {0x21D4, 0x0000}},
+  {"rarrhk;", 7, {0x21AA, 0x0000}},
+  {"rthree;", 7, {0x22CC, 0x0000}},
+  {"mscr;", 5, {0x1D4C2, 0x0000}},
+  {"scaron;", 7, {0x0161, 0x0000}},
+  {"VerticalSeparator;", 18, {0x2758, 0x0000}},
+  {"rcaron;", 7, {0x0159, 0x0000}},
+  {"NotRightTriangle;", 17, {0x22EB, 0x0000}},
+  {"TripleDot;", 10, {0x20DB, 0x0000}},
+  {"quest;", 6, {0x003F, 0x0000}},
+  {"lbrace;", 7, {0x007B, 0x0000}},
+  {"ocirc;", 6, {0x00F4, 0x0000}},
+  {"varr;", 5, {0x2195, 0x0000}},
+  {"rangle;", 7, {0x27E9, 0x0000}},
+  {"nLtv;", 5, {0x226A, 0x0338}},
+  {"Exists;", 7, {0x2203, 0x0000}},
+  {"thicksim;", 9, {0x223C, 0x0000}},
+  {"varsupsetneq;", 13, {0x228B, 0xFE00}},
+  {"ReverseUpEquilibrium;", 21, {0x296F, 0x0000}},
+  {"Qopf;", 5, {0x211A, 0x0000}},
+  {"bsolhsub;", 9, {0x27C8, 0x0000}},
+  {"notinvc;", 8, {0x22F6, 0x0000}},
+  {"GreaterTilde;", 13, {0x2273, 0x0000}},
+  {"Tcedil;", 7, {0x0162, 0x0000}},
+  {"sccue;", 6, {0x227D, 0x0000}},
+  {"gg;", 3, {0x226B, 0x0000}},
+  {"nsime;", 6, {0x2244, 0x0000}},
+  {"ldca;", 5, {0x2936, 0x0000}},
+  {"range;", 6, {0x29A5, 0x0000}},
+  {"longleftarrow;", 14, {0x27F5, 0x0000}},
+  {"rlhar;", 6, {0x21CC, 0x0000}},
+  {"Breve;", 6, {0x02D8, 0x0000}},
+  {"CircleDot;", 10, {0x2299, 0x0000}},
+  {"EmptyVerySmallSquare;", 21, {0x25AB, 0x0000}},
+  {"swnwar;", 7, {0x292A, 0x0000}},
+  {"NotCongruent;", 13, {0x2262, 0x0000}},
+  {"utilde;", 7, {0x0169, 0x0000}},
+  {"Mopf;", 5, {0x1D544, 0x0000}},
+  {"ContourIntegral;", 16, {0x222E, 0x0000}},
+  {"dblac;", 6, {0x02DD, 0x0000}},
+  {"epsi;", 5, {0x03B5, 0x0000}},
+  {"lAarr;", 6, {0x21DA, 0x0000}},
+  {"ouml", 4, {0x00F6, 0x0000}},
+  {"eDDot;", 6, {0x2A77, 0x0000}},
+  {"boxdR;", 6, {0x2552, 0x0000}},
+  {"angmsdad;", 9, {0x29AB, 0x0000}},
+  {"ThinSpace;", 10, {0x2009, 0x0000}},
+  {"supmult;", 8, {0x2AC2, 0x0000}},
+  {"gtrdot;", 7, {0x22D7, 0x0000}},
+  {"scsim;", 6, {0x227F, 0x0000}},
+  {"rect;", 5, {0x25AD, 0x0000}},
+  {"varsubsetneq;", 13, {0x228A, 0xFE00}},
+  {"eacute;", 7, {0x00E9, 0x0000}},
+  {"boxvh;", 6, {0x253C, 0x0000}},
+  {"topf;", 5, {0x1D565, 0x0000}},
+  {"xnis;", 5, {0x22FB, 0x0000}},
+  {"lharul;", 7, {0x296A, 0x0000}},
+  {"ncy;", 4, {0x043D, 0x0000}},
+  {"boxhu;", 6, {0x2534, 0x0000}},
+  {"thetasym;", 9, {0x03D1, 0x0000}},
+  {"lstrok;", 7, {0x0142, 0x0000}},
+  {"olcross;", 8, {0x29BB, 0x0000}},
+  {"DoubleLeftRightArrow;", 21, {0x21D4, 0x0000}},
+  {"nvle;", 5, {0x2264, 0x20D2}},
+  {"rbrack;", 7, {0x005D, 0x0000}},
+  {"el;", 3, {0x2A99, 0x0000}},
+  {"cdot;", 5, {0x010B, 0x0000}},
+  {"LeftUpVectorBar;", 16, {0x2958, 0x0000}},
+  {"ntgl;", 5, {0x2279, 0x0000}},
+  {"percnt;", 7, {0x0025, 0x0000}},
+  {"aring;", 6, {0x00E5, 0x0000}},
+  {"Lambda;", 7, {0x039B, 0x0000}},
+  {"upharpoonright;", 15, {0x21BE, 0x0000}},
+  {"CircleTimes;", 12, {0x2297, 0x0000}},
+  {"lmidot;", 7, {0x0140, 0x0000}},
+  {"pluse;", 6, {0x2A72, 0x0000}},
+  {"NJcy;", 5, {0x040A, 0x0000}},
+  {"Iukcy;", 6, {0x0406, 0x0000}},
+  {"nvap;", 5, {0x224D, 0x20D2}},
+  {"acirc;", 6, {0x00E2, 0x0000}},
+  {"Eacute", 6, {0x00C9, 0x0000}},
+  {"ordf", 4, {0x00AA, 0x0000}},
+  {"frac34;", 7, {0x00BE, 0x0000}},
+  {"dlcorn;", 7, {0x231E, 0x0000}},
+  {"bigwedge;", 9, {0x22C0, 0x0000}},
+  {"Alpha;", 6, {0x0391, 0x0000}},
+  {"boxvH;", 6, {0x256A, 0x0000}},
+  {"Otimes;", 7, {0x2A37, 0x0000}},
+  {"UpArrowBar;", 11, {0x2912, 0x0000}},
+  {"dopf;", 5, {0x1D555, 0x0000}},
+  {"ccedil;", 7, {0x00E7, 0x0000}},
+  {"Topf;", 5, {0x1D54B, 0x0000}},
+  {"Auml;", 5, {0x00C4, 0x0000}},
+  {"zigrarr;", 8, {0x21DD, 0x0000}},
+  {"wreath;", 7, {0x2240, 0x0000}},
+  {"larrbfs;", 8, {0x291F, 0x0000}},
+  {"andv;", 5, {0x2A5A, 0x0000}},
+  {"eplus;", 6, {0x2A71, 0x0000}},
+  {"Vcy;", 4, {0x0412, 0x0000}},
+  {"szlig", 5, {0x00DF, 0x0000}},
+  {"EmptySmallSquare;", 17, {0x25FB, 0x0000}},
+  {"Proportion;", 11, {0x2237, 0x0000}},
+  {"RBarr;", 6, {0x2910, 0x0000}},
+  {"quatint;", 8, {0x2A16, 0x0000}},
+  {"Star;", 5, {0x22C6, 0x0000}},
+  {"zeetrf;", 7, {0x2128, 0x0000}},
+  {"Rrightarrow;", 12, {0x21DB, 0x0000}},
+  {"Hacek;", 6, {0x02C7, 0x0000}},
+  {"yscr;", 5, {0x1D4CE, 0x0000}},
+  {"scnsim;", 7, {0x22E9, 0x0000}},
+  {"iff;", 4, {0x21D4, 0x0000}},
+  {"SupersetEqual;", 14, {0x2287, 0x0000}},
+  {"scedil;", 7, {0x015F, 0x0000}},
+  {"jcirc;", 6, {0x0135, 0x0000}},
+  {"nsqsube;", 8, {0x22E2, 0x0000}},
+  {"squf;", 5, {0x25AA, 0x0000}},
+  {"ac;", 3, {0x223E, 0x0000}},
+  {"les;", 4, {0x2A7D, 0x0000}},
+  {"ETH;", 4, {0x00D0, 0x0000}},
+  {"nsupseteqq;", 11, {0x2AC6, 0x0338}},
+  {"Equilibrium;", 12, {0x21CC, 0x0000}},
+  {"divide", 6, {0x00F7, 0x0000}},
+  {"rhard;", 6, {0x21C1, 0x0000}},
+  {"ApplyFunction;", 14, {0x2061, 0x0000}},
+  {"bowtie;", 7, {0x22C8, 0x0000}},
+  {"Ffr;", 4, {0x1D509, 0x0000}},
+  {"Fcy;", 4, {0x0424, 0x0000}},
+  {"sdote;", 6, {0x2A66, 0x0000}},
+  {"frac25;", 7, {0x2156, 0x0000}},
+  {"dotminus;", 9, {0x2238, 0x0000}},
+  {"NegativeThickSpace;", 19, {0x200B, 0x0000}},
+  {"rceil;", 6, {0x2309, 0x0000}},
+  {"imacr;", 6, {0x012B, 0x0000}},
+  {"tcy;", 4, {0x0442, 0x0000}},
+  {"xopf;", 5, {0x1D569, 0x0000}},
+  {"odot;", 5, {0x2299, 0x0000}},
+  {"not", 3, {0x00AC, 0x0000}},
+  {"ngeqslant;", 10, {0x2A7E, 0x0338}},
+  {"gnsim;", 6, {0x22E7, 0x0000}},
+  {"Tstrok;", 7, {0x0166, 0x0000}},
+  {"realine;", 8, {0x211B, 0x0000}},
+  {"blacktriangledown;", 18, {0x25BE, 0x0000}},
+  {"Rcy;", 4, {0x0420, 0x0000}},
+  {"UnderParenthesis;", 17, {0x23DD, 0x0000}},
+  {"pscr;", 5, {0x1D4C5, 0x0000}},
+  {"iacute", 6, {0x00ED, 0x0000}},
+  {"LongLeftArrow;", 14, {0x27F5, 0x0000}},
+  {"minusb;", 7, {0x229F, 0x0000}},
+  {"Ucy;", 4, {0x0423, 0x0000}},
+  {"luruhar;", 8, {0x2966, 0x0000}},
+  {"lvnE;", 5, {0x2268, 0xFE00}},
+  {"Nfr;", 4, {0x1D511, 0x0000}},
+  {"raemptyv;", 9, {0x29B3, 0x0000}},
+  {"amp;", 4, {0x0026, 0x0000}},
+  {"lesg;", 5, {0x22DA, 0xFE00}},
+  {"gsim;", 5, {0x2273, 0x0000}},
+  {"Sopf;", 5, {0x1D54A, 0x0000}},
+  {"dsol;", 5, {0x29F6, 0x0000}},
+  {"fpartint;", 9, {0x2A0D, 0x0000}},
+  {"horbar;", 7, {0x2015, 0x0000}},
+  {"leq;", 4, {0x2264, 0x0000}},
+  {"pfr;", 4, {0x1D52D, 0x0000}},
+  {"mid;", 4, {0x2223, 0x0000}},
+  {"Uuml;", 5, {0x00DC, 0x0000}},
+  {"cacute;", 7, {0x0107, 0x0000}},
+  {"nsubset;", 8, {0x2282, 0x20D2}},
+  {"Ocirc", 5, {0x00D4, 0x0000}},
+  {"lsqb;", 5, {0x005B, 0x0000}},
+  {"Updownarrow;", 12, {0x21D5, 0x0000}},
+  {"smte;", 5, {0x2AAC, 0x0000}},
+  {"udhar;", 6, {0x296E, 0x0000}},
+  {"LeftDoubleBracket;", 18, {0x27E6, 0x0000}},
+  {"Sub;", 4, {0x22D0, 0x0000}},
+  {"iquest", 6, {0x00BF, 0x0000}},
+  {"Emacr;", 6, {0x0112, 0x0000}},
+  {"CupCap;", 7, {0x224D, 0x0000}},
+  {"Itilde;", 7, {0x0128, 0x0000}},
+  {"lhard;", 6, {0x21BD, 0x0000}},
+  {"Longleftarrow;", 14, {0x27F8, 0x0000}},
+  {"ntilde", 6, {0x00F1, 0x0000}},
+  {"drcrop;", 7, {0x230C, 0x0000}},
+  {"pound;", 6, {0x00A3, 0x0000}},
+  {"raquo", 5, {0x00BB, 0x0000}},
+  {"rsaquo;", 7, {0x203A, 0x0000}},
+  {"lbrksld;", 8, {0x298F, 0x0000}},
+  {"UpDownArrow;", 12, {0x2195, 0x0000}},
+  {"Colone;", 7, {0x2A74, 0x0000}},
+  {"curarr;", 7, {0x21B7, 0x0000}},
+  {"wcirc;", 6, {0x0175, 0x0000}},
+  {"mcomma;", 7, {0x2A29, 0x0000}},
+  {"wedbar;", 7, {0x2A5F, 0x0000}},
+  {"nsccue;", 7, {0x22E1, 0x0000}},
+  {"approx;", 7, {0x2248, 0x0000}},
+  {"gneqq;", 6, {0x2269, 0x0000}},
+  {"Xopf;", 5, {0x1D54F, 0x0000}},
+  {"longrightarrow;", 15, {0x27F6, 0x0000}},
+  {"tridot;", 7, {0x25EC, 0x0000}},
+  {"bull;", 5, {0x2022, 0x0000}},
+  {"Dagger;", 7, {0x2021, 0x0000}},
+  {"rightthreetimes;", 16, {0x22CC, 0x0000}},
+  {"bemptyv;", 8, {0x29B0, 0x0000}},
+  {"kscr;", 5, {0x1D4C0, 0x0000}},
+  {"nhpar;", 6, {0x2AF2, 0x0000}},
+  {"NestedLessLess;", 15, {0x226A, 0x0000}},
+  {"osol;", 5, {0x2298, 0x0000}},
+  {"LeftDownVector;", 15, {0x21C3, 0x0000}},
+  {"leqq;", 5, {0x2266, 0x0000}},
+  {"ouml;", 5, {0x00F6, 0x0000}},
+  {"Abreve;", 7, {0x0102, 0x0000}},
+  {"ell;", 4, {0x2113, 0x0000}},
+  {"Rarr;", 5, {0x21A0, 0x0000}},
+  {"Pscr;", 5, {0x1D4AB, 0x0000}},
+  {"lacute;", 7, {0x013A, 0x0000}},
+  {"Intersection;", 13, {0x22C2, 0x0000}},
+  {"rtriltri;", 9, {0x29CE, 0x0000}},
+  {"mfr;", 4, {0x1D52A, 0x0000}},
+  {"NotDoubleVerticalBar;", 21, {0x2226, 0x0000}},
+  {"NotTildeTilde;", 14, {0x2249, 0x0000}},
+  {"NonBreakingSpace;", 17, {0x00A0, 0x0000}},
+  {"kcy;", 4, {0x043A, 0x0000}},
+  {"gtdot;", 6, {0x22D7, 0x0000}},
+  {"gtrarr;", 7, {0x2978, 0x0000}},
+  {"ucy;", 4, {0x0443, 0x0000}},
+  {"therefore;", 10, {0x2234, 0x0000}},
+  {"backcong;", 9, {0x224C, 0x0000}},
+  {"exponentiale;", 13, {0x2147, 0x0000}},
+  {"tscr;", 5, {0x1D4C9, 0x0000}},
+  {"LJcy;", 5, {0x0409, 0x0000}},
+  {"preceq;", 7, {0x2AAF, 0x0000}},
+  {"LowerLeftArrow;", 15, {0x2199, 0x0000}},
+  {"lneqq;", 6, {0x2268, 0x0000}},
+  {"EqualTilde;", 11, {0x2242, 0x0000}},
+  {"Lfr;", 4, {0x1D50F, 0x0000}},
+  {"DiacriticalAcute;", 17, {0x00B4, 0x0000}},
+  {"upuparrows;", 11, {0x21C8, 0x0000}},
+  {"primes;", 7, {0x2119, 0x0000}},
+  {"drbkarow;", 9, {0x2910, 0x0000}},
+  {"oint;", 5, {0x222E, 0x0000}},
+  {"Verbar;", 7, {0x2016, 0x0000}},
+  {"loplus;", 7, {0x2A2D, 0x0000}},
+  {"TScy;", 5, {0x0426, 0x0000}},
+  {"ucirc;", 6, {0x00FB, 0x0000}},
+  {"Ncy;", 4, {0x041D, 0x0000}},
+  {"upsih;", 6, {0x03D2, 0x0000}},
+  {"DifferentialD;", 14, {0x2146, 0x0000}},
+  {"nvgt;", 5, {0x003E, 0x20D2}},
+  {"Laplacetrf;", 11, {0x2112, 0x0000}},
+  {"dash;", 5, {0x2010, 0x0000}},
+  {"Hat;", 4, {0x005E, 0x0000}},
+  {"nprec;", 6, {0x2280, 0x0000}},
+  {"ocir;", 5, {0x229A, 0x0000}},
+  {"angrtvb;", 8, {0x22BE, 0x0000}},
+  {"roang;", 6, {0x27ED, 0x0000}},
+  {"rlarr;", 6, {0x21C4, 0x0000}},
+  {"Acirc", 5, {0x00C2, 0x0000}},
+  {"ntrianglelefteq;", 16, {0x22EC, 0x0000}},
+  {"sube;", 5, {0x2286, 0x0000}},
+  {"yuml", 4, {0x00FF, 0x0000}},
+  {"iexcl;", 6, {0x00A1, 0x0000}},
+  {"simlE;", 6, {0x2A9F, 0x0000}},
+  {"LT;", 3, {0x003C, 0x0000}},
+  {"gt", 2, {0x003E, 0x0000}},
+  {"par;", 4, {0x2225, 0x0000}},
+  {"vArr;", 5, {0x21D5, 0x0000}},
+  {"ffllig;", 7, {0xFB04, 0x0000}},
+  {"boxDL;", 6, {0x2557, 0x0000}},
+  {"neArr;", 6, {0x21D7, 0x0000}},
+  {"larrpl;", 7, {0x2939, 0x0000}},
+  {"triangledown;", 13, {0x25BF, 0x0000}},
+  {"odash;", 6, {0x229D, 0x0000}},
+  {"sqsupset;", 9, {0x2290, 0x0000}},
+  {"RightDoubleBracket;", 19, {0x27E7, 0x0000}},
+  {"kfr;", 4, {0x1D528, 0x0000}},
+  {"Ofr;", 4, {0x1D512, 0x0000}},
+  {"expectation;", 12, {0x2130, 0x0000}},
+  {"upharpoonleft;", 14, {0x21BF, 0x0000}},
+  {"IJlig;", 6, {0x0132, 0x0000}},
+  {"NotLess;", 8, {0x226E, 0x0000}},
+  {"ubrcy;", 6, {0x045E, 0x0000}},
+  {"trisb;", 6, {0x29CD, 0x0000}},
+  {"lesseqqgtr;", 11, {0x2A8B, 0x0000}},
+  {"mopf;", 5, {0x1D55E, 0x0000}},
+  {"ccups;", 6, {0x2A4C, 0x0000}},
+  {"TildeTilde;", 11, {0x2248, 0x0000}},
+  {"Vbar;", 5, {0x2AEB, 0x0000}},
+  {"utdot;", 6, {0x22F0, 0x0000}},
+  {"OpenCurlyQuote;", 15, {0x2018, 0x0000}},
+  {"hkswarow;", 9, {0x2926, 0x0000}},
+  {"imped;", 6, {0x01B5, 0x0000}},
+  {"wp;", 3, {0x2118, 0x0000}},
+  {"geqq;", 5, {0x2267, 0x0000}},
+  {"NotLessEqual;", 13, {0x2270, 0x0000}},
+  {"Uogon;", 6, {0x0172, 0x0000}},
+  {"seswar;", 7, {0x2929, 0x0000}},
+  {"ReverseElement;", 15, {0x220B, 0x0000}},
+  {"Nu;", 3, {0x039D, 0x0000}},
+  {"Aacute", 6, {0x00C1, 0x0000}},
+  {"uharl;", 6, {0x21BF, 0x0000}},
+  {"ofr;", 4, {0x1D52C, 0x0000}},
+  {"Ugrave;", 7, {0x00D9, 0x0000}},
+  {"profalar;", 9, {0x232E, 0x0000}},
+  {"COPY;", 5, {0x00A9, 0x0000}},
+  {"dotplus;", 8, {0x2214, 0x0000}},
+  {"boxVl;", 6, {0x2562, 0x0000}},
+  {"lambda;", 7, {0x03BB, 0x0000}},
+  {"bumpE;", 6, {0x2AAE, 0x0000}},
+  {"Integral;", 9, {0x222B, 0x0000}},
+  {"risingdotseq;", 13, {0x2253, 0x0000}},
+  {"nvDash;", 7, {0x22AD, 0x0000}},
+  {"xhArr;", 6, {0x27FA, 0x0000}},
+  {"Gammad;", 7, {0x03DC, 0x0000}},
+  {"oelig;", 6, {0x0153, 0x0000}},
+  {"lbrack;", 7, {0x005B, 0x0000}},
+  {"nVDash;", 7, {0x22AF, 0x0000}},
+  {"prnsim;", 7, {0x22E8, 0x0000}},
+  {"ncaron;", 7, {0x0148, 0x0000}},
+  {"Oscr;", 5, {0x1D4AA, 0x0000}},
+  {"boxur;", 6, {0x2514, 0x0000}},
+  {"Gbreve;", 7, {0x011E, 0x0000}},
+  {"flat;", 5, {0x266D, 0x0000}},
+  {"acute", 5, {0x00B4, 0x0000}},
+  {"timesbar;", 9, {0x2A31, 0x0000}},
+  {"otilde", 6, {0x00F5, 0x0000}},
+  {"leftrightsquigarrow;", 20, {0x21AD, 0x0000}},
+  {"angst;", 6, {0x00C5, 0x0000}},
+  {"UpTee;", 6, {0x22A5, 0x0000}},
+  {"Zeta;", 5, {0x0396, 0x0000}},
+  {"olarr;", 6, {0x21BA, 0x0000}},
+  {"SubsetEqual;", 12, {0x2286, 0x0000}},
+  {"mdash;", 6, {0x2014, 0x0000}},
+  {"Yopf;", 5, {0x1D550, 0x0000}},
+  {"lrarr;", 6, {0x21C6, 0x0000}},
+  {"timesd;", 7, {0x2A30, 0x0000}},
+  {"ratio;", 6, {0x2236, 0x0000}},
+  {"nu;", 3, {0x03BD, 0x0000}},
+  {"varrho;", 7, {0x03F1, 0x0000}},
+  {"naturals;", 9, {0x2115, 0x0000}},
+  {"vnsub;", 6, {0x2282, 0x20D2}},
+  {"natur;", 6, {0x266E, 0x0000}},
+  {"Icy;", 4, {0x0418, 0x0000}},
+  {"rtrif;", 6, {0x25B8, 0x0000}},
+  {"permil;", 7, {0x2030, 0x0000}},
+  {"angmsdab;", 9, {0x29A9, 0x0000}},
+  {"supdot;", 7, {0x2ABE, 0x0000}},
+  {"triangleq;", 10, {0x225C, 0x0000}},
+  {"Icirc;", 6, {0x00CE, 0x0000}},
+  {"caret;", 6, {0x2041, 0x0000}},
+  {"nVdash;", 7, {0x22AE, 0x0000}},
+  {"Bopf;", 5, {0x1D539, 0x0000}},
+  {"boxUR;", 6, {0x255A, 0x0000}},
+  {"searhk;", 7, {0x2925, 0x0000}},
+  {"DownRightVectorBar;", 19, {0x2957, 0x0000}},
+  {"there4;", 7, {0x2234, 0x0000}},
+  {"laemptyv;", 9, {0x29B4, 0x0000}},
+  {"nsc;", 4, {0x2281, 0x0000}},
+  {"Gcirc;", 6, {0x011C, 0x0000}},
+  {"propto;", 7, {0x221D, 0x0000}},
+  {"rarr;", 5, {0x2192, 0x0000}},
+  {"rAtail;", 7, {0x291C, 0x0000}},
+  {"varphi;", 7, {0x03D5, 0x0000}},
+  {"Edot;", 5, {0x0116, 0x0000}},
+  {"lthree;", 7, {0x22CB, 0x0000}},
+  {"ctdot;", 6, {0x22EF, 0x0000}},
+  {"uuarr;", 6, {0x21C8, 0x0000}},
+  {"multimap;", 9, {0x22B8, 0x0000}},
+  {"subE;", 5, {0x2AC5, 0x0000}},
+  {"zhcy;", 5, {0x0436, 0x0000}},
+  {"DoubleLeftTee;", 14, {0x2AE4, 0x0000}},
+  {"varpropto;", 10, {0x221D, 0x0000}},
+  {"angzarr;", 8, {0x237C, 0x0000}},
+  {"csube;", 6, {0x2AD1, 0x0000}},
+  {"Mfr;", 4, {0x1D510, 0x0000}},
+  {"mstpos;", 7, {0x223E, 0x0000}},
+  {"lpar;", 5, {0x0028, 0x0000}},
+  {"HumpDownHump;", 13, {0x224E, 0x0000}},
+  {"ecirc", 5, {0x00EA, 0x0000}},
+  {"phiv;", 5, {0x03D5, 0x0000}},
+  {"vangrt;", 7, {0x299C, 0x0000}},
+  {"olcir;", 6, {0x29BE, 0x0000}},
+  {"Iuml;", 5, {0x00CF, 0x0000}},
+  {"sim;", 4, {0x223C, 0x0000}},
+  {"divide;", 7, {0x00F7, 0x0000}},
+  {"ntlg;", 5, {0x2278, 0x0000}},
+  {"ltimes;", 7, {0x22C9, 0x0000}},
+  {"Lscr;", 5, {0x2112, 0x0000}},
+  {"Because;", 8, {0x2235, 0x0000}},
+  {"SquareSubset;", 13, {0x228F, 0x0000}},
+  {"amalg;", 6, {0x2A3F, 0x0000}},
+  {"Racute;", 7, {0x0154, 0x0000}},
+  {"bNot;", 5, {0x2AED, 0x0000}},
+  {"raquo;", 6, {0x00BB, 0x0000}},
+  {"nsce;", 5, {0x2AB0, 0x0338}},
+  {"Ecirc;", 6, {0x00CA, 0x0000}},
+  {"dot;", 4, {0x02D9, 0x0000}},
+  {"LessEqualGreater;", 17, {0x22DA, 0x0000}},
+  {"setminus;", 9, {0x2216, 0x0000}},
+  {"harrw;", 6, {0x21AD, 0x0000}},
+  {"Otilde", 6, {0x00D5, 0x0000}},
+  {"DoubleLongLeftArrow;", 20, {0x27F8, 0x0000}},
+  {"vrtri;", 6, {0x22B3, 0x0000}},
+  {"lang;", 5, {0x27E8, 0x0000}},
+  {"centerdot;", 10, {0x00B7, 0x0000}},
+  {"ecaron;", 7, {0x011B, 0x0000}},
+  {"hArr;", 5, {0x21D4, 0x0000}},
+  {"period;", 7, {0x002E, 0x0000}},
+  {"bsime;", 6, {0x22CD, 0x0000}},
+  {"tilde;", 6, {0x02DC, 0x0000}},
+  {"cirmid;", 7, {0x2AEF, 0x0000}},
+  {"oacute;", 7, {0x00F3, 0x0000}},
+  {"circleddash;", 12, {0x229D, 0x0000}},
+  {"nparallel;", 10, {0x2226, 0x0000}},
+  {"ultri;", 6, {0x25F8, 0x0000}},
+  {"prec;", 5, {0x227A, 0x0000}},
+  {"Scedil;", 7, {0x015E, 0x0000}},
+  {"bumpe;", 6, {0x224F, 0x0000}},
+  {"nbump;", 6, {0x224E, 0x0338}},
+  {"Oacute", 6, {0x00D3, 0x0000}},
+  {"nle;", 4, {0x2270, 0x0000}},
+  {"xharr;", 6, {0x27F7, 0x0000}},
+  {"NoBreak;", 8, {0x2060, 0x0000}},
+  {"nwarhk;", 7, {0x2923, 0x0000}},
+  {"Wscr;", 5, {0x1D4B2, 0x0000}},
+  {"PrecedesEqual;", 14, {0x2AAF, 0x0000}},
+  {"diams;", 6, {0x2666, 0x0000}},
+  {"Gdot;", 5, {0x0120, 0x0000}},
+  {"rdquor;", 7, {0x201D, 0x0000}},
+  {"Rho;", 4, {0x03A1, 0x0000}},
+  {"rmoust;", 7, {0x23B1, 0x0000}},
+  {"OElig;", 6, {0x0152, 0x0000}},
+  {"Xfr;", 4, {0x1D51B, 0x0000}},
+  {"Sqrt;", 5, {0x221A, 0x0000}},
+  {"blacklozenge;", 13, {0x29EB, 0x0000}},
+  {"iopf;", 5, {0x1D55A, 0x0000}},
+  {"Nscr;", 5, {0x1D4A9, 0x0000}},
+  {"Tcaron;", 7, {0x0164, 0x0000}},
+  {"pluscir;", 8, {0x2A22, 0x0000}},
+  {"ncup;", 5, {0x2A42, 0x0000}},
+  {"Sfr;", 4, {0x1D516, 0x0000}},
+  {"nsimeq;", 7, {0x2244, 0x0000}},
+  {"Zopf;", 5, {0x2124, 0x0000}},
+  {"RightArrowBar;", 14, {0x21E5, 0x0000}},
+  {"loang;", 6, {0x27EC, 0x0000}},
+  {"succsim;", 8, {0x227F, 0x0000}},
+  {"KJcy;", 5, {0x040C, 0x0000}},
+  {"Tfr;", 4, {0x1D517, 0x0000}},
+  {"times;", 6, {0x00D7, 0x0000}},
+  {"infin;", 6, {0x221E, 0x0000}},
+  {"eqcolon;", 8, {0x2255, 0x0000}},
+  {"latail;", 7, {0x2919, 0x0000}},
+  {"lbbrk;", 6, {0x2772, 0x0000}},
+  {"odiv;", 5, {0x2A38, 0x0000}},
+  {"Diamond;", 8, {0x22C4, 0x0000}},
+  {"frac12", 6, {0x00BD, 0x0000}},
+  {"scE;", 4, {0x2AB4, 0x0000}},
+  {"xlArr;", 6, {0x27F8, 0x0000}},
+  {"duarr;", 6, {0x21F5, 0x0000}},
+  {"pm;", 3, {0x00B1, 0x0000}},
+  {"hyphen;", 7, {0x2010, 0x0000}},
+  {"submult;", 8, {0x2AC1, 0x0000}},
+  {"LessLess;", 9, {0x2AA1, 0x0000}},
+  {"precneqq;", 9, {0x2AB5, 0x0000}},
+  {"NotGreater;", 11, {0x226F, 0x0000}},
+  {"YAcy;", 5, {0x042F, 0x0000}},
+  {"oslash", 6, {0x00F8, 0x0000}},
+  {"DotDot;", 7, {0x20DC, 0x0000}},
+  {"NotGreaterEqual;", 16, {0x2271, 0x0000}},
+  {"lrtri;", 6, {0x22BF, 0x0000}},
+  {"lcub;", 5, {0x007B, 0x0000}},
+  {"angmsdaf;", 9, {0x29AD, 0x0000}},
+  {"eta;", 4, {0x03B7, 0x0000}},
+  {"LeftTeeArrow;", 13, {0x21A4, 0x0000}},
+  {"yen", 3, {0x00A5, 0x0000}},
+  {"profline;", 9, {0x2312, 0x0000}},
+  {"real;", 5, {0x211C, 0x0000}},
+  {"female;", 7, {0x2640, 0x0000}},
+  {"notnivb;", 8, {0x22FE, 0x0000}},
+  {"frac78;", 7, {0x215E, 0x0000}},
+  {"tosa;", 5, {0x2929, 0x0000}},
+  {"boxVR;", 6, {0x2560, 0x0000}},
+  {"congdot;", 8, {0x2A6D, 0x0000}},
+  {"ecirc;", 6, {0x00EA, 0x0000}},
+  {"Ecaron;", 7, {0x011A, 0x0000}},
+  {"prnE;", 5, {0x2AB5, 0x0000}},
+  {"rarrbfs;", 8, {0x2920, 0x0000}},
+  {"smeparsl;", 9, {0x29E4, 0x0000}},
+  {"lparlt;", 7, {0x2993, 0x0000}},
+  {"xodot;", 6, {0x2A00, 0x0000}},
+  {"euml", 4, {0x00EB, 0x0000}},
+  {"UpArrowDownArrow;", 17, {0x21C5, 0x0000}},
+  {"igrave;", 7, {0x00EC, 0x0000}},
+  {"UpperRightArrow;", 16, {0x2197, 0x0000}},
+  {"daleth;", 7, {0x2138, 0x0000}},
+  {"esdot;", 6, {0x2250, 0x0000}},
+  {"gammad;", 7, {0x03DD, 0x0000}},
+  {"rangd;", 6, {0x2992, 0x0000}},
+  {"cirfnint;", 9, {0x2A10, 0x0000}},
+  {"parsl;", 6, {0x2AFD, 0x0000}},
+  {"NotLessGreater;", 15, {0x2278, 0x0000}},
+  {"simdot;", 7, {0x2A6A, 0x0000}},
+  {"gtreqless;", 10, {0x22DB, 0x0000}},
+  {"SquareSupersetEqual;", 20, {0x2292, 0x0000}},
+  {"verbar;", 7, {0x007C, 0x0000}},
+  {"notinva;", 8, {0x2209, 0x0000}},
+  {"NotSucceedsEqual;", 17, {0x2AB0, 0x0338}},
+  {"Lstrok;", 7, {0x0141, 0x0000}},
+  {"urcorner;", 9, {0x231D, 0x0000}},
+  {"Lacute;", 7, {0x0139, 0x0000}},
+  {"rscr;", 5, {0x1D4C7, 0x0000}},
+  {"LeftUpDownVector;", 17, {0x2951, 0x0000}},
+  {"Jukcy;", 6, {0x0404, 0x0000}},
+  {"ucirc", 5, {0x00FB, 0x0000}},
+  {"dd;", 3, {0x2146, 0x0000}},
+  {"straightphi;", 12, {0x03D5, 0x0000}},
+  {"prsim;", 6, {0x227E, 0x0000}},
+  {"gap;", 4, {0x2A86, 0x0000}},
+  {"updownarrow;", 12, {0x2195, 0x0000}},
+  {"GreaterLess;", 12, {0x2277, 0x0000}},
+  {"homtht;", 7, {0x223B, 0x0000}},
+  {"nparsl;", 7, {0x2AFD, 0x20E5}},
+  {"Sigma;", 6, {0x03A3, 0x0000}},
+  {"Jcirc;", 6, {0x0134, 0x0000}},
+  {"vsubnE;", 7, {0x2ACB, 0xFE00}},
+  {"Copf;", 5, {0x2102, 0x0000}},
+  {"Bcy;", 4, {0x0411, 0x0000}},
+  {"duhar;", 6, {0x296F, 0x0000}},
+  {"RightArrow;", 11, {0x2192, 0x0000}},
+  {"nlE;", 4, {0x2266, 0x0338}},
+  {"mldr;", 5, {0x2026, 0x0000}},
+  {"ltdot;", 6, {0x22D6, 0x0000}},
+  {"fork;", 5, {0x22D4, 0x0000}},
+  {"complexes;", 10, {0x2102, 0x0000}},
+  {"ohm;", 4, {0x03A9, 0x0000}},
+  {"Ecy;", 4, {0x042D, 0x0000}},
+  {"CenterDot;", 10, {0x00B7, 0x0000}},
+  {"mapstoleft;", 11, {0x21A4, 0x0000}},
+  {"eg;", 3, {0x2A9A, 0x0000}},
+  {"epsiv;", 6, {0x03F5, 0x0000}},
+  {"gesles;", 7, {0x2A94, 0x0000}},
+  {"oacute", 6, {0x00F3, 0x0000}},
+  {"subsub;", 7, {0x2AD5, 0x0000}},
+  {"midast;", 7, {0x002A, 0x0000}},
+  {"blacktriangle;", 14, {0x25B4, 0x0000}},
+  {"nequiv;", 7, {0x2262, 0x0000}},
+  {"ZHcy;", 5, {0x0416, 0x0000}},
+  {"NotSucceedsSlantEqual;", 22, {0x22E1, 0x0000}},
+  {"tshcy;", 6, {0x045B, 0x0000}},
+  {"lnap;", 5, {0x2A89, 0x0000}},
+  {"or;", 3, {0x2228, 0x0000}},
+  {"SquareSubsetEqual;", 18, {0x2291, 0x0000}},
+  {"orderof;", 8, {0x2134, 0x0000}},
+  {"Xscr;", 5, {0x1D4B3, 0x0000}},
+  {"coloneq;", 8, {0x2254, 0x0000}},
+  {"leftrightharpoons;", 18, {0x21CB, 0x0000}},
+  {"in;", 3, {0x2208, 0x0000}},
+  {"rightsquigarrow;", 16, {0x219D, 0x0000}},
+  {"cularrp;", 8, {0x293D, 0x0000}},
+  {"nsqsupe;", 8, {0x22E3, 0x0000}},
+  {"udblac;", 7, {0x0171, 0x0000}},
+  {"notni;", 6, {0x220C, 0x0000}},
+  {"rbbrk;", 6, {0x2773, 0x0000}},
+  {"Xi;", 3, {0x039E, 0x0000}},
+  {"CircleMinus;", 12, {0x2296, 0x0000}},
+  {"uarr;", 5, {0x2191, 0x0000}},
+  {"sc;", 3, {0x227B, 0x0000}},
+  {"emacr;", 6, {0x0113, 0x0000}},
+  {"blacksquare;", 12, {0x25AA, 0x0000}},
+  {"div;", 4, {0x00F7, 0x0000}},
+  {"blk12;", 6, {0x2592, 0x0000}},
+  {"rarrw;", 6, {0x219D, 0x0000}},
+  {"rfloor;", 7, {0x230B, 0x0000}},
+  {"jsercy;", 7, {0x0458, 0x0000}},
+  {"supedot;", 8, {0x2AC4, 0x0000}},
+  {"operp;", 6, {0x29B9, 0x0000}},
+  {"nrarrc;", 7, {0x2933, 0x0338}},
+  {"YUcy;", 5, {0x042E, 0x0000}},
+  {"urtri;", 6, {0x25F9, 0x0000}},
+  {"GreaterSlantEqual;", 18, {0x2A7E, 0x0000}},
+  {"simrarr;", 8, {0x2972, 0x0000}},
+  {"Proportional;", 13, {0x221D, 0x0000}},
+  {"frac34", 6, {0x00BE, 0x0000}},
+  {"cudarrr;", 8, {0x2935, 0x0000}},
+  {"Zdot;", 5, {0x017B, 0x0000}},
+  {"models;", 7, {0x22A7, 0x0000}},
+  {"spar;", 5, {0x2225, 0x0000}},
+  {"ges;", 4, {0x2A7E, 0x0000}},
+  {"intlarhk;", 9, {0x2A17, 0x0000}},
+  {"tprime;", 7, {0x2034, 0x0000}},
+  {"boxVr;", 6, {0x255F, 0x0000}},
+  {"because;", 8, {0x2235, 0x0000}},
+  {"gtcir;", 6, {0x2A7A, 0x0000}},
+  {"lg;", 3, {0x2276, 0x0000}},
+  {"elinters;", 9, {0x23E7, 0x0000}},
+  {"af;", 3, {0x2061, 0x0000}},
+  {"omid;", 5, {0x29B6, 0x0000}},
+  {"plus;", 5, {0x002B, 0x0000}},
+  {"GreaterFullEqual;", 17, {0x2267, 0x0000}},
+  {"lesssim;", 8, {0x2272, 0x0000}},
+  {"Idot;", 5, {0x0130, 0x0000}},
+  {"iquest;", 7, {0x00BF, 0x0000}},
+  {"bigtriangledown;", 16, {0x25BD, 0x0000}},
+  {"bcong;", 6, {0x224C, 0x0000}},
+  {"eng;", 4, {0x014B, 0x0000}},
+  {"nwArr;", 6, {0x21D6, 0x0000}},
+  {"glj;", 4, {0x2AA4, 0x0000}},
+  {"larrb;", 6, {0x21E4, 0x0000}},
+  {"nsupe;", 6, {0x2289, 0x0000}},
+  {"DownArrow;", 10, {0x2193, 0x0000}},
+  {"ddarr;", 6, {0x21CA, 0x0000}},
+  {"cap;", 4, {0x2229, 0x0000}},
+  {"sscr;", 5, {0x1D4C8, 0x0000}},
+  {"supnE;", 6, {0x2ACC, 0x0000}},
+  {"colon;", 6, {0x003A, 0x0000}},
+  {"forall;", 7, {0x2200, 0x0000}},
+  {"spades;", 7, {0x2660, 0x0000}},
+  {"dtdot;", 6, {0x22F1, 0x0000}},
+  {"uacute;", 7, {0x00FA, 0x0000}},
+  {"hookleftarrow;", 14, {0x21A9, 0x0000}},
+  {"ffr;", 4, {0x1D523, 0x0000}},
+  {"aelig;", 6, {0x00E6, 0x0000}},
+  {"iiota;", 6, {0x2129, 0x0000}},
+  {"blk34;", 6, {0x2593, 0x0000}},
+  {"udarr;", 6, {0x21C5, 0x0000}},
+  {"Kappa;", 6, {0x039A, 0x0000}},
+  {"SucceedsSlantEqual;", 19, {0x227D, 0x0000}},
+  {"Imacr;", 6, {0x012A, 0x0000}},
+  {"ngtr;", 5, {0x226F, 0x0000}},
+  {"doublebarwedge;", 15, {0x2306, 0x0000}},
+  {"rbrksld;", 8, {0x298E, 0x0000}},
+  {"Yuml;", 5, {0x0178, 0x0000}},
+  {"iecy;", 5, {0x0435, 0x0000}},
+  {"nGtv;", 5, {0x226B, 0x0338}},
+  {"nsub;", 5, {0x2284, 0x0000}},
+  {"gcirc;", 6, {0x011D, 0x0000}},
+  {"rbrace;", 7, {0x007D, 0x0000}},
+  {"ltlarr;", 7, {0x2976, 0x0000}},
+  {"Yscr;", 5, {0x1D4B4, 0x0000}},
+  {"zcy;", 4, {0x0437, 0x0000}},
+  {"yacy;", 5, {0x044F, 0x0000}},
+  {"ee;", 3, {0x2147, 0x0000}},
+  {"IOcy;", 5, {0x0401, 0x0000}},
+  {"uring;", 6, {0x016F, 0x0000}},
+  {"Pr;", 3, {0x2ABB, 0x0000}},
+  {"Mellintrf;", 10, {0x2133, 0x0000}},
+  {"Ucirc", 5, {0x00DB, 0x0000}},
+  {"Bfr;", 4, {0x1D505, 0x0000}},
+  {"ecir;", 5, {0x2256, 0x0000}},
+  {"InvisibleComma;", 15, {0x2063, 0x0000}},
+  {"rx;", 3, {0x211E, 0x0000}},
+  {"rppolint;", 9, {0x2A12, 0x0000}},
+  {"UpperLeftArrow;", 15, {0x2196, 0x0000}},
+  {"Yacute;", 7, {0x00DD, 0x0000}},
+  {"between;", 8, {0x226C, 0x0000}},
+  {"boxhU;", 6, {0x2568, 0x0000}},
+  {"Scy;", 4, {0x0421, 0x0000}},
+  {"copy;", 5, {0x00A9, 0x0000}},
+  {"nvrArr;", 7, {0x2903, 0x0000}},
+  {"ii;", 3, {0x2148, 0x0000}},
+  {"leg;", 4, {0x22DA, 0x0000}},
+  {"Upsi;", 5, {0x03D2, 0x0000}},
+  {"boxminus;", 9, {0x229F, 0x0000}},
+  {"vellip;", 7, {0x22EE, 0x0000}},
+  {"ulcorn;", 7, {0x231C, 0x0000}},
+  {"quot", 4, {0x0022, 0x0000}},
+  {"prcue;", 6, {0x227C, 0x0000}},
+  {"angmsdac;", 9, {0x29AA, 0x0000}},
+};
+
+static const unsigned short displacements[BUCKETS] = {
+  1, 116, 8, 81, 5, 58, 216, 88, 127, 9, 2, 12,
+  89, 27, 7, 19, 58, 76, 5, 72, 20, 13, 188, 110,
+  67, 18, 40, 5, 26, 117, 15, 67, 18, 6, 396, 436,
+  38, 253, 123, 259, 123, 10, 37, 22, 60, 1, 1, 52,
+  77, 138, 96, 46, 11, 90, 56, 1, 28, 17, 16, 88,
+  1, 31, 1, 9, 4, 13, 2, 102, 138, 7, 174, 40,
+  8, 19, 7, 0, 39, 24, 89, 21, 93, 0, 150, 69,
+  10, 12, 167, 62, 28, 1, 128, 6, 61, 294, 6, 76,
+  1, 1, 157, 102, 433, 152, 0, 34, 89, 350, 3, 133,
+  243, 2, 27, 3, 55, 237, 67, 40, 4, 33, 21, 441,
+  9, 71, 219, 2, 26, 82, 136, 17, 34, 5, 28, 98,
+  291, 22, 5, 28, 1, 18, 119, 54, 37, 8, 510, 32,
+  5, 1, 6, 2, 249, 2, 166, 1, 55, 4, 41, 42,
+  27, 365, 3, 160, 0, 66, 164, 139, 9, 92, 45, 369,
+  2, 209, 1, 60, 1, 420, 2, 58, 161, 144, 458, 9,
+  38, 37, 0, 34, 181, 87, 16, 6, 60, 5, 98, 0,
+  39, 1, 3, 477, 29, 168, 0, 65, 122, 7, 326, 7,
+  146, 168, 12, 20, 0, 119, 3, 3, 2, 599, 724, 82,
+  188, 13, 35, 43, 2, 124, 36, 9, 100, 103, 641, 27,
+  130, 162, 214, 46, 3, 128, 54, 20, 10, 23, 75, 23,
+  2, 11, 9, 111, 14, 1, 556, 1, 5, 269, 6, 2,
+  405, 67, 1, 4, 90, 148, 3, 108, 6, 1854, 71, 9,
+  11, 5, 8, 107, 19, 13, 366, 205, 107, 34, 1, 10,
+  228, 6, 2, 67, 508, 8, 553, 2, 94, 3, 5, 2,
+  229, 158, 163, 536, 97, 492, 211, 6, 68, 442, 5, 71,
+  172, 52, 14, 881, 210, 62, 286, 20, 57, 1, 4, 273,
+  121, 12, 6, 12, 4, 70, 14, 90, 497, 2, 4, 125,
+  733, 391, 148, 45, 161, 9, 24, 20, 397, 7, 63, 351,
+  193, 2, 36, 79, 313, 453, 56, 68, 3, 9, 252, 118,
+  53, 82, 32, 4, 221, 179, 123, 198, 228, 150, 1110, 2,
+  1, 2, 4, 3, 7, 33, 64, 4, 58, 1055, 53, 1040,
+  160, 1, 1, 121, 379, 10, 489, 735, 74, 743, 562, 665,
+  72, 318, 1, 153, 32, 16, 2, 3, 298, 358, 3, 68,
+  4, 37, 1, 234, 3, 113, 126, 41, 85, 1, 132, 18,
+  2, 40, 5, 1470, 182, 207, 1, 412, 3, 2, 104, 44,
+  1, 53, 502, 7, 2, 741, 23, 2, 116, 12, 93, 16,
+  69, 1, 471, 4, 2, 23, 104, 1301, 271, 92, 3, 149,
+  617, 8, 2437, 365, 1095, 14, 4, 15, 383, 288, 140, 9,
+  59, 550, 117, 15, 61, 273, 244, 81, 32, 3, 45, 366,
+  196, 123, 1, 304, 26, 135, 3, 4293, 1, 21, 3, 29,
+  30, 58, 214, 12, 208, 1193, 1011, 35, 96, 586, 170, 294,
+  0, 38, 116, 10, 359, 125, 37, 68, 20, 31, 542, 1758,
+  792, 33, 1957, 1127, 9, 71, 351, 18, 941, 1296, 102, 245,
+  302, 5403, 993, 324, 9, 1, 1447, 57, 509, 35, 16, 4002,
+  489, 146, 186, 465, 13, 24, 821, 866, 10, 14, 10, 1567,
+  15, 586, 1, 1889, 4264, 7, 1105, 51, 1, 3641, 3028, 358,
+  682, 171, 226, 3582, 156, 4,
+};
+/* clang-format on */
+
+static inline guint32 fnv(const char *name, std::size_t len, guint32 seed)
+{
+  guint32 h = 2166136261u ^ seed;
+  for (std::size_t x = 0; x < len; x++) {
+    h ^= static_cast<unsigned char>(name[x]);
+    h *= 16777619u;
+  }
+  return h;
+}
+
+const HtmlEntity *html_entity_find(const char *name, std::size_t len)
+{
+  if (len == 0 || len > HTML_ENTITY_MAX_NAME) {
+    return NULL;
+  }
+
+  guint32 d = displacements[fnv(name, len, 0) % BUCKETS];
+  const HtmlEntity *entity = &entities[fnv(name, len, d) % ENTITIES];
+  if (entity->len == len && !memcmp(entity->name, name, len)) {
+    return entity;
+  }
+
+  return NULL;
+}
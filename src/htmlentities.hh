@@ -0,0 +1,50 @@
+/*
+ * htmlentities.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <glib.h>
+
+// The longest name, with the semicolon.
+#define HTML_ENTITY_MAX_NAME 32
+
+// The longest name of the references which may be written without a semicolon, like &amp
+#define HTML_ENTITY_MAX_LEGACY 6
+
+/**
+ * \brief an HTML5 named character reference.
+ *
+ * Names with a semicolon at the end are separate entries from their legacy forms without one.
+ */
+struct HtmlEntity {
+  const char *name;
+  unsigned char len;
+  // Some references stand for 2 characters, the second is 0 otherwise.
+  gunichar value[2];
+};
+
+/**
+ * \brief find a named character reference.
+ * \param name the name, without the ampersand.
+ * \param len the length of name.
+ * \return the reference or NULL if there's no such name.
+ */
+const HtmlEntity *html_entity_find(const char *name, std::size_t len);
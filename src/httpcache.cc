@@ -0,0 +1,296 @@
+/*
+ * httpcache.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "httpcache.hh"
+#include "macros.h"
+#include "utils.hh"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <glib/gstdio.h>
+#include <glibmm.h>
+
+/**
+ * \brief constructor.
+ * \param conf our Conf instance.
+ * \param uri the address we are fetching.
+ */
+HttpCache::HttpCache(Conf &conf, const std::string &uri):
+ _uri(uri),
+ _offline(conf.get("http_cache_offline", false)),
+ _limit(static_cast<std::size_t>(conf.get("http_cache_size", 20)) * 1024 * 1024),
+ _has_entry(false),
+ _status(0),
+ _no_store(false),
+ _writing(false),
+ _failed(false)
+{
+  std::string scheme = Glib::uri_parse_scheme(uri);
+  _usable = (scheme == "http" || scheme == "https") && _limit > 0;
+  if (!_usable) {
+    return;
+  }
+
+  _key = Glib::Checksum::compute_checksum(Glib::Checksum::CHECKSUM_SHA1, uri);
+  load();
+}
+
+HttpCache::~HttpCache()
+{
+  discard();
+}
+
+std::string HttpCache::dir()
+{
+  static const std::string dir = Glib::build_filename(Utils::cacheDir(), "http");
+  return dir;
+}
+
+std::string HttpCache::path(const char *ext) const
+{
+  return Glib::build_filename(dir(), _key + ext);
+}
+
+/**
+ * \brief read what we know about our document.
+ */
+void HttpCache::load()
+{
+  if (!Glib::file_test(path(".body"), Glib::FILE_TEST_IS_REGULAR)) {
+    return;
+  }
+
+  std::ifstream ifs(path(".meta").c_str());
+  std::string buff, url;
+  while (getline(ifs, buff)) {
+    std::string::size_type x = buff.find('\t');
+    if (x == std::string::npos) {
+      continue;
+    }
+    std::string key = buff.substr(0, x);
+    std::string value = buff.substr(x + 1);
+    if (key == "url") {
+      url = value;
+    } else if (key == "etag") {
+      _etag = value;
+    } else if (key == "last-modified") {
+      _last_modified = value;
+    } else if (key == "encoding") {
+      _encoding = value;
+    }
+  }
+
+  // Don't trust a checksum collision.
+  _has_entry = url == _uri;
+}
+
+/**
+ * \brief the headers to make our request conditional.
+ * \param headers the headers will be appended to this.
+ */
+void HttpCache::get_request_headers(std::vector<std::string> &headers) const
+{
+  if (!_has_entry) {
+    return;
+  }
+
+  if (_etag.size() > 0) {
+    headers.push_back("If-None-Match: " + _etag);
+  }
+  if (_last_modified.size() > 0) {
+    headers.push_back("If-Modified-Since: " + _last_modified);
+  }
+}
+
+/**
+ * \brief look at a response header line.
+ *
+ * Redirects give us more than one response so a status line starts over.
+ */
+void HttpCache::parse_header(const std::string &line)
+{
+  if (line.compare(0, 5, "HTTP/") == 0) {
+    std::string::size_type x = line.find(' ');
+    _status = x == std::string::npos ? 0 : atoi(line.c_str() + x + 1);
+    _new_etag.clear();
+    _new_last_modified.clear();
+    _no_store = false;
+    return;
+  }
+
+  std::string::size_type x = line.find(':');
+  if (x == std::string::npos) {
+    return;
+  }
+
+  std::string name = line.substr(0, x);
+  std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+  std::string value = line.substr(x + 1);
+  value.erase(0, value.find_first_not_of(" \t"));
+
+  if (name == "etag") {
+    _new_etag = value;
+  } else if (name == "last-modified") {
+    _new_last_modified = value;
+  } else if (name == "cache-control" && value.find("no-store") != std::string::npos) {
+    _no_store = true;
+  }
+}
+
+/**
+ * \brief pass the cached body in chunks and mark it as recently used.
+ * \param slot gets each chunk. Reading stops if it returns false.
+ * \param error contains the error, if any.
+ * \return true on success.
+ */
+bool HttpCache::read(const sigc::slot<bool, const char *, std::size_t> &slot, std::string &error)
+{
+  std::ifstream ifs(path(".body").c_str(), std::ios::in | std::ios::binary);
+  if (!ifs.is_open()) {
+    error = Utils::substitute(_("Failed to open the cached copy of %s"), _uri);
+    return false;
+  }
+
+  // The modification time is our LRU clock.
+  g_utime(path(".body").c_str(), NULL);
+
+  char buff[65536];
+  while (ifs.read(buff, sizeof(buff)) || ifs.gcount() > 0) {
+    if (!slot(buff, ifs.gcount())) {
+      return false;
+    }
+  }
+
+  if (ifs.bad()) {
+    error = Utils::substitute(_("Failed to read the cached copy of %s"), _uri);
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * \brief store a chunk of a new body.
+ *
+ * Nothing is stored unless the server sent a 200. A failure only disables caching.
+ */
+void HttpCache::write(const char *data, std::size_t len)
+{
+  if (!_usable || _failed || _no_store || _status != 200) {
+    return;
+  }
+
+  if (!_writing) {
+    if (g_mkdir_with_parents(dir().c_str(), 0700) == -1) {
+      _failed = true;
+      return;
+    }
+    _tmp.open(path(".tmp").c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    _writing = true;
+  }
+
+  _tmp.write(data, len);
+  if (!_tmp) {
+    _failed = true;
+  }
+}
+
+/**
+ * \brief keep the body we just downloaded.
+ * \param encoding the name of the encoding we detected.
+ */
+void HttpCache::commit(const std::string &encoding)
+{
+  if (!_writing) {
+    return;
+  }
+
+  _tmp.close();
+  _writing = false;
+  if (_failed || !_tmp) {
+    g_unlink(path(".tmp").c_str());
+    return;
+  }
+
+  std::ofstream ofs(path(".meta").c_str());
+  ofs << "url\t" << _uri << std::endl
+      << "etag\t" << _new_etag << std::endl
+      << "last-modified\t" << _new_last_modified << std::endl
+      << "encoding\t" << encoding << std::endl;
+  ofs.close();
+
+  if (!ofs || g_rename(path(".tmp").c_str(), path(".body").c_str()) == -1) {
+    g_unlink(path(".tmp").c_str());
+    g_unlink(path(".meta").c_str());
+    return;
+  }
+
+  evict();
+}
+
+/**
+ * \brief forget a body we started downloading.
+ */
+void HttpCache::discard()
+{
+  if (_writing) {
+    _tmp.close();
+    _writing = false;
+    g_unlink(path(".tmp").c_str());
+  }
+}
+
+/**
+ * \brief drop the least recently used documents until we are under the limit.
+ */
+void HttpCache::evict()
+{
+  std::vector<std::pair<time_t, std::pair<std::string, goffset> > > files;
+  goffset total = 0;
+
+  try {
+    Glib::Dir d(dir());
+    for (Glib::DirIterator iter = d.begin(); iter != d.end(); iter++) {
+      std::string name = *iter;
+      if (name.size() < 5 || name.compare(name.size() - 5, 5, ".body") != 0) {
+        continue;
+      }
+      GStatBuf st;
+      if (g_stat(Glib::build_filename(dir(), name).c_str(), &st) == 0) {
+        files.push_back(std::make_pair(st.st_mtime, std::make_pair(name, st.st_size)));
+        total += st.st_size;
+      }
+    }
+  } catch (Glib::FileError &err) {
+    return;
+  }
+
+  std::sort(files.begin(), files.end());
+  for (unsigned x = 0; x < files.size() && total > static_cast<goffset>(_limit); x++) {
+    const std::string &name = files[x].second.first;
+    const std::string key = name.substr(0, name.size() - 5);
+    g_unlink(Glib::build_filename(dir(), name).c_str());
+    g_unlink(Glib::build_filename(dir(), key + ".meta").c_str());
+    total -= files[x].second.second;
+  }
+}
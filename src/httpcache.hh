@@ -0,0 +1,101 @@
+/*
+ * httpcache.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include "conf.hh"
+#include <fstream>
+#include <sigc++/slot.h>
+#include <string>
+#include <vector>
+
+/**
+ * \brief The on-disk cache of remote documents.
+ *
+ * One instance handles one transfer. Bodies are kept under Utils::cacheDir()/http keyed by
+ * a checksum of the URL, next to a small file with the URL, the ETag, the Last-Modified date
+ * and the encoding we detected. When we have a copy we send a conditional request and a 304
+ * reply is served from the disk. The cache is trimmed to http_cache_size megabytes, dropping
+ * the least recently used documents first. With http_cache_offline set we never go to the
+ * network for a document we have.
+ */
+class HttpCache {
+ public:
+  HttpCache(Conf &, const std::string &);
+  ~HttpCache();
+
+  bool usable() const
+  {
+    return _usable;
+  }
+  bool has_entry() const
+  {
+    return _has_entry;
+  }
+  bool offline() const
+  {
+    return _offline;
+  }
+  bool not_modified() const
+  {
+    return _has_entry && _status == 304;
+  }
+  const std::string &get_encoding() const
+  {
+    return _encoding;
+  }
+
+  void get_request_headers(std::vector<std::string> &) const;
+  void parse_header(const std::string &);
+  bool read(const sigc::slot<bool, const char *, std::size_t> &, std::string &);
+  void write(const char *, std::size_t);
+  void commit(const std::string &);
+  void discard();
+
+ private:
+  HttpCache(const HttpCache &);
+  HttpCache &operator=(const HttpCache &);
+
+  static std::string dir();
+  void load();
+  void evict();
+  std::string path(const char *) const;
+
+  std::string _uri;
+  std::string _key;
+  bool _usable;
+  bool _offline;
+  std::size_t _limit;
+
+  // What we have on disk.
+  bool _has_entry;
+  std::string _etag;
+  std::string _last_modified;
+  std::string _encoding;
+
+  // What the server is sending us.
+  int _status;
+  bool _no_store;
+  std::string _new_etag;
+  std::string _new_last_modified;
+  std::ofstream _tmp;
+  bool _writing;
+  bool _failed;
+};
@@ -21,27 +21,25 @@
 
 #include <config.h>
 
+#include "codec.hh"
+#include "html.hh"
 #include "import.hh"
 #include "macros.h"
 #include "utils.hh"
+#include <cstdio>
 #include <glibmm/fileutils.h>
 #include <glibmm/miscutils.h>
 #include <glibmm/ustring.h>
 #include <vector>
 
-#ifdef HAVE_GZIP
-#include <zlib.h>
-#endif
-
-#ifdef HAVE_BZIP2
-#include <bzlib.h>
-#endif
-
 #ifdef HAVE_FRIBIDI
-#include "shape_arabic.h"
-#include <fribidi/fribidi.h>
+#include "ucs4string.hh"
+#include <cstring>
 #endif
 
+// HTML files are decoded in chunks of that size.
+#define READ_SIZE 1048576
+
 void import_init(std::vector<Import> &import)
 {
   Import imp;
@@ -62,6 +60,18 @@ void import_init(std::vector<Import> &import)
   import.push_back(imp);
 #endif
 
+#ifdef HAVE_XZ
+  imp.name = _("Text file compressed with _xz");
+  imp.func = katoob_import_xz;
+  import.push_back(imp);
+#endif
+
+#ifdef HAVE_ZSTD
+  imp.name = _("Text file compressed with _zstd");
+  imp.func = katoob_import_zstd;
+  import.push_back(imp);
+#endif
+
 #ifdef HAVE_FRIBIDI
   imp.name = _("Text with _shaping and bidi applied");
   imp.func = katoob_import_bidi_shape;
@@ -69,187 +79,138 @@ void import_init(std::vector<Import> &import)
 #endif
 }
 
-bool katoob_import_html(std::string &file, std::string &_out)
+bool katoob_import_html(std::string &file, std::string &out)
 {
-  Glib::ustring out;
-  std::string contents;
-
-  if (!Utils::katoob_read(file, contents)) {
-    out = contents;
+  if (Glib::file_test(file, Glib::FILE_TEST_IS_DIR)) {
+    out = Utils::substitute(_("%s is a directory."), file);
     return false;
   }
 
-  std::string num;
-  for (unsigned x = 0; x < contents.size(); x++) {
-    if (x + 1 < contents.size()) {
-      if ((contents[x] == '&') && (contents[x + 1] == '#')) {
-        ++x;
-        ++x;
-        num.clear();
-        while (x < contents.size()) {
-          if (contents[x] == ';') {
-            gunichar n = atoi(num.c_str());
-            out += n;
-            break;
-          } else {
-            num += contents[x++];
-          }
-        }
-      } else {
-        out += contents[x];
-      }
-    } else {
-      out += contents[x];
-    }
-  }
-  _out = out;
-  return true;
-}
-
-#ifdef HAVE_GZIP
-bool katoob_import_gz(std::string &file, std::string &out)
-{
-  // Is it really a gzipped file ?
   FILE *fp = fopen(file.c_str(), "rb");
   if (!fp) {
     out = _("Can't open file.");
     return false;
   }
 
-  int fd = fileno(fp);
-  if (fd == -1) {
-    out = _("Can't open file.");
-    fclose(fp);
-    return false;
+  std::string text;
+  HtmlDecoder decoder;
+  std::vector<char> buf(READ_SIZE);
+  while (true) {
+    std::size_t n = fread(&buf[0], 1, buf.size(), fp);
+    if (n == 0) {
+      break;
+    }
+    decoder.decode(&buf[0], n, text);
   }
 
-  unsigned char buff[2];
-  if ((read(fd, &buff, 2) == 2) && (buff[0] == 0x1f) && (buff[1] == 0x8b)) {
-    close(fd);
-    fclose(fp);
-    // Do nothing.
-    ;
-  } else {
-    close(fd);
-    fclose(fp);
+  bool ok = !ferror(fp);
+  fclose(fp);
+
+  if (!ok) {
     out = _("Error reading file.");
     return false;
   }
 
-  gzFile zfile = gzopen(file.c_str(), "rb");
-  if (zfile == NULL) {
-    out = _("Can't open file.");
-    return false;
-  }
+  decoder.finish(text);
+  out.swap(text);
+  return true;
+}
 
-  int x;
-  char c;
-  while (true) {
-    x = gzread(zfile, &c, 1);
-    if (x == 1) {
-      out += c;
-    } else if (x == 0) {
-      break;
-    } else {
-      // Error.
-      out = _("Error reading file.");
-      gzclose(zfile);
-      return false;
-    }
+/**
+ * \brief decompress a file.
+ * \param format the format of the file.
+ * \param file the file.
+ * \param out the text, or the error.
+ * \return true on success.
+ */
+static bool import_compressed(Codec::Format format, std::string &file, std::string &out)
+{
+  std::string error;
+  if (!Codec::decode_file(format, file, out, error)) {
+    out = error;
+    return false;
   }
-  gzclose(zfile);
   return true;
 }
+
+#ifdef HAVE_GZIP
+bool katoob_import_gz(std::string &file, std::string &out)
+{
+  return import_compressed(Codec::GZIP, file, out);
+}
 #endif
 
 #ifdef HAVE_BZIP2
 bool katoob_import_bz2(std::string &file, std::string &out)
 {
-  BZFILE *bzfile;
-  bzfile = BZ2_bzopen(file.c_str(), "rb");
-  if (bzfile == NULL) {
-    out = _("Can't open file.");
-    return false;
-  }
+  return import_compressed(Codec::BZIP2, file, out);
+}
+#endif
 
-  int x;
-  char c;
-  while (true) {
-    x = BZ2_bzread(bzfile, &c, 1);
-    if (x == 1) {
-      out += c;
-    } else if (x == 0) {
-      break;
-    } else {
-      // Error.
-      out = _("Error reading file.");
-      BZ2_bzclose(bzfile);
-      return false;
-    }
-  }
-  BZ2_bzclose(bzfile);
-  return true;
+#ifdef HAVE_XZ
+bool katoob_import_xz(std::string &file, std::string &out)
+{
+  return import_compressed(Codec::XZ, file, out);
+}
+#endif
+
+#ifdef HAVE_ZSTD
+bool katoob_import_zstd(std::string &file, std::string &out)
+{
+  return import_compressed(Codec::ZSTD, file, out);
 }
 #endif
 
 #ifdef HAVE_FRIBIDI
 bool katoob_import_bidi_shape(std::string &file, std::string &out)
 {
-  Glib::ustring contents;
+  std::string contents;
 
-  if (!Utils::katoob_read(file, out)) {
+  if (!Utils::katoob_read(file, contents)) {
+    out = contents;
     return false;
   }
 
-  contents = out;
-  out.clear();
-
-  // We need to feed fribidi  line only or it'll reverse the whole text string.
-  gchar **tmp = g_strsplit(contents.c_str(), "\n", 0);
-  std::vector<Glib::ustring> lines;
-  for (gchar **t = tmp; *t; t++) {
-    lines.push_back(*t);
+  if (!g_utf8_validate(contents.data(), contents.size(), NULL)) {
+    out = _("The file is not valid UTF-8.");
+    return false;
   }
 
-  g_strfreev(tmp);
-  contents.clear();
+  out.clear();
+  out.reserve(contents.size());
 
-  for (unsigned i = 0; i < lines.size(); i++) {
-    gunichar *ch = new gunichar[lines[i].size() + 1];
-    for (unsigned x = 0; x < lines[i].size(); x++) {
-      ch[x] = lines[i][x];
-    }
+  Ucs4String ch, unshaped, visual;
 
-    unsigned l = lines[i].size();
+  // We need to feed fribidi  line only or it'll reverse the whole text string.
+  const char *start = contents.data();
+  const char *end = start + contents.size();
+  while (true) {
+    const char *nl = static_cast<const char *>(memchr(start, '\n', end - start));
+    if (!nl) {
+      nl = end;
+    }
 
-    unsigned length;
+    ch.assign(start, nl - start);
 
     // let's unshape.
-    gunichar *_ch = unshape_arabic(ch, l, &length);
-    delete[] ch;
+    ch.unshape(unshaped);
 
     // Now we apply the bidi.
-    FriBidiCharType base = FRIBIDI_TYPE_RTL;
-    ch = new gunichar[length + 1];
-    if (!fribidi_log2vis(_ch, length, &base, ch, NULL, NULL, NULL)) {
-      g_free(_ch);
-      delete[] ch;
+    if (!unshaped.log2vis(visual)) {
       out = _("Couldn't apply the bidi algorithm.");
       return false;
     }
-    g_free(_ch);
 
-    for (unsigned x = 0; x < length; x++) {
-      contents += ch[x];
-    }
+    visual.append_to(out);
     // TODO: We need to check whether the document has a \n at the end or not.
-    contents += '\n';
+    out += '\n';
 
-    delete[] ch;
+    if (nl == end) {
+      break;
+    }
+    start = nl + 1;
   }
 
-  out = contents;
-
   return true;
 }
 #endif
@@ -40,6 +40,12 @@ bool katoob_import_gz(std::string &, std::string &);
 #ifdef HAVE_BZIP2
 bool katoob_import_bz2(std::string &, std::string &);
 #endif
+#ifdef HAVE_XZ
+bool katoob_import_xz(std::string &, std::string &);
+#endif
+#ifdef HAVE_ZSTD
+bool katoob_import_zstd(std::string &, std::string &);
+#endif
 #ifdef HAVE_FRIBIDI
 bool katoob_import_bidi_shape(std::string &, std::string &);
 #endif
@@ -24,12 +24,38 @@
 #include "isocodes.hh"
 #include "macros.h"
 #include "utils.hh"
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <glib/gstdio.h>
+#include <vector>
 
 #define LANG_CODES        "iso_639"
 #define COUNTRY_CODES     "iso_3166"
 #define ISOCODESLOCALEDIR ISOCODES_PREFIX "/share/locale"
 
+#define CACHE_FILE  "isocodes"
+#define CACHE_MAGIC "KISO0001"
+
+/*
+ * The cache is the header, the language entries then the country entries, each sorted by code,
+ * followed by the NUL terminated strings. Entries point to their strings by their offset from
+ * the start of the file.
+ */
+struct IsoCodesHeader {
+  char magic[8];
+  // The modification times of the files we parsed.
+  gint64 mtime[2];
+  // The offset of the languages gettext used for the names.
+  guint32 languages;
+  guint32 count[2];
+};
+
+struct IsoCodesEntry {
+  guint32 code;
+  guint32 name;
+};
+
 static void __country_codes(void *data, const char *el, const char **attr)
 {
   return static_cast<IsoCodes *>(data)->country_codes(el, attr);
@@ -40,40 +66,199 @@ static void __lang_codes(void *data, const char *el, const char **attr)
   return static_cast<IsoCodes *>(data)->lang_codes(el, attr);
 }
 
-IsoCodes::IsoCodes()
+static std::string source_file(const char *domain)
+{
+  return Utils::substitute("%s/share/xml/iso-codes/%s.xml", ISOCODES_PREFIX, domain);
+}
+
+// The names are translated, The cache is only good for the languages it was built for.
+static std::string languages()
 {
   std::string str;
-  std::string file;
-  if ((_lang_codes.size() == 0) || (_country_codes.size() == 0)) {
-    XML_Parser p = XML_ParserCreate(NULL);
-    if (!p) {
-      //      error = _("Couldn't allocate memory for parser");
-      //      _ok = false;
-      return;
+  for (const gchar *const *l = g_get_language_names(); *l; l++) {
+    str += *l;
+    str += ':';
+  }
+  return str;
+}
+
+IsoCodes::IsoCodes()
+{
+}
+
+// Parsing the iso-codes files takes a while, We only do it once something needs a translation
+// and we keep the result in a cache we can map the next time.
+void IsoCodes::load()
+{
+  if (_loaded) {
+    return;
+  }
+  _loaded = true;
+
+  gint64 mtime[2] = {0, 0};
+  const char *domains[2] = {LANG_CODES, COUNTRY_CODES};
+  for (int x = 0; x < 2; x++) {
+    GStatBuf buf;
+    if (g_stat(source_file(domains[x]).c_str(), &buf) == 0) {
+      mtime[x] = buf.st_mtime;
     }
-    if (_lang_codes.size() == 0) {
-      bindtextdomain(LANG_CODES, ISOCODESLOCALEDIR);
-      bind_textdomain_codeset(LANG_CODES, "UTF-8");
-      file = Utils::substitute("%s/share/xml/iso-codes/%s.xml", ISOCODES_PREFIX, LANG_CODES);
-      Utils::katoob_read(file, str);
-
-      XML_SetUserData(p, this);
-      XML_SetElementHandler(p, __lang_codes, NULL);
-      XML_Parse(p, str.c_str(), str.size(), 1);
-      XML_ParserReset(p, NULL);
+  }
+
+  std::string langs = languages();
+  std::string cache = Glib::build_filename(Utils::cacheDir(), CACHE_FILE);
+
+  _file = g_mapped_file_new(cache.c_str(), FALSE, NULL);
+  if (_file) {
+    const char *data = g_mapped_file_get_contents(_file);
+    std::size_t size = g_mapped_file_get_length(_file);
+    if (valid(data, size, mtime, langs)) {
+      _data = data;
+      _size = size;
+      return;
     }
-    if (_country_codes.size() == 0) {
-      bindtextdomain(COUNTRY_CODES, ISOCODESLOCALEDIR);
-      bind_textdomain_codeset(COUNTRY_CODES, "UTF-8");
-      file = Utils::substitute("%s/share/xml/iso-codes/%s.xml", ISOCODES_PREFIX, COUNTRY_CODES);
-      Utils::katoob_read(file, str);
-
-      XML_SetUserData(p, this);
-      XML_SetElementHandler(p, __country_codes, NULL);
-      XML_Parse(p, str.c_str(), str.size(), 1);
+    g_mapped_file_unref(_file);
+    _file = NULL;
+  }
+
+  build(mtime, langs);
+  _data = _built.data();
+  _size = _built.size();
+
+  if (g_mkdir_with_parents(Utils::cacheDir().c_str(), 0700) == 0) {
+    g_file_set_contents(cache.c_str(), _built.data(), _built.size(), NULL);
+  }
+}
+
+bool IsoCodes::valid(const char *data,
+                     std::size_t size,
+                     const gint64 *mtime,
+                     const std::string &langs)
+{
+  if ((size < sizeof(IsoCodesHeader)) || (data[size - 1] != '\0')) {
+    return false;
+  }
+
+  const IsoCodesHeader *header = reinterpret_cast<const IsoCodesHeader *>(data);
+  if ((memcmp(header->magic, CACHE_MAGIC, sizeof(header->magic))) ||
+      (header->mtime[0] != mtime[0]) || (header->mtime[1] != mtime[1]) ||
+      (header->languages >= size) || (langs != data + header->languages)) {
+    return false;
+  }
+
+  std::size_t count = static_cast<std::size_t>(header->count[0]) + header->count[1];
+  if (count > (size - sizeof(IsoCodesHeader)) / sizeof(IsoCodesEntry)) {
+    return false;
+  }
+
+  // The last byte is a NUL so any offset inside the file is a valid string.
+  const IsoCodesEntry *entries = reinterpret_cast<const IsoCodesEntry *>(header + 1);
+  for (std::size_t x = 0; x < count; x++) {
+    if ((entries[x].code >= size) || (entries[x].name >= size)) {
+      return false;
     }
+  }
+
+  return true;
+}
+
+void IsoCodes::build(const gint64 *mtime, const std::string &langs)
+{
+  std::string str;
+  XML_Parser p = XML_ParserCreate(NULL);
+  if (p) {
+    bindtextdomain(LANG_CODES, ISOCODESLOCALEDIR);
+    bind_textdomain_codeset(LANG_CODES, "UTF-8");
+    Utils::katoob_read(source_file(LANG_CODES), str);
+
+    XML_SetUserData(p, this);
+    XML_SetElementHandler(p, __lang_codes, NULL);
+    XML_Parse(p, str.c_str(), str.size(), 1);
+    XML_ParserReset(p, NULL);
+
+    bindtextdomain(COUNTRY_CODES, ISOCODESLOCALEDIR);
+    bind_textdomain_codeset(COUNTRY_CODES, "UTF-8");
+    Utils::katoob_read(source_file(COUNTRY_CODES), str);
+
+    XML_SetUserData(p, this);
+    XML_SetElementHandler(p, __country_codes, NULL);
+    XML_Parse(p, str.c_str(), str.size(), 1);
     XML_ParserFree(p);
   }
+
+  IsoCodesHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+  header.mtime[0] = mtime[0];
+  header.mtime[1] = mtime[1];
+  header.count[0] = _lang_codes.size();
+  header.count[1] = _country_codes.size();
+
+  std::vector<IsoCodesEntry> entries;
+  std::string strings;
+  std::size_t base =
+      sizeof(IsoCodesHeader) + (_lang_codes.size() + _country_codes.size()) * sizeof(IsoCodesEntry);
+
+  // A map is already sorted the way we search.
+  std::map<std::string, std::string> *tables[2] = {&_lang_codes, &_country_codes};
+  for (int x = 0; x < 2; x++) {
+    for (std::map<std::string, std::string>::iterator iter = tables[x]->begin();
+         iter != tables[x]->end();
+         iter++) {
+      IsoCodesEntry entry;
+      entry.code = base + strings.size();
+      strings.append(iter->first.c_str(), iter->first.size() + 1);
+      entry.name = base + strings.size();
+      strings.append(iter->second.c_str(), iter->second.size() + 1);
+      entries.push_back(entry);
+    }
+    tables[x]->clear();
+  }
+
+  header.languages = base + strings.size();
+  strings.append(langs.c_str(), langs.size() + 1);
+
+  _built.assign(reinterpret_cast<const char *>(&header), sizeof(header));
+  if (entries.size() > 0) {
+    _built.append(reinterpret_cast<const char *>(&entries[0]),
+                  entries.size() * sizeof(IsoCodesEntry));
+  }
+  _built.append(strings);
+}
+
+struct IsoCodesLess {
+  const char *data;
+  bool operator()(const IsoCodesEntry &entry, const std::string &code) const
+  {
+    return strcmp(data + entry.code, code.c_str()) < 0;
+  }
+};
+
+/**
+ * \brief look a code up in one of our tables.
+ * \param table 0 for the languages and 1 for the countries.
+ * \param code the code.
+ * \return the translated name or NULL.
+ */
+const char *IsoCodes::find(int table, const std::string &code)
+{
+  if (_size == 0) {
+    return NULL;
+  }
+
+  const IsoCodesHeader *header = reinterpret_cast<const IsoCodesHeader *>(_data);
+  const IsoCodesEntry *first = reinterpret_cast<const IsoCodesEntry *>(header + 1);
+  if (table == 1) {
+    first += header->count[0];
+  }
+  const IsoCodesEntry *last = first + header->count[table];
+
+  IsoCodesLess less = {_data};
+  const IsoCodesEntry *entry = std::lower_bound(first, last, code, less);
+  if ((entry == last) || (code != _data + entry->code)) {
+    return NULL;
+  }
+
+  return _data + entry->name;
 }
 
 void IsoCodes::country_codes(const char *elem, const char **attrs)
@@ -120,34 +305,33 @@ void IsoCodes::filter(const std::string &elem,
 
 std::string IsoCodes::translate(const std::string &str)
 {
+  load();
+
   std::string::size_type loc = str.find("_", 0);
   if (loc != std::string::npos) {
     std::string l(str, 0, loc);
     std::string c(str, ++loc);
 
-    std::map<std::string, std::string>::iterator iter1 = _lang_codes.find(l);
-    std::map<std::string, std::string>::iterator iter2 = _country_codes.find(c);
+    const char *lang = find(0, l);
+    const char *country = find(1, c);
 
-    if ((iter1 != _lang_codes.end()) && (iter2 != _country_codes.end())) {
-      return Utils::substitute(_("%s (%s)"), iter1->second, iter2->second);
+    if ((lang) && (country)) {
+      return Utils::substitute(_("%s (%s)"), lang, country);
     } else {
       return str;
     }
   } else {
-    std::map<std::string, std::string>::iterator iter = _lang_codes.find(str);
-    if (iter == _lang_codes.end()) {
+    const char *lang = find(0, str);
+    if (!lang) {
       return str;
     } else {
-      return iter->second;
+      return lang;
     }
   }
-
-  std::map<std::string, std::string>::iterator iter = _lang_codes.find(str);
-  if (iter == _lang_codes.end()) {
-    return str;
-  }
-
-  return iter->second;
 }
 
-std::map<std::string, std::string> IsoCodes::_lang_codes, IsoCodes::_country_codes;
+bool IsoCodes::_loaded = false;
+GMappedFile *IsoCodes::_file = NULL;
+std::string IsoCodes::_built;
+const char *IsoCodes::_data = NULL;
+std::size_t IsoCodes::_size = 0;
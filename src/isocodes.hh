@@ -22,6 +22,7 @@
 #pragma once
 
 #include <expat.h>
+#include <glib.h>
 #include <map>
 #include <string>
 
@@ -35,6 +36,10 @@ class IsoCodes {
   void lang_codes(const char *, const char **);
 
  private:
+  void load();
+  bool valid(const char *, std::size_t, const gint64 *, const std::string &);
+  void build(const gint64 *, const std::string &);
+  const char *find(int, const std::string &);
   void filter(const std::string &,
               const char **,
               const std::string &,
@@ -42,5 +47,13 @@ class IsoCodes {
               const std::string &,
               std::map<std::string, std::string> &,
               const char *);
-  static std::map<std::string, std::string> _lang_codes, _country_codes;
+  // Only used while we build the cache.
+  std::map<std::string, std::string> _lang_codes, _country_codes;
+
+  // The cache, Either mapped or what we have just built.
+  static bool _loaded;
+  static GMappedFile *_file;
+  static std::string _built;
+  static const char *_data;
+  static std::size_t _size;
 };
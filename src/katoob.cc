@@ -22,10 +22,14 @@
 #include <config.h>
 
 #include "dialogs.hh"
+#include "dictclient.hh"
 #include "katoob.hh"
 #include "macros.h"
 #include "network.hh"
+#include "startupprofile.hh"
 #include <csignal>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 //#include "utils.hh"
 
@@ -34,30 +38,27 @@
  *
  * The constructor will initialize Gtk::Main, call Katoob::parse to parse the command
  * line arguments we get.
- * If compiled with DBus sypport, it will try to check if there's a running instance
- * of katoob. If it finds one, we will message it to open Katoob::files.
+ * If compiled with DBus sypport and main() didn't already do it through Katoob::handoff,
+ * it will try to message a running instance of katoob to open Katoob::files.
  * If we can send the message, we will exit. Otherwise we
  * will start DBus::start
  */
 Katoob::Katoob(int argc, char *argv[]): Gtk::Main(argc, argv), conf(encodings)
 {
+  StartupProfile::mark("Gtk, encodings and configuration");
+
   Network net(conf);
 
-  parse(argc, argv);
+  parse(argc, argv, files);
 
 #ifdef ENABLE_DBUS
-  if (DBus::ping()) {
-    if (DBus::open_files(files)) {
-      exit(0);
-    } else {
-      dbus.start();
-    }
-  } else {
-    dbus.start();
+  if ((!_handoff_tried) && (DBus::open_files(files))) {
+    StartupProfile::mark("Handed the files to a running instance");
+    StartupProfile::report();
+    exit(0);
   }
-#endif
-#ifdef ENABLE_HIGHLIGHT
-  SourceManager::init();
+  dbus.start();
+  StartupProfile::mark("DBus");
 #endif
 
   Glib::set_application_name(PACKAGE);
@@ -95,6 +96,7 @@ Katoob::~Katoob()
   }
   children.clear();
   Network::destroy();
+  DictClient::destroy();
 }
 
 /**
@@ -120,16 +122,53 @@ void Katoob::signal_cb(int signum)
   exit(255);
 }
 
+#ifdef ENABLE_DBUS
+/**
+ * \brief pass our files to a running instance.
+ *
+ * This is called by main() before we initialize Gtk so a second katoob doesn't pay for
+ * loading Gtk, the encodings and the configuration just to hand its files over.
+ * We don't try if we have arguments that only Gtk understands, if we are to read stdin or if
+ * we are profiling the startup. The constructor tries again in the first two cases.
+ * \param argc the argc parameter passed to main().
+ * \param argv the argv parameter passed to main().
+ * \return true if a running instance took our files and we should exit.
+ */
+bool Katoob::handoff(int argc, char *argv[])
+{
+  // Profiling is about our own startup, there would be nothing to report.
+  if (StartupProfile::enabled()) {
+    return false;
+  }
+
+  std::vector<OpenFile> f;
+  if (!parse(argc, argv, f)) {
+    return false;
+  }
+
+  _handoff_tried = true;
+  return DBus::open_files(f);
+}
+#endif
+
 /**
  * \brief parse the command line arguments.
  *
  * Parse the command line arguments and take actions accordingly.
- * If we are passed one or more files, we will put them in Katoob::files.
+ * If we are passed one or more files, we will put them in files.
+ * --encoding=CHARSET applies to all the files after it and +LINE[:COLUMN] to the next file.
  * \param argc the argc parameter passed to main().
  * \param argv the argv parameter passed to main().
+ * \param files where to put the files.
+ * \return false if we got an option we don't know, were asked to read stdin or got a file name
+ * D-Bus can't carry.
  */
-void Katoob::parse(int argc, char *argv[])
+bool Katoob::parse(int argc, char *argv[], std::vector<OpenFile> &files)
 {
+  bool known = true;
+  std::string encoding;
+  int line = 0, column = 0;
+
   for (int x = 1; x < argc; x++) {
     if ((!strcmp(argv[x], "-u")) || (!strcmp(argv[x], "--usage"))) {
       usage();
@@ -143,8 +182,40 @@ void Katoob::parse(int argc, char *argv[])
       version();
       exit(0);
     }
-    files.push_back(argv[x]);
+    if (!strcmp(argv[x], "--profile-startup")) {
+      // main() already took care of it.
+      continue;
+    }
+    if (!strncmp(argv[x], "--encoding=", 11)) {
+      encoding = argv[x] + 11;
+      continue;
+    }
+    if ((argv[x][0] == '+') && (g_ascii_isdigit(argv[x][1]))) {
+      char *end;
+      line = strtol(argv[x] + 1, &end, 10);
+      column = *end == ':' ? strtol(end + 1, nullptr, 10) : 0;
+      continue;
+    }
+    if ((!strcmp(argv[x], "-")) || (!strncmp(argv[x], "--", 2))) {
+      // stdin, or an option Gtk::Main would have removed.
+      known = false;
+    }
+    if ((!g_utf8_validate(argv[x], -1, nullptr)) ||
+        (!g_utf8_validate(encoding.c_str(), -1, nullptr))) {
+      known = false;
+    }
+
+    OpenFile file;
+    file.path = argv[x];
+    file.encoding = encoding;
+    file.line = line;
+    file.column = column;
+    files.push_back(file);
+
+    line = column = 0;
   }
+
+  return known;
 }
 
 /**
@@ -153,10 +224,24 @@ void Katoob::parse(int argc, char *argv[])
  */
 int Katoob::run()
 {
+  if (StartupProfile::enabled()) {
+    Glib::signal_idle().connect(sigc::ptr_fun(&Katoob::startup_done_cb));
+  }
+
   Gtk::Main::run();
   return 0;
 }
 
+/**
+ * \brief the first window is up and we are idle, print the startup profile.
+ */
+bool Katoob::startup_done_cb()
+{
+  StartupProfile::mark("First main loop iteration");
+  StartupProfile::report();
+  return false;
+}
+
 /**
  * \brief create a new Window
  */
@@ -176,7 +261,12 @@ void Katoob::window()
  */
 void Katoob::usage()
 {
-  std::cout << "usage: katoob [--help] [--version] [--usage] [file1 file2 file3... ]" << std::endl;
+  std::cout << "usage: katoob [--help] [--version] [--usage] [--profile-startup] "
+               "[--encoding=CHARSET] [[+LINE[:COLUMN]] file1 file2 file3... ]"
+            << std::endl;
+#ifdef ENABLE_PRINT
+  std::cout << "       katoob --print-to-pdf OUT_DIR FILE..." << std::endl;
+#endif
 }
 
 /**
@@ -195,7 +285,18 @@ void Katoob::help()
   std::cout << "usage: katoob  [OPTIONS] [FILES_TO_OPEN]" << std::endl
             << "  -h, --help       Show this help message" << std::endl
             << "  -v, --version    Display version information" << std::endl
-            << "  -u, --usage      Display brief usage message" << std::endl;
+            << "  -u, --usage      Display brief usage message" << std::endl
+            << "  --profile-startup" << std::endl
+            << "                   Print how long each startup phase took, loading the files"
+            << std::endl
+            << "                   included" << std::endl
+            << "  --encoding=CHARSET" << std::endl
+            << "                   Open the files that follow in CHARSET" << std::endl
+            << "  +LINE[:COLUMN]   Put the cursor at LINE and COLUMN of the next file" << std::endl;
+#ifdef ENABLE_PRINT
+  std::cout << "  --print-to-pdf OUT_DIR FILE..." << std::endl
+            << "                   Print the files to PDF files in OUT_DIR and exit" << std::endl;
+#endif
 }
 
 /**
@@ -207,3 +308,6 @@ void Katoob::quit_cb()
 }
 
 std::vector<Window *> Katoob::children;
+#ifdef ENABLE_DBUS
+bool Katoob::_handoff_tried = false;
+#endif
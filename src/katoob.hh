@@ -23,6 +23,7 @@
 
 #include "conf.hh"
 #include "encodings.hh"
+#include "openfile.hh"
 #include "window.hh"
 #include <gtkmm.h>
 #include <vector>
@@ -44,15 +45,21 @@ class Katoob: public Gtk::Main {
 
   void quit_cb();
 
+#ifdef ENABLE_DBUS
+  static bool handoff(int argc, char *argv[]);
+#endif
+
  private:
-  void parse(int argc, char *argv[]);
-  void usage();
-  void help();
-  void version();
+  static bool parse(int argc, char *argv[], std::vector<OpenFile> &);
+  static void usage();
+  static void help();
+  static void version();
 
   /** \brief This is our signal callback. */
   static void signal_cb(int);
 
+  static bool startup_done_cb();
+
   /** \brief An instance of the Encodings class. */
   Encodings encodings;
 
@@ -62,11 +69,14 @@ class Katoob: public Gtk::Main {
 #ifdef ENABLE_DBUS
   /** \brief An instance of the DBus class (If compiled with DBus support). */
   DBus dbus;
+
+  /** \brief whether main() already asked a running instance through Katoob::handoff. */
+  static bool _handoff_tried;
 #endif /* ENABLE_DBUS */
 
   /** \brief our Windows are stored here */
   static std::vector<Window *> children;
 
   /** \brief the files we are passed are stored here by our Katoob::parse function. */
-  std::vector<std::string> files;
+  std::vector<OpenFile> files;
 };
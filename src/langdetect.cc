@@ -0,0 +1,393 @@
+/*
+ * langdetect.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "langdetect.hh"
+#include "spell.hh"
+#include "utils.hh"
+#include <algorithm>
+#include <fstream>
+
+namespace {
+  /** \brief the most frequent trigrams of a language, most frequent first. '_' is a word
+   * boundary. */
+  struct Profile {
+    const char *lang;
+    const char *trigrams[30];
+  };
+
+  const Profile profiles[] = {
+      {"en", {"_th", "the", "he_", "_an", "and", "nd_", "ing", "ng_", "_of", "of_",
+              "_to", "ion", "_in", "ed_", "er_", "ent", "tio", "is_", "_a_", "hat",
+              "tha", "_co", "for", "as_", "re_", "on_", "at_", "es_", "_wh", "ter"}},
+      {"fr", {"_de", "es_", "de_", "le_", "ent", "_le", "_la", "la_", "les", "ion",
+              "que", "_qu", "ue_", "_et", "et_", "des", "_un", "nt_", "_pa", "re_",
+              "par", "_po", "our", "ait", "men", "tio", "ous", "_co", "_so", "eme"}},
+      {"de", {"en_", "er_", "_de", "der", "ich", "ein", "sch", "die", "_di", "ie_",
+              "und", "_un", "nd_", "che", "_ei", "den", "ung", "cht", "_da", "te_",
+              "in_", "gen", "ine", "ber", "_zu", "auf", "ist", "_ge", "ten", "_ve"}},
+      {"es", {"_de", "de_", "_la", "la_", "os_", "as_", "el_", "_el", "es_", "_qu",
+              "que", "ue_", "_en", "en_", "ent", "_co", "_lo", "los", "con", "ado",
+              "_se", "par", "ara", "_po", "nte", "_un", "aci", "ien", "ero", "ón_"}},
+      {"it", {"_di", "di_", "to_", "_ch", "che", "he_", "la_", "_la", "_il", "il_",
+              "re_", "ell", "one", "ne_", "_de", "del", "_co", "lla", "_pe", "per",
+              "ato", "are", "ion", "ent", "_in", "_un", "zio", "no_", "_e_", "gli"}},
+      {"pt", {"_de", "de_", "os_", "_qu", "que", "ue_", "do_", "_do", "as_", "da_",
+              "_da", "ão_", "_co", "ent", "_se", "_pa", "_em", "em_", "ção", "nte",
+              "_na", "com", "_um", "ara", "par", "men", "ado", "es_", "_o_", "_a_"}},
+      {"nl", {"en_", "_de", "de_", "het", "_he", "et_", "an_", "_va", "van", "_ee",
+              "een", "_en", "er_", "ij_", "_in", "_ge", "ing", "aar", "cht", "oor",
+              "_op", "ver", "_ve", "ten", "sch", "_zi", "_wa", "_da", "dat", "lij"}},
+  };
+
+  const int n_profiles = sizeof(profiles) / sizeof(profiles[0]);
+
+  /** \brief languages we can tell by their script alone. */
+  struct ScriptLang {
+    GUnicodeScript script;
+    const char *lang;
+  };
+
+  const ScriptLang scripts[] = {
+      {G_UNICODE_SCRIPT_ARABIC, "ar"},
+      {G_UNICODE_SCRIPT_HEBREW, "he"},
+      {G_UNICODE_SCRIPT_CYRILLIC, "ru"},
+      {G_UNICODE_SCRIPT_GREEK, "el"},
+      {G_UNICODE_SCRIPT_ARMENIAN, "hy"},
+      {G_UNICODE_SCRIPT_GEORGIAN, "ka"},
+      {G_UNICODE_SCRIPT_DEVANAGARI, "hi"},
+      {G_UNICODE_SCRIPT_BENGALI, "bn"},
+      {G_UNICODE_SCRIPT_TAMIL, "ta"},
+      {G_UNICODE_SCRIPT_THAI, "th"},
+  };
+
+  // Letters that only Persian, Urdu or Ukrainian use among their scripts.
+  bool is_persian(gunichar ch)
+  {
+    return ch == 0x067e || ch == 0x0686 || ch == 0x0698 || ch == 0x06af || ch == 0x06a9 ||
+           ch == 0x06cc;
+  }
+
+  bool is_urdu(gunichar ch)
+  {
+    return ch == 0x0679 || ch == 0x0688 || ch == 0x0691 || ch == 0x06ba || ch == 0x06be ||
+           ch == 0x06d2;
+  }
+
+  bool is_ukrainian(gunichar ch)
+  {
+    return ch == 0x0456 || ch == 0x0457 || ch == 0x0454 || ch == 0x0491;
+  }
+
+  /** \brief we don't guess from fewer letters than this. */
+  const int min_letters = 16;
+
+  /** \brief the score a Latin profile needs before we trust it. */
+  const int min_score = 60;
+
+  const char *cache_file = "spell-langs";
+
+  /** \brief we remember the dictionaries of this many files, the most recently used ones. */
+  const unsigned cache_max = 500;
+}   // namespace
+
+/**
+ * \brief guess the language of a text.
+ * \param text UTF-8 text. Only the first LangDetect::sample_size bytes are looked at.
+ * \param len the length of text in bytes.
+ * \return an ISO 639-1 code or an empty string if we can't tell.
+ */
+std::string LangDetect::detect(const char *text, unsigned len)
+{
+  if (len > sample_size) {
+    len = sample_size;
+  }
+
+  std::map<GUnicodeScript, int> counts;
+  std::vector<gunichar> latin;
+  latin.reserve(len);
+  latin.push_back(' ');
+
+  int letters = 0, persian = 0, urdu = 0, ukrainian = 0;
+  const char *p = text, *end = text + len;
+
+  while (p < end) {
+    gunichar ch = g_utf8_get_char_validated(p, end - p);
+    if ((ch == static_cast<gunichar>(-1)) || (ch == static_cast<gunichar>(-2))) {
+      // Invalid or cut in the middle by the sample size.
+      break;
+    }
+    p = g_utf8_next_char(p);
+
+    GUnicodeScript script = G_UNICODE_SCRIPT_COMMON;
+    if (g_unichar_isalpha(ch)) {
+      script = g_unichar_get_script(ch);
+      ++counts[script];
+      ++letters;
+      persian += is_persian(ch);
+      urdu += is_urdu(ch);
+      ukrainian += is_ukrainian(ch);
+    }
+
+    if (script == G_UNICODE_SCRIPT_LATIN) {
+      latin.push_back(g_unichar_tolower(ch));
+    } else if (latin.back() != ' ') {
+      latin.push_back(' ');
+    }
+  }
+
+  if (letters < min_letters) {
+    return "";
+  }
+
+  GUnicodeScript best = G_UNICODE_SCRIPT_COMMON;
+  int best_count = 0;
+  for (std::map<GUnicodeScript, int>::iterator iter = counts.begin(); iter != counts.end();
+       iter++) {
+    if (iter->second > best_count) {
+      best = iter->first;
+      best_count = iter->second;
+    }
+  }
+
+  if (best == G_UNICODE_SCRIPT_LATIN) {
+    if (latin.back() != ' ') {
+      latin.push_back(' ');
+    }
+    return detect_latin(latin);
+  }
+
+  // One in fifty letters is plenty, Arabic and Russian don't use them at all.
+  if ((best == G_UNICODE_SCRIPT_ARABIC) && (urdu * 50 >= best_count)) {
+    return "ur";
+  }
+  if ((best == G_UNICODE_SCRIPT_ARABIC) && (persian * 50 >= best_count)) {
+    return "fa";
+  }
+  if ((best == G_UNICODE_SCRIPT_CYRILLIC) && (ukrainian * 50 >= best_count)) {
+    return "uk";
+  }
+
+  for (unsigned x = 0; x < sizeof(scripts) / sizeof(scripts[0]); x++) {
+    if (scripts[x].script == best) {
+      return scripts[x].lang;
+    }
+  }
+
+  return "";
+}
+
+/**
+ * \brief score lowercased Latin letters against our trigram profiles.
+ * \param text the letters, words are separated by exactly one space.
+ */
+std::string LangDetect::detect_latin(const std::vector<gunichar> &text)
+{
+  init();
+
+  int scores[n_profiles] = {0};
+  std::string key;
+  char buf[6];
+
+  for (unsigned x = 0; x + 2 < text.size(); x++) {
+    key.clear();
+    for (unsigned y = x; y < x + 3; y++) {
+      key.append(buf, g_unichar_to_utf8(text[y] == ' ' ? '_' : text[y], buf));
+    }
+
+    std::unordered_map<std::string, std::vector<std::pair<int, int> > >::const_iterator iter =
+        trigrams.find(key);
+    if (iter == trigrams.end()) {
+      continue;
+    }
+    for (unsigned y = 0; y < iter->second.size(); y++) {
+      scores[iter->second[y].first] += iter->second[y].second;
+    }
+  }
+
+  int best = 0;
+  for (int x = 1; x < n_profiles; x++) {
+    if (scores[x] > scores[best]) {
+      best = x;
+    }
+  }
+
+  return scores[best] >= min_score ? profiles[best].lang : "";
+}
+
+/**
+ * \brief build the trigram lookup table and list the dictionaries once.
+ */
+void LangDetect::init()
+{
+  if (initialized) {
+    return;
+  }
+  initialized = true;
+
+  for (int x = 0; x < n_profiles; x++) {
+    for (int y = 0; y < 30; y++) {
+      // More frequent trigrams weigh more.
+      trigrams[profiles[x].trigrams[y]].push_back(std::make_pair(x, 30 - y));
+    }
+  }
+
+  katoob_spell_list_available(dicts);
+}
+
+/**
+ * \brief the language part of a dictionary tag (en_US -> en).
+ */
+std::string LangDetect::language(const std::string &dict)
+{
+  return dict.substr(0, dict.find_first_of("_-"));
+}
+
+/**
+ * \brief pick an available dictionary for a language.
+ * \param lang the language as returned by LangDetect::detect.
+ * \param current the dictionary in use now. We keep it if it's for the same language.
+ * \param dict the dictionary to switch to.
+ * \return true if we should switch to dict.
+ */
+bool LangDetect::get_dictionary(const std::string &lang,
+                                const std::string &current,
+                                std::string &dict)
+{
+  if ((lang.size() == 0) || (language(current) == lang)) {
+    return false;
+  }
+
+  init();
+
+  for (unsigned x = 0; x < dicts.size(); x++) {
+    if (dicts[x] == lang) {
+      dict = dicts[x];
+      return true;
+    }
+  }
+
+  for (unsigned x = 0; x < dicts.size(); x++) {
+    if (language(dicts[x]) == lang) {
+      dict = dicts[x];
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * \brief get the dictionary last used with a file.
+ * \return false if we don't know the file.
+ */
+bool LangDetect::lookup(const std::string &file, std::string &dict)
+{
+  load_cache();
+
+  std::map<std::string, std::pair<std::string, unsigned> >::iterator iter = cache.find(file);
+  if (iter == cache.end()) {
+    return false;
+  }
+  dict = iter->second.first;
+  return true;
+}
+
+/**
+ * \brief remember the dictionary used with a file.
+ *
+ * The change is appended to the cache file. Later lines override earlier ones and the file is
+ * compacted to the LangDetect::cache_max most recent files once it has grown to twice that.
+ */
+void LangDetect::remember(const std::string &file, const std::string &dict)
+{
+  load_cache();
+
+  std::pair<std::string, unsigned> &old = cache[file];
+  if (old.first == dict) {
+    return;
+  }
+
+  old.first = dict;
+  old.second = cache_lines++;
+
+  if (cache_lines >= 2 * cache_max) {
+    save_cache();
+    return;
+  }
+
+  std::ofstream ofs(Glib::build_filename(Utils::cacheDir(), cache_file).c_str(),
+                    std::ios::out | std::ios::app);
+  ofs << file << '\t' << dict << std::endl;
+}
+
+void LangDetect::load_cache()
+{
+  if (cache_loaded) {
+    return;
+  }
+  cache_loaded = true;
+
+  std::ifstream ifs(Glib::build_filename(Utils::cacheDir(), cache_file).c_str());
+  std::string buff;
+  while (getline(ifs, buff)) {
+    std::string::size_type x = buff.rfind('\t');
+    if (x != std::string::npos) {
+      cache[buff.substr(0, x)] = std::make_pair(buff.substr(x + 1), cache_lines++);
+    }
+  }
+}
+
+/**
+ * \brief rewrite the cache file with only the most recently used files.
+ */
+void LangDetect::save_cache()
+{
+  std::vector<std::pair<unsigned, std::string> > files;
+  for (std::map<std::string, std::pair<std::string, unsigned> >::iterator iter = cache.begin();
+       iter != cache.end();
+       iter++) {
+    files.push_back(std::make_pair(iter->second.second, iter->first));
+  }
+
+  std::sort(files.begin(), files.end());
+  if (files.size() > cache_max) {
+    for (unsigned x = 0; x < files.size() - cache_max; x++) {
+      cache.erase(files[x].second);
+    }
+    files.erase(files.begin(), files.end() - cache_max);
+  }
+
+  cache_lines = 0;
+  std::ofstream ofs(Glib::build_filename(Utils::cacheDir(), cache_file).c_str());
+  for (unsigned x = 0; x < files.size(); x++) {
+    std::pair<std::string, unsigned> &entry = cache[files[x].second];
+    entry.second = cache_lines++;
+    ofs << files[x].second << '\t' << entry.first << std::endl;
+  }
+}
+
+bool LangDetect::initialized = false;
+std::vector<std::string> LangDetect::dicts;
+std::unordered_map<std::string, std::vector<std::pair<int, int> > > LangDetect::trigrams;
+bool LangDetect::cache_loaded = false;
+std::map<std::string, std::pair<std::string, unsigned> > LangDetect::cache;
+unsigned LangDetect::cache_lines = 0;
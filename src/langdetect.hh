@@ -0,0 +1,67 @@
+/*
+ * langdetect.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include <glib.h>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief Guess the language of a piece of text to pick a spell checker dictionary.
+ *
+ * Non-Latin scripts are identified by the code points they use. Latin text is scored against
+ * small character trigram profiles of the common Latin languages. Only a bounded sample of the
+ * text is looked at so detection stays well under a millisecond.
+ *
+ * The dictionary used for each file is remembered in the cache directory so reopening a file
+ * doesn't run the detection again.
+ */
+class LangDetect {
+ public:
+  /** \brief The maximum number of bytes we look at. */
+  static const unsigned sample_size = 4096;
+
+  static std::string detect(const char *, unsigned);
+  static bool get_dictionary(const std::string &, const std::string &, std::string &);
+  static bool lookup(const std::string &, std::string &);
+  static void remember(const std::string &, const std::string &);
+
+ private:
+  LangDetect();
+  ~LangDetect();
+
+  static void init();
+  static std::string detect_latin(const std::vector<gunichar> &);
+  static std::string language(const std::string &);
+  static void load_cache();
+  static void save_cache();
+
+  static bool initialized;
+  static std::vector<std::string> dicts;
+  static std::unordered_map<std::string, std::vector<std::pair<int, int> > > trigrams;
+  static bool cache_loaded;
+  // file -> (dictionary, line number in the cache file). The line number orders by recency.
+  static std::map<std::string, std::pair<std::string, unsigned> > cache;
+  static unsigned cache_lines;
+};
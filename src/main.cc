@@ -23,7 +23,13 @@
 
 #include "katoob.hh"
 #include "macros.h"
+#include "startupprofile.hh"
+#include <cstring>
 #include <glibmm/thread.h>
+
+#ifdef ENABLE_PRINT
+#include "pdfexport.hh"
+#endif
 //#include <csignal>
 
 /**
@@ -43,6 +49,26 @@ int main(int argc, char *argv[])
 
   //  signal(SIGPIPE, SIG_IGN);
 
+#ifdef ENABLE_PRINT
+  // Batch printing runs without a display so it has to happen before Gtk::Main.
+  if (argc > 1 && !strcmp(argv[1], "--print-to-pdf")) {
+    return PdfExport::main(argc, argv);
+  }
+#endif
+
+  for (int x = 1; x < argc; x++) {
+    if (!strcmp(argv[x], "--profile-startup")) {
+      StartupProfile::enable();
+    }
+  }
+
+#ifdef ENABLE_DBUS
+  // Handing our files to a running instance doesn't need Gtk.
+  if (Katoob::handoff(argc, argv)) {
+    return 0;
+  }
+#endif
+
   Katoob katoob(argc, argv);
   katoob.window();
   return katoob.run();
@@ -31,12 +31,14 @@
 #include "openlocationdialog.hh"
 #include "pipe.hh"
 #include "searchdialog.hh"
+#include "startupprofile.hh"
 #include "tempfile.hh"
 #include "utils.hh"
 #include <cassert>
 #include <cerrno>
 #include <cstring>
 #include <iostream>
+#include <thread>
 //#include "replacedialog.hh"
 
 #ifdef ENABLE_SPELL
@@ -49,7 +51,21 @@
 
 MDI::MDI(Conf &conf, Encodings &enc):
  _conf(conf),
- _encodings(enc)
+ _encodings(enc),
+ _transfer(NULL),
+ _transfer_doc(NULL),
+ _transfer_append(false),
+ _transfer_decoder(NULL),
+ _transfer_cache(NULL),
+ _transfer_size(0),
+ _pipe(NULL),
+ _pipe_doc(NULL),
+ _pipe_append(false),
+ _pipe_selection(false),
+ _pipe_file(NULL),
+ _pipe_decoder(NULL),
+ _pipe_size(0),
+ _decompress_cancel(false)
 #ifdef ENABLE_PRINT
  ,
  page_setup(PageSetup::create(_conf)),
@@ -58,11 +74,16 @@ MDI::MDI(Conf &conf, Encodings &enc):
 {
   signal_switch_page().connect(sigc::mem_fun(*this, &MDI::signal_switch_page_cb));
   // 1 minute.
-  Glib::signal_timeout().connect(sigc::mem_fun(this, &MDI::autosave), 1 * 60 * 1000);
+  Glib::signal_timeout().connect(sigc::mem_fun(this, &MDI::autosave_timeout_cb), 1 * 60 * 1000);
 }
 
 MDI::~MDI()
 {
+  if (_pipe) {
+    _pipe_doc = NULL;
+    pipe_finished();
+  }
+
   // destroy our documents.
   for (unsigned x = 0; x < children.size(); x++) {
     delete children[x];
@@ -80,7 +101,7 @@ MDI::~MDI()
 
 void MDI::scan_temp()
 {
-  std::map<std::string, std::string> temps;
+  std::vector<std::string> temps;
   std::string error;
   if (!Utils::get_recovery_files(temps, error)) {
     katoob_error(Utils::substitute(_("Failed to scan for any autorecovery files: %s"), error));
@@ -89,13 +110,17 @@ void MDI::scan_temp()
 
   if (temps.size() > 0) {
     if (katoob_simple_question(_("Some unrecovered files were found. Try to recover them ?"))) {
-      for (std::map<std::string, std::string>::iterator iter = temps.begin(); iter != temps.end();
-           iter++) {
+      for (unsigned x = 0; x < temps.size(); x++) {
+        std::string contents;
+        if (!Utils::katoob_read(temps[x], contents)) {
+          std::cerr << "Failed to read " << temps[x] << ": " << contents << std::endl;
+          continue;
+        }
         Document *doc = create_document();
         if (doc) {
-          doc->set_text(iter->second);
-          if (unlink(iter->first.c_str()) == -1) {
-            std::cerr << "Failed to unlink " << iter->first << " " << std::strerror(errno)
+          doc->set_text(contents);
+          if (unlink(temps[x].c_str()) == -1) {
+            std::cerr << "Failed to unlink " << temps[x] << " " << std::strerror(errno)
                       << std::endl;
           }
         }
@@ -115,6 +140,20 @@ bool MDI::autosave() const noexcept
   return true;
 }
 
+/**
+ * \brief the periodic autosave. The documents are written from other threads.
+ */
+bool MDI::autosave_timeout_cb()
+{
+  for (const auto doc: children) {
+    if (!doc->is_readonly() && doc->is_modified()) {
+      doc->autosave_in_background();
+    }
+  }
+
+  return true;
+}
+
 Document *MDI::create_document(std::string &file, int enc)
 {
   if (enc == -1) {
@@ -123,8 +162,20 @@ Document *MDI::create_document(std::string &file, int enc)
 
   Document *doc;
 
+  Codec::Format format = file == "-" ? Codec::NONE : Codec::detect_file(file);
+
   if (file == "-") {
     doc = new Document(_conf, _encodings, children.size() + 1, enc);
+  } else if (format != Codec::NONE) {
+    std::string contents, error;
+    if (!decompress(file, format, contents, error)) {
+      if (error.size() > 0) {
+        katoob_error(error);
+      }
+      return NULL;
+    }
+    StartupProfile::mark("Decompress the file");
+    doc = new Document(_conf, _encodings, enc, file, format, contents);
   } else {
     doc = new Document(_conf, _encodings, enc, file);
   }
@@ -153,6 +204,65 @@ Document *MDI::create_document(std::string &file, int enc)
   }
 }
 
+/**
+ * \brief decompress a file on a thread while the main loop keeps running.
+ * \param file the file.
+ * \param format the format the file is compressed with.
+ * \param out the decompressed contents.
+ * \param error contains the error, if any. It's empty if the user canceled.
+ * \return true on success.
+ */
+bool MDI::decompress(const std::string &file,
+                     Codec::Format format,
+                     std::string &out,
+                     std::string &error)
+{
+  _decompress_cancel = false;
+  _decompress_meter = katoob_activity();
+
+  sigc::connection done_conn =
+      _decompress_done.connect(sigc::mem_fun(this, &MDI::signal_decompress_done_cb));
+  sigc::connection cancel_conn = _decompress_meter->signal_cancel_clicked.connect(
+      sigc::mem_fun(this, &MDI::signal_decompress_cancel_cb));
+
+  bool ok = false;
+  std::thread worker(&MDI::decompress_worker,
+                     this,
+                     format,
+                     std::cref(file),
+                     std::ref(out),
+                     std::ref(error),
+                     std::ref(ok));
+  _decompress_meter->run();
+  worker.join();
+
+  done_conn.disconnect();
+  cancel_conn.disconnect();
+  _decompress_meter.clear();
+  return ok;
+}
+
+void MDI::decompress_worker(Codec::Format format,
+                            const std::string &file,
+                            std::string &out,
+                            std::string &error,
+                            bool &ok)
+{
+  ok = Codec::decode_file(format, file, out, error, &_decompress_cancel);
+  _decompress_done.emit();
+}
+
+void MDI::signal_decompress_done_cb()
+{
+  _decompress_meter->quit();
+}
+
+void MDI::signal_decompress_cancel_cb()
+{
+  // The worker stops after the chunk it's decompressing.
+  _decompress_cancel = true;
+}
+
 Document *MDI::create_document()
 {
   Document *doc = new Document(_conf, _encodings, children.size() + 1);
@@ -233,52 +343,185 @@ void MDI::open_location_cb()
     if (doc) {
       to_active = dialog.insert_to_active();
     }
+    if (!to_active) {
+      doc = create_document();
+      if (!doc) {
+        return;
+      }
+    }
+
     // get encoding,
     int enc = dialog.get_encoding();
     std::string uri = dialog.get_uri();
+
+    // The document is filled as the data arrives.
+    _transfer_doc = doc;
+    _transfer_append = !to_active;
+    _transfer_decoder = new StreamDecoder(_encodings, enc);
+    _transfer_cache = new HttpCache(_conf, uri);
+    _transfer_error.clear();
+    _transfer_size = 0;
+
+    if (_transfer_cache->usable() && _transfer_cache->offline()) {
+      std::string error;
+      if (!_transfer_cache->has_entry()) {
+        error = Utils::substitute(_("%s is not available offline."), uri);
+      } else {
+        transfer_from_cache(error);
+      }
+      transfer_finished();
+      if (error.size() > 0) {
+        katoob_error(error);
+      }
+      return;
+    }
+
     sigc::slot<void, bool, const std::string &> slot =
-        sigc::bind(sigc::mem_fun(this, &MDI::signal_transfer_complete_cb), uri, enc, to_active);
+        sigc::bind(sigc::mem_fun(this, &MDI::signal_transfer_complete_cb), uri);
+    sigc::slot<bool, const char *, std::size_t, double> data_slot =
+        sigc::mem_fun(this, &MDI::signal_transfer_data_cb);
+    sigc::slot<void, const std::string &> header_slot =
+        sigc::mem_fun(*_transfer_cache, &HttpCache::parse_header);
+    std::vector<std::string> headers;
+    _transfer_cache->get_request_headers(headers);
+
     std::string error;
-    if (!Network::add_transfer(uri, error, slot)) {
+    if (!Network::add_transfer(
+            uri, error, slot, &_transfer, data_slot, headers, header_slot)) {
+      transfer_finished();
       katoob_error(error);
+      return;
     }
+
+    _transfer_meter = katoob_activity();
+    _transfer_cancel_conn = _transfer_meter->signal_cancel_clicked.connect(
+        sigc::mem_fun(this, &MDI::signal_transfer_cancel_cb));
+    _transfer_meter->run();
+    _transfer_meter.clear();
   } else if (error.size() > 0) {
     katoob_error(error);
   }
 }
 
-void MDI::signal_transfer_complete_cb(bool st,
-                                      const std::string &str,
-                                      const std::string uri,
-                                      int enc,
-                                      bool to_active)
+bool MDI::signal_transfer_data_cb(const char *data, std::size_t len, double total)
 {
-  if (!st) {
-    katoob_error(str);
-    return;
+  std::string text;
+  if (!_transfer_decoder->decode(data, len, text, _transfer_error)) {
+    return false;
   }
 
-  // We convert it to utf8.
-  std::string res;
-  if (_encodings.convert_to(str, res, enc) != -1) {
-    Document *doc = get_active();
-    if (!doc) {
-      doc = create_document();
-    } else if (!to_active) {
-      doc = create_document();
-    }
-    // Insert.
-    if (doc) {
-      // TODO: Set a title for the document.
-      // We also need the document to know that it's a remote document.
-      doc->insert(res);
+  _transfer_cache->write(data, len);
+  transfer_insert(text);
+
+  _transfer_size += len;
+  if (_transfer_meter) {
+    _transfer_meter->set_progress(
+        total > 0 ? _transfer_size / total : -1,
+        Utils::substitute(_("Received %i KB"), static_cast<int>(_transfer_size / 1024)));
+  }
+
+  return true;
+}
+
+void MDI::signal_transfer_complete_cb(bool st, const std::string &str, const std::string uri)
+{
+  std::string error;
+  if (st && _transfer_cache->not_modified()) {
+    // Our copy is still good.
+    transfer_from_cache(error);
+  } else if (st) {
+    if (_transfer_decoder->finish(error)) {
+      int enc = _transfer_decoder->get_encoding();
+      _transfer_cache->commit(enc == -1 ? "" : _encodings.at(enc));
     }
+  } else if (_transfer_size == 0 && _transfer_cache->has_entry()) {
+    // We couldn't reach the server. Better an old copy than nothing.
+    transfer_from_cache(error);
+  } else {
+    // Our own decoding error is more helpful than curl's write error.
+    error = _transfer_error.size() > 0 ? _transfer_error : str;
+  }
+
+  transfer_finished();
+
+  if (error.size() > 0) {
+    katoob_error(error);
+  }
+
+  // TODO: Set a title for the document.
+  // We also need the document to know that it's a remote document.
+}
+
+/**
+ * \brief fill the transfer document from the cached copy.
+ * \param error contains the error, if any.
+ * \return true on success.
+ */
+bool MDI::transfer_from_cache(std::string &error)
+{
+  // Use what we detected the first time if we still know that encoding.
+  int enc = _encodings.get(_transfer_cache->get_encoding());
+  StreamDecoder decoder(_encodings, enc == -1 ? _encodings.default_open() : enc);
+
+  sigc::slot<bool, const char *, std::size_t> slot =
+      sigc::bind(sigc::mem_fun(this, &MDI::transfer_cache_data_cb), &decoder, &error);
+  if (!_transfer_cache->read(slot, error)) {
+    return false;
+  }
+
+  return decoder.finish(error);
+}
+
+/**
+ * \brief decode a chunk of the cached copy and insert it.
+ */
+bool MDI::transfer_cache_data_cb(const char *data,
+                                 std::size_t len,
+                                 StreamDecoder *decoder,
+                                 std::string *error)
+{
+  std::string text;
+  if (!decoder->decode(data, len, text, *error)) {
+    return false;
+  }
+
+  transfer_insert(text);
+  return true;
+}
+
+void MDI::transfer_insert(const std::string &text)
+{
+  if (text.size() == 0) {
+    return;
+  }
+
+  if (_transfer_append) {
+    _transfer_doc->append(text);
   } else {
-    katoob_error(res);
+    _transfer_doc->insert(text);
   }
+}
 
-  //  std::cout << uri << std::endl;
-  // std::cout << str << std::endl;
+void MDI::signal_transfer_cancel_cb()
+{
+  // Whatever we got so far stays in the document.
+  Network::del_transfer(_transfer);
+  transfer_finished();
+}
+
+void MDI::transfer_finished()
+{
+  _transfer_cancel_conn.disconnect();
+  if (_transfer_meter) {
+    _transfer_meter->quit();
+  }
+
+  _transfer = NULL;
+  _transfer_doc = NULL;
+  delete _transfer_decoder;
+  _transfer_decoder = NULL;
+  delete _transfer_cache;
+  _transfer_cache = NULL;
 }
 
 void MDI::insert_file_cb()
@@ -843,6 +1086,11 @@ void MDI::execute_cb()
     return;
   }
 
+  if (_pipe) {
+    katoob_error(_("Please wait for the running command to finish."));
+    return;
+  }
+
   ExecDialog dlg(_conf);
 
   if (dlg.run()) {
@@ -865,41 +1113,138 @@ void MDI::execute_cb()
 
     std::string error;
     std::string cmd;
-    std::string text;
-    TempFile tf;
+    std::string input;
+    TempFile *tf = NULL;
+    bool selection = false;
     if (found == 1) {
-      if (!tf.ok(error)) {
+      tf = new TempFile;
+      if (!tf->ok(error)) {
+        delete tf;
         katoob_error(error);
         return;
       }
 
       // Write the buffer contents.
-      text = doc->get_text();
-      if (!tf.write(text, error)) {
+      if (!tf->write(doc->get_text(), error)) {
+        delete tf;
         katoob_error(error);
         return;
       }
-      text.clear();
-      cmd = Utils::substitute(command, tf.get_name());
+      cmd = Utils::substitute(command, tf->get_name());
     } else {
+      // The command reads the selection, or the whole buffer, from its standard input.
+      selection = doc->has_selection();
+      input = selection ? doc->get_selected_text() : doc->get_text();
       cmd = command;
     }
 
-    if (!Pipe::exec(command, cmd, text, error)) {
+    if (new_buffer) {
+      // We create a new document and fill it as the output arrives.
+      doc = create_document();
+      if (!doc) {
+        delete tf;
+        return;
+      }
+    }
+
+    // The current document is only replaced once the command succeeds.
+    _pipe = new Pipe(cmd);
+    _pipe_doc = doc;
+    _pipe_append = new_buffer;
+    _pipe_selection = selection && !new_buffer;
+    _pipe_file = tf;
+    _pipe_decoder = new StreamDecoder(_encodings, _encodings.default_open());
+    _pipe_output.clear();
+    _pipe_error.clear();
+    _pipe_size = 0;
+
+    _pipe->signal_output.connect(sigc::mem_fun(this, &MDI::signal_pipe_output_cb));
+    _pipe->signal_done.connect(sigc::mem_fun(this, &MDI::signal_pipe_done_cb));
+
+    if (!_pipe->run(input, _conf.get("exec_timeout", 600), error)) {
+      pipe_finished();
       katoob_error(error);
       return;
     }
 
-    if (!new_buffer) {
-      doc->set_text(text);
+    _pipe_meter = katoob_activity();
+    _pipe_cancel_conn = _pipe_meter->signal_cancel_clicked.connect(
+        sigc::mem_fun(this, &MDI::signal_pipe_cancel_cb));
+    _pipe_meter->run();
+    _pipe_meter.clear();
+  }
+}
+
+void MDI::signal_pipe_output_cb(const char *data, std::size_t len)
+{
+  if (!_pipe_doc || _pipe_error.size() > 0) {
+    return;
+  }
+
+  std::string text;
+  if (!_pipe_decoder->decode(data, len, text, _pipe_error)) {
+    _pipe->cancel();
+    return;
+  }
+
+  if (_pipe_append) {
+    if (text.size() > 0) {
+      _pipe_doc->append(text);
+    }
+  } else {
+    _pipe_output += text;
+  }
+
+  _pipe_size += len;
+  if (_pipe_meter) {
+    _pipe_meter->set_progress(
+        -1, Utils::substitute(_("Received %i KB"), static_cast<int>(_pipe_size / 1024)));
+  }
+}
+
+void MDI::signal_pipe_done_cb(bool st, const std::string &str)
+{
+  if (st && _pipe_doc && _pipe_decoder->finish(_pipe_error) && !_pipe_append) {
+    if (_pipe_selection) {
+      _pipe_doc->erase();
+      _pipe_doc->insert(_pipe_output);
     } else {
-      // We create a new document then we insert.
-      Document *d = create_document();
-      if (d) {
-        d->set_text(text);
-      }
+      _pipe_doc->set_text(_pipe_output, true);
     }
   }
+
+  // Our own decoding error is more helpful than the one we caused by killing the command.
+  std::string error = _pipe_error.size() > 0 ? _pipe_error : str;
+
+  pipe_finished();
+
+  if (error.size() > 0) {
+    katoob_error(error);
+  }
+}
+
+void MDI::signal_pipe_cancel_cb()
+{
+  // Whatever the command wrote to a new document so far stays there.
+  _pipe_doc = NULL;
+  _pipe->cancel();
+}
+
+void MDI::pipe_finished()
+{
+  _pipe_cancel_conn.disconnect();
+  if (_pipe_meter) {
+    _pipe_meter->quit();
+  }
+
+  delete _pipe;
+  _pipe = NULL;
+  _pipe_doc = NULL;
+  delete _pipe_file;
+  _pipe_file = NULL;
+  delete _pipe_decoder;
+  _pipe_decoder = NULL;
+  std::string().swap(_pipe_output);
 }
 
 #ifdef ENABLE_SPELL
@@ -1003,26 +1348,15 @@ bool MDI::set_encoding(int n, int &o)
 
 void MDI::signal_document_dict_lookup_cb(std::string word)
 {
-  std::string uri = Dict::construct_uri(_conf, word);
-
-  sigc::slot<void, bool, const std::string &> slot =
-      sigc::bind(sigc::mem_fun(this, &MDI::signal_dict_transfer_complete_cb), word);
-  std::string error;
-  if (!Network::add_transfer(uri, error, slot)) {
-    katoob_error(error);
-  }
+  Dict::define(
+      _conf, word, sigc::bind(sigc::mem_fun(this, &MDI::signal_dict_lookup_done_cb), word));
 }
 
-void MDI::signal_dict_transfer_complete_cb(bool st, const std::string &str, std::string word)
+void MDI::signal_dict_lookup_done_cb(bool st,
+                                     const std::vector<std::string> &defs,
+                                     std::string word)
 {
   if (!st) {
-    katoob_error(str);
-    return;
-  }
-
-  std::vector<std::string> defs;
-
-  if (!Dict::parse_defs(str, defs)) {
     if (defs.size() == 0) {
       katoob_error(_("Failed to get any definitions."));
     } else if (defs[0].size() == 0) {
@@ -1196,17 +1530,11 @@ void MDI::export_cb(Export ex)
   std::string error;
   std::string out;
   if (ex.lines) {
-    std::vector<Glib::ustring> lines;
-    doc->get_lines(lines);
-    for (unsigned x = 0; x < lines.size(); x++) {
-      std::string tout;
-      if (!ex.func(lines[x], tout, error)) {
-        katoob_error(error);
-        return;
-      }
-      out += tout;
-      // TODO: We need to check whether the document has a \n at the end or not.
-      out += '\n';
+    LineExporter exporter(ex, out);
+    doc->foreach_segment(sigc::mem_fun(exporter, &LineExporter::add));
+    if (!exporter.finish(error)) {
+      katoob_error(error);
+      return;
     }
   } else {
     Glib::ustring text = doc->get_text();
@@ -21,11 +21,18 @@
 
 #pragma once
 
+#include "codec.hh"
+#include "dialogs.hh"
 #include "document.hh"
 #include "encodings.hh"
 #include "export.hh"
+#include "httpcache.hh"
 #include "import.hh"
+#include "pipe.hh"
 #include "replacedialog.hh"
+#include "streamdecoder.hh"
+#include "tempfile.hh"
+#include <atomic>
 #include <gtkmm.h>
 #include <vector>
 #ifdef ENABLE_PRINT
@@ -153,6 +160,7 @@ class MDI: public Gtk::Notebook {
 
   void scan_temp();
   bool autosave() const noexcept;
+  bool autosave_timeout_cb();
 
  private:
   void connect_signals(Document *);
@@ -189,8 +197,25 @@ class MDI: public Gtk::Notebook {
   }
   void signal_document_title_changed_cb(std::string);
 
-  void signal_transfer_complete_cb(bool, const std::string &, const std::string, int, bool);
-  void signal_dict_transfer_complete_cb(bool, const std::string &, std::string);
+  void signal_transfer_complete_cb(bool, const std::string &, const std::string);
+  bool signal_transfer_data_cb(const char *, std::size_t, double);
+  void signal_transfer_cancel_cb();
+  void transfer_finished();
+  bool transfer_from_cache(std::string &);
+  bool transfer_cache_data_cb(const char *, std::size_t, StreamDecoder *, std::string *);
+  void transfer_insert(const std::string &);
+
+  void signal_pipe_output_cb(const char *, std::size_t);
+  void signal_pipe_done_cb(bool, const std::string &);
+  void signal_pipe_cancel_cb();
+  void pipe_finished();
+
+  bool decompress(const std::string &, Codec::Format, std::string &, std::string &);
+  void decompress_worker(Codec::Format, const std::string &, std::string &, std::string &, bool &);
+  void signal_decompress_done_cb();
+  void signal_decompress_cancel_cb();
+
+  void signal_dict_lookup_done_cb(bool, const std::vector<std::string> &, std::string);
 
 #ifdef ENABLE_HIGHLIGHT
   void signal_document_highlight_cb(std::string x)
@@ -236,6 +261,35 @@ class MDI: public Gtk::Notebook {
   Conf &_conf;
   Encodings &_encodings;
 
+  // The remote document we are downloading, straight into _transfer_doc.
+  void *_transfer;
+  Document *_transfer_doc;
+  bool _transfer_append;
+  StreamDecoder *_transfer_decoder;
+  HttpCache *_transfer_cache;
+  std::string _transfer_error;
+  std::size_t _transfer_size;
+  Glib::RefPtr<ActivityMeter> _transfer_meter;
+  sigc::connection _transfer_cancel_conn;
+
+  // The command we are running. Its output goes to _pipe_doc.
+  Pipe *_pipe;
+  Document *_pipe_doc;
+  bool _pipe_append;
+  bool _pipe_selection;
+  TempFile *_pipe_file;
+  StreamDecoder *_pipe_decoder;
+  std::string _pipe_output;
+  std::string _pipe_error;
+  std::size_t _pipe_size;
+  Glib::RefPtr<ActivityMeter> _pipe_meter;
+  sigc::connection _pipe_cancel_conn;
+
+  // Compressed files are decompressed on a thread.
+  Glib::Dispatcher _decompress_done;
+  std::atomic<bool> _decompress_cancel;
+  Glib::RefPtr<ActivityMeter> _decompress_meter;
+
 #ifdef ENABLE_PRINT
   Glib::RefPtr<PageSetup> page_setup;
   Glib::RefPtr<PrintSettings> settings;
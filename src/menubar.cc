@@ -34,34 +34,22 @@
 #include "sourcemanager.hh"
 #endif
 
-// TODO: Integrate with the gtk recent files thing.
-MenuBar::MenuBar(Conf &config,
-                 Encodings &encodings
 #ifdef ENABLE_EMULATOR
-                 ,
-                 std::vector<std::string> &em
+#include "emulator.hh"
 #endif
+
 #ifdef ENABLE_MULTIPRESS
-                 ,
-                 std::vector<std::string> &mp
+#include "multipress.hh"
 #endif
-                 ):
- _conf(config)
+
+// TODO: Integrate with the gtk recent files thing.
+MenuBar::MenuBar(Conf &config, Encodings &encodings): _conf(config)
 {
   file();
   edit();
   search();
   view(encodings);
-  tools(
-#ifdef ENABLE_EMULATOR
-
-      em
-#endif
-#ifdef ENABLE_MULTIPRESS
-      ,
-      mp
-#endif
-  );
+  tools();
   documents();
   help();
 #ifdef ENABLE_HIGHLIGHT
@@ -387,15 +375,7 @@ void MenuBar::view(Encodings &encodings)
   }
 }
 
-void MenuBar::tools(
-#ifdef ENABLE_EMULATOR
-    std::vector<std::string> &em
-#endif
-#ifdef ENABLE_MULTIPRESS
-    ,
-    std::vector<std::string> &mp
-#endif
-)
+void MenuBar::tools()
 {
   tools_menu = menu(_("_Tools"));
   _execute = item(tools_menu,
@@ -421,38 +401,70 @@ void MenuBar::tools(
 #endif
 
 #if defined(ENABLE_EMULATOR) || defined(ENABLE_MULTIPRESS)
-  Gtk::RadioButtonGroup input_group;
   _input_menu = menu(_("Input"), tools_menu);
-  Gtk::MenuItem *item = radio_item(_input_menu, input_group, _("Default"));
+  Gtk::MenuItem *item = radio_item(_input_menu, _input_group, _("Default"));
   dynamic_cast<Gtk::RadioMenuItem *>(item)->set_active(true);
   auto layout_activate_cb = sigc::mem_fun(*this, &MenuBar::signal_layout_activate_cb);
   auto layout_activate_binding = sigc::bind<int, int>(layout_activate_cb, -1, -1);
   item->signal_activate().connect(layout_activate_binding);
+
+  // The layouts are read from disk, We wait until the tools menu is opened for the first time.
+  _layouts_built = false;
+  tools_menu->signal_map().connect(sigc::mem_fun(*this, &MenuBar::build_layouts));
 #endif
 
 #ifdef ENABLE_EMULATOR
   _emulator_menu = menu(_("Keyboard emulator"), _input_menu);
-  build_submenu(_emulator_menu, em, input_group, 0);
 #endif
 
 #ifdef ENABLE_MULTIPRESS
   _multipress_menu = menu(_("Multipress"), _input_menu);
-  build_submenu(_multipress_menu, mp, input_group, 1);
 #endif
 }
 
 #if defined(ENABLE_EMULATOR) || defined(ENABLE_MULTIPRESS)
+void MenuBar::build_layouts()
+{
+  if (_layouts_built) {
+    return;
+  }
+  _layouts_built = true;
+
+  std::string err;
+  bool ok;
+
+#ifdef ENABLE_EMULATOR
+  ok = Emulator::ok(err);
+  build_submenu(_emulator_menu, Emulator::list_layouts(), ok, err, 0);
+#endif
+
+#ifdef ENABLE_MULTIPRESS
+  ok = Multipress::ok(err);
+  build_submenu(_multipress_menu, Multipress::list_layouts(), ok, err, 1);
+#endif
+}
+
 void MenuBar::build_submenu(Gtk::Menu *menu,
                             std::vector<std::string> &items,
-                            Gtk::RadioButtonGroup &group,
+                            bool ok,
+                            const std::string &err,
                             int num)
 {
+  if (!ok) {
+    // Tell why the menu is empty.
+    Gtk::MenuItem *_item = manage(new Gtk::MenuItem(err));
+    _item->set_sensitive(false);
+    menu->items().push_back(*_item);
+  }
+
   for (std::size_t x = 0; x < items.size(); x++) {
-    Gtk::MenuItem *_item = radio_item(menu, group, items[x]);
+    Gtk::MenuItem *_item = radio_item(menu, _input_group, items[x]);
     auto callback = sigc::mem_fun(*this, &MenuBar::signal_layout_activate_cb);
     auto binding = sigc::bind<int, std::size_t>(callback, num, x);
     _item->signal_activate().connect(binding);
   }
+
+  menu->show_all();
 }
 #endif
 
@@ -895,29 +907,43 @@ void MenuBar::signal_recent_activate_cb(std::string &str)
 #ifdef ENABLE_HIGHLIGHT
 void MenuBar::create_highlighters()
 {
-  Gtk::Menu *item;
-  Gtk::MenuItem *_item;
-  Gtk::RadioButtonGroup highlighters_radio;
-
   highlight = menu(_("_Highlight"), view_menu);
 
-  _item = radio_item(highlight, highlighters_radio, _("None"));
+  Gtk::MenuItem *_item = radio_item(highlight, _highlighters_radio, _("None"));
   _item->signal_activate().connect(
       sigc::bind<std::string>(sigc::mem_fun(*this, &MenuBar::signal_highlighter_activate_cb), ""));
 
+  // Listing the languages loads all of gtksourceview's language files, We wait until the view
+  // menu is opened for the first time.
+  _highlighters_built = false;
+  view_menu->signal_map().connect(sigc::mem_fun(*this, &MenuBar::build_highlighters));
+}
+
+void MenuBar::build_highlighters()
+{
+  if (_highlighters_built) {
+    return;
+  }
+  _highlighters_built = true;
+
+  Gtk::Menu *item;
+  Gtk::MenuItem *_item;
+
   SourceCategory &cats = SourceManager::get_categories();
   SourceCategoryIter iter;
 
   for (iter = cats.begin(); iter != cats.end(); iter++) {
     item = menu(const_cast<char *>(iter->first.c_str()), highlight);
     for (unsigned x = 0; x < iter->second.size(); x++) {
-      _item = radio_item(item, highlighters_radio, SourceManager::get_name(iter->second[x]));
+      _item = radio_item(item, _highlighters_radio, SourceManager::get_name(iter->second[x]));
       _item->property_user_data().set_value(const_cast<char *>(iter->second[x].c_str()));
       _item->signal_activate().connect(
           sigc::bind<std::string>(sigc::mem_fun(*this, &MenuBar::signal_highlighter_activate_cb),
                                   iter->second[x]));
     }
   }
+
+  highlight->show_all();
 }
 
 void MenuBar::signal_highlighter_activate_cb(std::string id)
@@ -956,6 +982,10 @@ void MenuBar::signal_highlighter_activate_cb(std::string id)
 
 void MenuBar::set_highlight(std::string id)
 {
+  if (id != "") {
+    build_highlighters();
+  }
+
   _ignore_highlighting_changed_signal_hack = true;
 
   Gtk::Menu_Helpers::MenuList &items = highlight->items();
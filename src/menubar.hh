@@ -69,17 +69,7 @@ struct ClosedDocItem {
 
 class MenuBar: public Gtk::MenuBar {
  public:
-  MenuBar(Conf &,
-          Encodings &
-#ifdef ENABLE_EMULATOR
-          ,
-          std::vector<std::string> &
-#endif
-#ifdef ENABLE_MULTIPRESS
-          ,
-          std::vector<std::string> &
-#endif
-  );
+  MenuBar(Conf &, Encodings &);
   ~MenuBar();
 
   void create_recent();
@@ -186,22 +176,14 @@ class MenuBar: public Gtk::MenuBar {
   void edit();
   void search();
   void view(Encodings &);
-  void tools(
-#ifdef ENABLE_EMULATOR
-
-      std::vector<std::string> &
-#endif
-#ifdef ENABLE_MULTIPRESS
-      ,
-      std::vector<std::string> &
-#endif
-  );
+  void tools();
   void documents();
   void help();
   void recent(Conf &);
   void encodings(Conf &);
 #if defined(ENABLE_EMULATOR) || defined(ENABLE_MULTIPRESS)
-  void build_submenu(Gtk::Menu *, std::vector<std::string> &, Gtk::RadioButtonGroup &, int);
+  void build_layouts();
+  void build_submenu(Gtk::Menu *, std::vector<std::string> &, bool, const std::string &, int);
 #endif
 #ifdef ENABLE_SPELL
   void signal_auto_spell_activate_cb();
@@ -240,6 +222,7 @@ class MenuBar: public Gtk::MenuBar {
 
 #ifdef ENABLE_HIGHLIGHT
   void create_highlighters();
+  void build_highlighters();
   void signal_highlighter_activate_cb(std::string);
 #endif /* ENABLE_HIGHLIGHT */
 
@@ -263,12 +246,16 @@ class MenuBar: public Gtk::MenuBar {
 #endif
 #if defined(ENABLE_EMULATOR) || defined(ENABLE_MULTIPRESS)
   Gtk::Menu *_input_menu;
+  Gtk::RadioButtonGroup _input_group;
+  bool _layouts_built;
 #endif
 #ifdef ENABLE_MULTIPRESS
   Gtk::Menu *_multipress_menu;
 #endif
 #ifdef ENABLE_HIGHLIGHT
   Gtk::Menu *highlight;
+  Gtk::RadioButtonGroup _highlighters_radio;
+  bool _highlighters_built;
 #endif
 
   Gtk::MenuItem *recent_menu_item;
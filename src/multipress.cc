@@ -26,11 +26,16 @@
 #include "utils.hh"
 #include <cassert>
 #include <fstream>
-#include <iostream>
 #include <memory>
 
-Multipress::Multipress()
+// The layouts are only read the first time somebody asks for them.
+void Multipress::load()
 {
+  if (_loaded) {
+    return;
+  }
+  _loaded = true;
+
   std::unique_ptr<Glib::Dir> d;
 
   try {
@@ -50,7 +55,6 @@ Multipress::Multipress()
   while (start != end) {
     std::map<std::string, std::vector<std::string>> map;
     std::string file = Glib::build_filename(MULTIPRESS_DIR, *start);
-    std::cout << "Found multipress file: " << file << std::endl;
 
     if (parse_file(file, map)) {
 #ifdef GLIBMM_EXCEPTIONS_ENABLED
@@ -78,19 +82,17 @@ Multipress::Multipress()
   window->signal_insert_key.connect(sigc::ptr_fun(&Multipress::signal_insert_key_cb));
   window->signal_invalid_key.connect(sigc::ptr_fun(&Multipress::signal_invalid_key_cb));
   window->signal_change_key.connect(sigc::ptr_fun(&Multipress::signal_change_key_cb));
-
-  if (!_ok) {
-    std::cout << "Multipress will not work" << std::endl;
-  }
 }
 
 std::vector<std::string> &Multipress::list_layouts()
 {
+  load();
   return names;
 }
 
 bool Multipress::ok(std::string &e)
 {
+  load();
   e = _err;
   return _ok;
 }
@@ -191,6 +193,7 @@ sigc::signal<void, GdkEventKey *> Multipress::signal_invalid_key;
 MultipressWindow *Multipress::window;
 std::vector<std::string> Multipress::names;
 std::vector<std::map<std::string, std::vector<std::string>>> Multipress::layouts;
+bool Multipress::_loaded = false;
 bool Multipress::_ok = false;
 int Multipress::layout = -1;
 std::string Multipress::_err;
@@ -28,8 +28,6 @@
 
 class Multipress {
  public:
-  Multipress();
-
   static bool ok(std::string &);
   static std::vector<std::string> &list_layouts();
   static bool parse_file(std::string &, std::map<std::string, std::vector<std::string> > &);
@@ -43,12 +41,14 @@ class Multipress {
   static sigc::signal<void, GdkEventKey *> signal_invalid_key;
 
  private:
+  static void load();
   static void signal_insert_key_cb(std::string &);
   static void signal_invalid_key_cb(GdkEventKey *);
   static bool signal_change_key_cb(const std::string &);
 
   static bool get_values(const std::string &, std::vector<std::string> &);
   static MultipressWindow *window;
+  static bool _loaded;
   static bool _ok;
   static std::string _err;
   static std::vector<std::string> names;
@@ -89,14 +89,12 @@ CURLcode Network::populate_proxy(CURL *handle,
 bool Network::add_transfer(const std::string &uri,
                            std::string &error,
                            sigc::slot<void, bool, const std::string &> slot,
-                           void *get_handle)
+                           void **get_handle,
+                           sigc::slot<bool, const char *, std::size_t, double> data_slot,
+                           const std::vector<std::string> &headers,
+                           sigc::slot<void, const std::string &> header_slot)
 {
-  if (!m_handle) {
-    m_handle = curl_multi_init();
-  }
-
-  if (!m_handle) {
-    error = _("Failed to initialize the networking backend.");
+  if (!init_multi(error)) {
     return false;
   }
 
@@ -210,10 +208,17 @@ bool Network::add_transfer(const std::string &uri,
     return false;
   }
 
-  code = curl_easy_setopt(handle, CURLOPT_WRITEDATA, handle);   // TODO: Hack
+  Transfer *transfer = new Transfer;
+  transfer->handle = handle;
+  transfer->done = slot;
+  transfer->data = data_slot;
+  transfer->header = header_slot;
+
+  code = curl_easy_setopt(handle, CURLOPT_WRITEDATA, transfer);
   if (code != CURLE_OK) {
     error = curl_easy_strerror(code);
     curl_easy_cleanup(handle);
+    delete transfer;
     return false;
   }
 
@@ -221,9 +226,37 @@ bool Network::add_transfer(const std::string &uri,
   if (code != CURLE_OK) {
     error = curl_easy_strerror(code);
     curl_easy_cleanup(handle);
+    delete transfer;
     return false;
   }
 
+  for (unsigned x = 0; x < headers.size(); x++) {
+    transfer->headers = curl_slist_append(transfer->headers, headers[x].c_str());
+  }
+
+  if (transfer->headers) {
+    code = curl_easy_setopt(handle, CURLOPT_HTTPHEADER, transfer->headers);
+    if (code != CURLE_OK) {
+      error = curl_easy_strerror(code);
+      curl_easy_cleanup(handle);
+      delete transfer;
+      return false;
+    }
+  }
+
+  if (!header_slot.empty()) {
+    code = curl_easy_setopt(handle, CURLOPT_HEADERFUNCTION, Network::__curl_header_callback);
+    if (code == CURLE_OK) {
+      code = curl_easy_setopt(handle, CURLOPT_HEADERDATA, transfer);
+    }
+    if (code != CURLE_OK) {
+      error = curl_easy_strerror(code);
+      curl_easy_cleanup(handle);
+      delete transfer;
+      return false;
+    }
+  }
+
   //  curl_easy_setopt(handle, CURLOPT_ERRORBUFFER, error);
   //  curl_easy_setopt(handle, CURLOPT_WRITEDATA, this); // TODO: hack
 
@@ -232,20 +265,17 @@ bool Network::add_transfer(const std::string &uri,
     //    curl_easy_cleanup(handle);
     error = curl_multi_strerror(c);
     curl_easy_cleanup(handle);
+    delete transfer;
     return false;
   }
 
-  cons[handle] = slot;
-  data[handle] = "";
+  transfers[handle] = transfer;
 
-  if (!conn.connected()) {
-    conn = Glib::signal_idle().connect(sigc::ptr_fun(Network::network_perform), G_PRIORITY_LOW);
-  } else if (conn.blocked()) {
-    conn.unblock();
-  }
+  // Adding the handle makes curl ask for a timeout through timer_cb() which starts the
+  // transfer. We don't need to poke it here.
 
   if (get_handle) {
-    get_handle = handle;
+    *get_handle = handle;
   }
 
   url.release();
@@ -261,16 +291,21 @@ Network::~Network()
 {
   if (m_handle) {
     curl_multi_cleanup(m_handle);
+    m_handle = NULL;
   }
 }
 
 void Network::del_transfer(void *handle)
 {
-  std::map<CURL *, sigc::slot<void, bool, const std::string &>>::iterator iter = cons.find(handle);
-  std::map<CURL *, std::string>::iterator d_iter = data.find(handle);
+  std::map<CURL *, Transfer *>::iterator iter = transfers.find(handle);
+  if (iter == transfers.end()) {
+    return;
+  }
+
+  Transfer *transfer = iter->second;
+  transfers.erase(iter);
   clean_handle(handle);
-  cons.erase(iter);
-  data.erase(d_iter);
+  delete transfer;
 }
 
 void Network::clean_handle(void *handle)
@@ -287,86 +322,199 @@ void Network::clean_handle(void *handle)
   // TODO: error
 }
 
-bool Network::network_perform()
+/**
+ * \brief create the multi handle and hook it to the main loop.
+ *
+ * curl tells us which sockets to watch and when it needs to time out through socket_cb()
+ * and timer_cb(). We only call into curl when one of those fires so we don't use any CPU
+ * while waiting for the network.
+ */
+bool Network::init_multi(std::string &error)
 {
-  int running_handles;
-  int msgs_in_queue;
-  CURLMcode code;
-  CURLMsg *msg;
+  if (m_handle) {
+    return true;
+  }
 
+  m_handle = curl_multi_init();
   if (!m_handle) {
-    return true;
+    error = _("Failed to initialize the networking backend.");
+    return false;
+  }
+
+  curl_multi_setopt(m_handle, CURLMOPT_SOCKETFUNCTION, Network::socket_cb);
+  curl_multi_setopt(m_handle, CURLMOPT_TIMERFUNCTION, Network::timer_cb);
+
+  return true;
+}
+
+/**
+ * \brief curl wants us to start, change or stop watching a socket.
+ */
+int Network::socket_cb(CURL *, curl_socket_t s, int what, void *, void *)
+{
+  std::map<curl_socket_t, sigc::connection>::iterator iter = watches.find(s);
+  if (iter != watches.end()) {
+    iter->second.disconnect();
+    watches.erase(iter);
+  }
+
+  if (what == CURL_POLL_REMOVE) {
+    return 0;
   }
 
-  while (true) {
-    code = curl_multi_perform(m_handle, &running_handles);
+  Glib::IOCondition cond = Glib::IO_ERR | Glib::IO_HUP;
+  if (what & CURL_POLL_IN) {
+    cond |= Glib::IO_IN | Glib::IO_PRI;
+  }
+  if (what & CURL_POLL_OUT) {
+    cond |= Glib::IO_OUT;
+  }
+
+  Glib::RefPtr<Glib::IOChannel> channel = Glib::IOChannel::create_from_fd(s);
+  watches[s] = Glib::signal_io().connect(
+      sigc::bind(sigc::ptr_fun(Network::socket_action_cb), s), channel, cond);
 
-    if (code == CURLM_CALL_MULTI_PERFORM) {
+  return 0;
+}
+
+/**
+ * \brief curl wants to be called after timeout_ms or never if it's -1.
+ */
+int Network::timer_cb(CURLM *, long timeout_ms, void *)
+{
+  timer.disconnect();
+
+  if (timeout_ms >= 0) {
+    timer = Glib::signal_timeout().connect(sigc::ptr_fun(Network::timeout_cb), timeout_ms);
+  }
+
+  return 0;
+}
+
+bool Network::socket_action_cb(Glib::IOCondition cond, curl_socket_t s)
+{
+  int flags = 0;
+  if (cond & (Glib::IO_IN | Glib::IO_PRI)) {
+    flags |= CURL_CSELECT_IN;
+  }
+  if (cond & Glib::IO_OUT) {
+    flags |= CURL_CSELECT_OUT;
+  }
+  if (cond & (Glib::IO_ERR | Glib::IO_HUP)) {
+    flags |= CURL_CSELECT_ERR;
+  }
+
+  int running_handles;
+  curl_multi_socket_action(m_handle, s, flags, &running_handles);
+  check_transfers();
+
+  // socket_cb() removes the watch when curl is done with the socket.
+  return true;
+}
+
+bool Network::timeout_cb()
+{
+  int running_handles;
+  curl_multi_socket_action(m_handle, CURL_SOCKET_TIMEOUT, 0, &running_handles);
+  check_transfers();
+
+  // timer_cb() sets up the next timeout if curl needs one.
+  return false;
+}
+
+/**
+ * \brief deliver the transfers curl finished.
+ */
+void Network::check_transfers()
+{
+  int msgs_in_queue;
+  CURLMsg *msg;
+
+  while ((msg = curl_multi_info_read(m_handle, &msgs_in_queue)) != NULL) {
+    if (msg->msg != CURLMSG_DONE) {
       continue;
-    } else if (code == CURLM_OK) {
-      break;
-    } else {
-      // TODO: Error.
     }
-  }
 
-  //  curl_multi_perform(m_handle, &running_handles);
-  if (running_handles == 0) {
-    conn.block();
-  }
-
-  if ((decltype(cons)::size_type) running_handles < cons.size()) {
-    while (true) {
-      msg = curl_multi_info_read(m_handle, &msgs_in_queue);
-      if (msg == NULL) {
-        return true;
-      } else {
-        if (msg->msg == CURLMSG_DONE) {
-          // done.
-          bool good = msg->data.result == CURLE_OK;
-
-          std::map<CURL *, sigc::slot<void, bool, const std::string &>>::iterator iter =
-              cons.find(msg->easy_handle);
-          std::map<CURL *, std::string>::iterator d_iter = data.find(msg->easy_handle);
-          std::string er = curl_easy_strerror(msg->data.result);
-          iter->second(good, good ? d_iter->second : er);
-          clean_handle(msg->easy_handle);
-          cons.erase(iter);
-          data.erase(d_iter);
-          //	  curl_easy_cleanup(msg->easy_handle);
-        }
-      }
+    CURL *handle = msg->easy_handle;
+    bool good = msg->data.result == CURLE_OK;
+    std::string er = curl_easy_strerror(msg->data.result);
+
+    std::map<CURL *, Transfer *>::iterator iter = transfers.find(handle);
+    if (iter == transfers.end()) {
+      continue;
     }
+
+    // Take it out before calling the slot in case it starts a new transfer.
+    Transfer *transfer = iter->second;
+    transfers.erase(iter);
+    clean_handle(handle);
+
+    transfer->done(good, good ? transfer->body : er);
+    delete transfer;
   }
-  return true;
 }
 
 size_t Network::__curl_data_callback(void *ptr, size_t size, size_t nmemb, void *stream)
 {
-  // TODO: This is _really_ bad
-  std::map<CURL *, std::string>::iterator iter = data.find(static_cast<CURL *>(stream));
-  char *str = static_cast<char *>(ptr);
-  for (size_t x = 0; x < nmemb * size; x++) {
-    iter->second += str[x];
+  Transfer *transfer = static_cast<Transfer *>(stream);
+  const char *str = static_cast<const char *>(ptr);
+  const size_t len = nmemb * size;
+
+  if (transfer->data.empty()) {
+    transfer->body.append(str, len);
+    return len;
+  }
+
+  curl_off_t total = -1;
+  if (curl_easy_getinfo(transfer->handle, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &total) !=
+      CURLE_OK) {
+    total = -1;
+  }
+
+  // Returning less than we got makes curl fail the transfer.
+  return transfer->data(str, len, static_cast<double>(total)) ? len : 0;
+}
+
+size_t Network::__curl_header_callback(char *ptr, size_t size, size_t nmemb, void *stream)
+{
+  Transfer *transfer = static_cast<Transfer *>(stream);
+  const size_t len = nmemb * size;
+
+  // Drop the line break.
+  std::string line(ptr, len);
+  while (!line.empty() && (line.back() == '\n' || line.back() == '\r')) {
+    line.pop_back();
   }
-  return nmemb * size;
+
+  transfer->header(line);
+  return len;
 }
 
 void Network::destroy()
 {
-  for (std::map<CURL *, std::string>::iterator iter = data.begin(); iter != data.end(); iter++) {
-    del_transfer(iter->first);
+  while (!transfers.empty()) {
+    del_transfer(transfers.begin()->first);
   }
+
+  timer.disconnect();
+  for (std::map<curl_socket_t, sigc::connection>::iterator iter = watches.begin();
+       iter != watches.end();
+       iter++) {
+    iter->second.disconnect();
+  }
+  watches.clear();
+
   if (m_handle) {
     curl_multi_cleanup(m_handle);
+    m_handle = NULL;
   }
 }
 
 /* Our static members */
-std::map<CURL *, sigc::slot<void, bool, const std::string &>> Network::cons;
-std::map<CURL *, std::string> Network::data;
+std::map<CURL *, Network::Transfer *> Network::transfers;
 // std::map<CURL *, sigc::signal<void, bool, const std::string&> > *Network::cons = NULL;
 // std::map<CURL *, std::string> *Network::data = NULL;
 Conf *Network::conf = NULL;
 CURLM *Network::m_handle = NULL;
-sigc::connection Network::conn;
+std::map<curl_socket_t, sigc::connection> Network::watches;
+sigc::connection Network::timer;
@@ -23,10 +23,12 @@
 
 #include "conf.hh"
 #include <curl/curl.h>
+#include <glibmm/iochannel.h>
 #include <map>
 #include <sigc++/connection.h>
 #include <sigc++/slot.h>
 #include <string>
+#include <vector>
 
 class Network {
  public:
@@ -35,8 +37,10 @@ class Network {
   static bool add_transfer(const std::string &,
                            std::string &,
                            sigc::slot<void, bool, const std::string &>,
-                           void *get_handle = NULL);
-  static bool network_perform();
+                           void **get_handle = NULL,
+                           sigc::slot<bool, const char *, std::size_t, double> = {},
+                           const std::vector<std::string> & = {},
+                           sigc::slot<void, const std::string &> = {});
   static void del_transfer(void *);
   static void destroy();
 
@@ -46,6 +50,12 @@ class Network {
   Network &operator=(const Network &);
 
   static void clean_handle(void *);
+  static bool init_multi(std::string &);
+  static int socket_cb(CURL *, curl_socket_t, int, void *, void *);
+  static int timer_cb(CURLM *, long, void *);
+  static bool socket_action_cb(Glib::IOCondition, curl_socket_t);
+  static bool timeout_cb();
+  static void check_transfers();
   static CURLcode populate_proxy(CURL *,
                                  const std::string &,
                                  const int &port,
@@ -53,10 +63,36 @@ class Network {
                                  const std::string &,
                                  const std::string &);
   static size_t __curl_data_callback(void *ptr, size_t size, size_t nmemb, void *stream);
+  static size_t __curl_header_callback(char *ptr, size_t size, size_t nmemb, void *stream);
+
+  /**
+   * \brief A running transfer.
+   *
+   * If data is set, it gets every chunk as it arrives together with the expected size (or -1)
+   * and the body is not kept. Returning false from it aborts the transfer. header gets every
+   * response header line, status lines included.
+   */
+  struct Transfer {
+    Transfer(): handle(NULL), headers(NULL)
+    {
+    }
+    ~Transfer()
+    {
+      curl_slist_free_all(headers);
+    }
+
+    CURL *handle;
+    curl_slist *headers;
+    sigc::slot<void, bool, const std::string &> done;
+    sigc::slot<bool, const char *, std::size_t, double> data;
+    sigc::slot<void, const std::string &> header;
+    std::string body;
+  };
 
   static Conf *conf;
-  static std::map<CURL *, sigc::slot<void, bool, const std::string &> > cons;
-  static std::map<CURL *, std::string> data;
+  static std::map<CURL *, Transfer *> transfers;
   static CURLM *m_handle;
-  static sigc::connection conn;
+  // The main loop watches curl asked us to install, one per socket.
+  static std::map<curl_socket_t, sigc::connection> watches;
+  static sigc::connection timer;
 };
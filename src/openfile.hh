@@ -0,0 +1,41 @@
+/*
+ * openfile.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include <string>
+
+/**
+ * \brief A file we were asked to open, from the command line or by another instance.
+ */
+struct OpenFile {
+  OpenFile(): line(0), column(0)
+  {
+  }
+
+  std::string path;
+
+  /** \brief The character set or encoding name to open it with. Empty for the default. */
+  std::string encoding;
+
+  /** \brief Where to put the cursor, starting from 1. 0 if we weren't told. */
+  int line;
+  int column;
+};
@@ -0,0 +1,102 @@
+/*
+ * pagecache.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "pagecache.hh"
+
+/**
+ * \brief constructor.
+ * \param limit the most bytes the cached surfaces may take.
+ */
+PageCache::PageCache(std::size_t limit): _size(0), _limit(limit)
+{
+}
+
+/**
+ * \brief look up a page and mark it as the most recently used one.
+ * \param page the page number.
+ * \param width the width the page was rendered at.
+ * \return the surface or a null pointer if the page is not cached.
+ */
+Cairo::RefPtr<Cairo::ImageSurface> PageCache::get(int page, int width)
+{
+  std::map<Key, std::list<Entry>::iterator>::iterator iter = index.find(Key(page, width));
+  if (iter == index.end()) {
+    return Cairo::RefPtr<Cairo::ImageSurface>();
+  }
+
+  lru.splice(lru.begin(), lru, iter->second);
+  return iter->second->surface;
+}
+
+bool PageCache::has(int page, int width) const
+{
+  return index.find(Key(page, width)) != index.end();
+}
+
+/**
+ * \brief add a rendered page, replacing any older copy.
+ * \param page the page number.
+ * \param surface the rendered page.
+ */
+void PageCache::put(int page, const Cairo::RefPtr<Cairo::ImageSurface> &surface)
+{
+  Key key(page, surface->get_width());
+  std::map<Key, std::list<Entry>::iterator>::iterator iter = index.find(key);
+  if (iter != index.end()) {
+    _size -= iter->second->bytes;
+    lru.erase(iter->second);
+    index.erase(iter);
+  }
+
+  Entry entry;
+  entry.key = key;
+  entry.surface = surface;
+  entry.bytes = static_cast<std::size_t>(surface->get_stride()) * surface->get_height();
+
+  lru.push_front(entry);
+  index[key] = lru.begin();
+  _size += entry.bytes;
+
+  trim();
+}
+
+void PageCache::clear()
+{
+  index.clear();
+  lru.clear();
+  _size = 0;
+}
+
+/**
+ * \brief drop the least recently used pages until we are under the limit.
+ *
+ * The page that was just added is always kept even if it alone is over the limit.
+ */
+void PageCache::trim()
+{
+  while (_size > _limit && lru.size() > 1) {
+    Entry &entry = lru.back();
+    _size -= entry.bytes;
+    index.erase(entry.key);
+    lru.pop_back();
+  }
+}
@@ -0,0 +1,64 @@
+/*
+ * pagecache.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include <cairomm/cairomm.h>
+#include <list>
+#include <map>
+#include <utility>
+
+/**
+ * \brief A least recently used cache of rendered preview pages.
+ *
+ * Pages are keyed by their number and the width they were rendered at, so a page rendered
+ * for another page size (or zoom) is never returned. The cache drops the oldest pages once
+ * the surfaces it holds take more than limit bytes.
+ */
+class PageCache {
+ public:
+  PageCache(std::size_t);
+
+  Cairo::RefPtr<Cairo::ImageSurface> get(int, int);
+  bool has(int, int) const;
+  void put(int, const Cairo::RefPtr<Cairo::ImageSurface> &);
+  void clear();
+
+  std::size_t size() const
+  {
+    return _size;
+  }
+
+ private:
+  typedef std::pair<int, int> Key;
+  struct Entry {
+    Key key;
+    Cairo::RefPtr<Cairo::ImageSurface> surface;
+    std::size_t bytes;
+  };
+
+  void trim();
+
+  // Most recently used first.
+  std::list<Entry> lru;
+  std::map<Key, std::list<Entry>::iterator> index;
+  std::size_t _size;
+  std::size_t _limit;
+};
@@ -0,0 +1,175 @@
+/*
+ * paginator.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "paginator.hh"
+#include <algorithm>
+
+Paginator::Paginator():
+ _block(-1),
+ _width(0),
+ _height(0),
+ _blocks(0),
+ _paginated(0),
+ _page_height(0),
+ _last_page(-1)
+{
+}
+
+/**
+ * \brief start paginating.
+ *
+ * Nothing is laid out here. Call paginate() until it returns true.
+ * \param font the font to use.
+ * \param width the width of a page.
+ * \param height the height of a page.
+ * \param lines the number of lines in the text.
+ * \param last_page stop after this page or -1 to paginate everything.
+ */
+void Paginator::reset(
+    const Pango::FontDescription &font, double width, double height, int lines, int last_page)
+{
+  _font = font;
+  _width = width;
+  _height = height;
+
+  layout.clear();
+  _block = -1;
+
+  _blocks = (std::max(lines, 1) + block_lines - 1) / block_lines;
+  _paginated = 0;
+  _page_height = 0;
+  _last_page = last_page;
+
+  pages.clear();
+  _end = std::make_pair(_blocks, 0);
+}
+
+/**
+ * \brief paginate the next block.
+ * \return true when we are done.
+ */
+bool Paginator::paginate()
+{
+  if (_paginated == _blocks) {
+    return true;
+  }
+
+  Glib::RefPtr<Pango::Layout> block = get_block_layout(_paginated);
+  const int line_count = block->get_line_count();
+
+  for (int line = 0; line < line_count; line++) {
+    Pango::Rectangle logical_rect = block->get_line(line)->get_logical_extents();
+    const double line_height = logical_rect.get_height() / static_cast<double>(Pango::SCALE);
+    if (pages.empty() || (_page_height > 0 && _page_height + line_height > _height)) {
+      if (_last_page != -1 && static_cast<int>(pages.size()) > _last_page) {
+        // We have all the pages we were asked for.
+        _end = std::make_pair(_paginated, line);
+        _paginated = _blocks;
+        return true;
+      }
+      pages.push_back(std::make_pair(_paginated, line));
+      _page_height = 0;
+    }
+    _page_height += line_height;
+  }
+
+  ++_paginated;
+
+  return _paginated == _blocks;
+}
+
+/**
+ * \brief draw a page.
+ * \param ctx the context to draw to. The layouts must have been created for it.
+ * \param nr the page number, starting from 0.
+ */
+void Paginator::draw_page(const Cairo::RefPtr<Cairo::Context> &ctx, int nr)
+{
+  if (nr < 0 || nr >= static_cast<int>(pages.size())) {
+    // This shouldn't happen but just in case.
+    return;
+  }
+
+  std::pair<int, int> pos = pages[nr];
+  const std::pair<int, int> end = nr + 1 < static_cast<int>(pages.size()) ? pages[nr + 1] : _end;
+
+  // TODO: configurable.
+  ctx->set_source_rgb(0, 0, 0);
+
+  // A page can start in one block and end in the next one.
+  double y = 0;
+  while (pos < end) {
+    Glib::RefPtr<Pango::Layout> block = get_block_layout(pos.first);
+    if (pos.second >= block->get_line_count()) {
+      ++pos.first;
+      pos.second = 0;
+      continue;
+    }
+
+    Glib::RefPtr<Pango::LayoutLine> layout_line = block->get_line(pos.second);
+    Pango::Rectangle logical_rect = layout_line->get_logical_extents();
+
+    y += logical_rect.get_height() / static_cast<double>(Pango::SCALE);
+    ctx->move_to(0, y);
+
+    layout_line->show_in_cairo_context(ctx);
+    ++pos.second;
+  }
+}
+
+/**
+ * \brief drop the layout we are holding.
+ */
+void Paginator::clear()
+{
+  layout.clear();
+  _block = -1;
+}
+
+Glib::RefPtr<Pango::Layout> Paginator::get_block_layout(int nr)
+{
+  if (layout && _block == nr) {
+    return layout;
+  }
+
+  std::vector<Glib::ustring> lines;
+  const int first = nr * block_lines;
+  signal_get_lines.emit(lines, first, first + block_lines - 1);
+
+  Glib::ustring text;
+  for (unsigned x = 0; x < lines.size(); x++) {
+    if (x > 0) {
+      text += '\n';
+    }
+    text += lines[x];
+  }
+
+  // Drop the old block before laying out the new one.
+  layout.clear();
+  layout = signal_create_layout.emit();
+  layout->set_font_description(_font);
+  layout->set_width(static_cast<int>(_width * Pango::SCALE));
+  layout->set_text(text);
+  _block = nr;
+
+  return layout;
+}
@@ -0,0 +1,81 @@
+/*
+ * paginator.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include <cairomm/cairomm.h>
+#include <glibmm.h>
+#include <pangomm.h>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief Split text into printed pages a block of lines at a time.
+ *
+ * The text is never laid out as a whole. It is fetched through signal_get_lines one block of
+ * block_lines lines at a time and laid out in a layout created by signal_create_layout. Only
+ * the layout of one block is kept alive, and the pages are stored as the (block, layout line)
+ * pair they start at.
+ */
+class Paginator {
+ public:
+  Paginator();
+
+  void reset(const Pango::FontDescription &, double, double, int, int = -1);
+  bool paginate();
+  void draw_page(const Cairo::RefPtr<Cairo::Context> &, int);
+  void clear();
+
+  int get_n_pages() const
+  {
+    return pages.size();
+  }
+  Glib::RefPtr<Pango::Layout> get_layout()
+  {
+    return layout;
+  }
+
+  /** \brief create an empty layout for the target we are drawing to. */
+  sigc::signal<Glib::RefPtr<Pango::Layout> > signal_create_layout;
+  /** \brief get the lines from the first up to and including the last. */
+  sigc::signal<void, std::vector<Glib::ustring> &, int, int> signal_get_lines;
+
+  // How many lines go into one layout.
+  static const int block_lines = 256;
+
+ private:
+  Glib::RefPtr<Pango::Layout> get_block_layout(int);
+
+  // The layout of block _block.
+  Glib::RefPtr<Pango::Layout> layout;
+  int _block;
+
+  Pango::FontDescription _font;
+  double _width;
+  double _height;
+  int _blocks;
+  int _paginated;
+  double _page_height;
+  int _last_page;
+
+  // Where each page starts. _end is where the last page stops.
+  std::vector<std::pair<int, int> > pages;
+  std::pair<int, int> _end;
+};
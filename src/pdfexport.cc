@@ -0,0 +1,247 @@
+/*
+ * pdfexport.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "macros.h"
+#include "pagesetup.hh"
+#include "paginator.hh"
+#include "pdfexport.hh"
+#include "utils.hh"
+#include <algorithm>
+#include <cairomm/cairomm.h>
+#include <cerrno>
+#include <glib/gstdio.h>
+#include <gtkmm.h>
+#include <iostream>
+#include <pango/pangocairo.h>
+#include <set>
+#include <thread>
+
+/**
+ * \brief constructor.
+ *
+ * Everything we need from the configuration is read here so the worker threads never touch
+ * Conf.
+ */
+PdfExport::PdfExport(Conf &conf, Encodings &encodings):
+ _encodings(encodings),
+ _encoding(encodings.default_open()),
+ _font(conf.print_get("print_font", "Sans Regular 12")),
+ _next(0),
+ _failed(0)
+{
+  Glib::RefPtr<PageSetup> page_setup = PageSetup::create(conf);
+  Glib::RefPtr<Gtk::PageSetup> setup = page_setup->get_page_setup();
+
+  _paper_width = setup->get_paper_width(Gtk::UNIT_POINTS);
+  _paper_height = setup->get_paper_height(Gtk::UNIT_POINTS);
+  _left = setup->get_left_margin(Gtk::UNIT_POINTS);
+  _top = setup->get_top_margin(Gtk::UNIT_POINTS);
+  _width = setup->get_page_width(Gtk::UNIT_POINTS);
+  _height = setup->get_page_height(Gtk::UNIT_POINTS);
+}
+
+/**
+ * \brief our entry point for katoob --print-to-pdf out_dir file...
+ *
+ * This runs before Gtk::Main so we don't need a display.
+ * \return 0 if all the files were printed, 1 otherwise.
+ */
+int PdfExport::main(int argc, char *argv[])
+{
+  if (argc < 4) {
+    std::cerr << "usage: katoob --print-to-pdf OUT_DIR FILE..." << std::endl;
+    return 1;
+  }
+
+  // We need the C++ wrappers but not GTK+ itself.
+  Gtk::Main::init_gtkmm_internals();
+
+  Encodings encodings;
+  Conf conf(encodings);
+  if (!conf.ok()) {
+    return 1;
+  }
+
+  std::vector<std::string> files(argv + 3, argv + argc);
+  PdfExport pdf(conf, encodings);
+  return pdf.run(argv[2], files);
+}
+
+/**
+ * \brief print the files.
+ * \param out_dir the directory to write the PDF files to.
+ * \param files the files to print.
+ * \return 0 if all the files were printed, 1 otherwise.
+ */
+int PdfExport::run(const std::string &out_dir, const std::vector<std::string> &files)
+{
+  if (g_mkdir_with_parents(out_dir.c_str(), 0755) == -1) {
+    std::cerr << out_dir << ": " << Glib::strerror(errno) << std::endl;
+    return 1;
+  }
+
+  // Files from different directories can have the same name. Number the later ones so two
+  // workers never write the same PDF.
+  std::vector<std::string> outputs;
+  std::set<std::string> names;
+  for (const std::string &file: files) {
+    const std::string base = Glib::path_get_basename(file);
+    std::string name = base + ".pdf";
+    for (int x = 2; !names.insert(name).second; x++) {
+      name = Utils::substitute("%s-%i.pdf", base, x);
+    }
+    outputs.push_back(Glib::build_filename(out_dir, name));
+  }
+
+  Glib::Timer timer;
+
+  const unsigned jobs = std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u),
+                                              files.size());
+  std::vector<std::thread> threads;
+  for (unsigned x = 1; x < jobs; x++) {
+    threads.push_back(
+        std::thread(&PdfExport::worker, this, std::cref(files), std::cref(outputs)));
+  }
+
+  worker(files, outputs);
+
+  for (std::thread &thread: threads) {
+    thread.join();
+  }
+
+  timer.stop();
+  std::cout << files.size() << " files, " << _failed << " failed, " << timer.elapsed() << "s"
+            << std::endl;
+
+  return _failed == 0 ? 0 : 1;
+}
+
+/**
+ * \brief keep printing files until there are none left.
+ * \param files the files to print.
+ * \param outputs the PDF file to write for each of them.
+ */
+void PdfExport::worker(const std::vector<std::string> &files,
+                       const std::vector<std::string> &outputs)
+{
+  for (unsigned x = _next++; x < files.size(); x = _next++) {
+    Glib::Timer timer;
+    std::string error;
+    const bool ok = export_file(files[x], outputs[x], error);
+    timer.stop();
+
+    std::lock_guard<std::mutex> lock(_lock);
+    if (ok) {
+      std::cout << files[x] << " -> " << outputs[x] << ": " << timer.elapsed() << "s"
+                << std::endl;
+    } else {
+      std::cerr << files[x] << ": " << error << std::endl;
+      ++_failed;
+    }
+  }
+}
+
+/**
+ * \brief print one file.
+ * \param file the file to print.
+ * \param out the PDF file to write.
+ * \param error contains the error, if any.
+ * \return true on success.
+ */
+bool PdfExport::export_file(const std::string &file, const std::string &out, std::string &error)
+{
+  std::string contents;
+  try {
+    contents = Glib::file_get_contents(file);
+  } catch (Glib::FileError &err) {
+    error = err.what();
+    return false;
+  }
+
+  std::string text;
+  if (_encodings.convert_to(contents, text, _encoding) == -1) {
+    error = Utils::substitute(_("Couldn't detect the encoding of %s"), file);
+    return false;
+  }
+  contents.clear();
+
+  std::vector<Glib::ustring> lines;
+  std::string::size_type start = 0, end;
+  while ((end = text.find('\n', start)) != std::string::npos) {
+    lines.push_back(text.substr(start, end - start));
+    start = end + 1;
+  }
+  lines.push_back(text.substr(start));
+  text.clear();
+
+  try {
+    Cairo::RefPtr<Cairo::PdfSurface> surface =
+        Cairo::PdfSurface::create(out, _paper_width, _paper_height);
+    Cairo::RefPtr<Cairo::Context> ctx = Cairo::Context::create(surface);
+
+    // Lay out in points like the print dialog does. Pango defaults to 96 DPI.
+    PangoContext *pango_ctx = pango_cairo_create_context(ctx->cobj());
+    pango_cairo_context_set_resolution(pango_ctx, 72);
+    Glib::RefPtr<Pango::Context> context = Glib::wrap(pango_ctx);
+
+    Paginator paginator;
+    paginator.signal_create_layout.connect(
+        sigc::bind(sigc::ptr_fun(&PdfExport::create_layout), context));
+    paginator.signal_get_lines.connect(
+        sigc::bind(sigc::ptr_fun(&PdfExport::get_lines), &lines));
+
+    paginator.reset(_font, _width, _height, lines.size());
+    while (!paginator.paginate()) {
+    }
+
+    for (int x = 0; x < paginator.get_n_pages(); x++) {
+      ctx->save();
+      ctx->translate(_left, _top);
+      paginator.draw_page(ctx, x);
+      ctx->restore();
+      ctx->show_page();
+    }
+
+    paginator.clear();
+    surface->finish();
+  } catch (std::exception &err) {
+    error = err.what();
+    return false;
+  }
+
+  return true;
+}
+
+Glib::RefPtr<Pango::Layout> PdfExport::create_layout(Glib::RefPtr<Pango::Context> context)
+{
+  return Pango::Layout::create(context);
+}
+
+void PdfExport::get_lines(std::vector<Glib::ustring> &out,
+                          int first,
+                          int last,
+                          const std::vector<Glib::ustring> *lines)
+{
+  for (int x = first; x <= last && x < static_cast<int>(lines->size()); x++) {
+    out.push_back((*lines)[x]);
+  }
+}
@@ -0,0 +1,63 @@
+/*
+ * pdfexport.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include "conf.hh"
+#include "encodings.hh"
+#include <atomic>
+#include <mutex>
+#include <pangomm.h>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Print files to PDF without a GUI (--print-to-pdf).
+ *
+ * Every file is paginated with a Paginator and drawn onto a Cairo PDF surface using the
+ * print font and page setup from the configuration. Files are shared between one thread per
+ * core. Each thread has its own Cairo surface and Pango context.
+ */
+class PdfExport {
+ public:
+  PdfExport(Conf &, Encodings &);
+  int run(const std::string &, const std::vector<std::string> &);
+
+  static int main(int, char *[]);
+
+ private:
+  void worker(const std::vector<std::string> &, const std::vector<std::string> &);
+  bool export_file(const std::string &, const std::string &, std::string &);
+
+  static Glib::RefPtr<Pango::Layout> create_layout(Glib::RefPtr<Pango::Context>);
+  static void
+  get_lines(std::vector<Glib::ustring> &, int, int, const std::vector<Glib::ustring> *);
+
+  Encodings &_encodings;
+  int _encoding;
+  Pango::FontDescription _font;
+  double _paper_width, _paper_height;
+  double _left, _top, _width, _height;
+
+  // Protects the output.
+  std::mutex _lock;
+  std::atomic<unsigned> _next;
+  std::atomic<unsigned> _failed;
+};
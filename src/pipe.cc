@@ -24,16 +24,35 @@
 #include "macros.h"
 #include "pipe.hh"
 #include "utils.hh"
+#include <algorithm>
 #include <cerrno>
+#include <csignal>
+#include <fcntl.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
+// How much we write or read at once.
+#define CHUNK_SIZE 65536
+
+// We keep that much of what the command writes to its standard error.
+#define MAX_STDERR 4096
+
 /**
  * \brief constructor.
- * \param command the command to execute without any arguments.
+ * \param command the command with all its arguments.
  */
-Pipe::Pipe(const std::string &command): _ok(false)
+Pipe::Pipe(const std::string &command):
+ _command(command),
+ _ok(false),
+ _written(0),
+ _pid(0),
+ _running(false),
+ _status(0),
+ _killed(false),
+ _in(-1),
+ _out(-1),
+ _errfd(-1)
 {
   std::string res;
 
@@ -53,100 +72,234 @@ Pipe::Pipe(const std::string &command): _ok(false)
   }
 }
 
-/** \brief destructor. */
+/**
+ * \brief destructor.
+ *
+ * A command that is still running is killed.
+ */
 Pipe::~Pipe()
 {
+  in_conn.disconnect();
+  out_conn.disconnect();
+  err_conn.disconnect();
+  child_conn.disconnect();
+  timeout_conn.disconnect();
+  done_conn.disconnect();
+
+  if (_running) {
+    ::kill(-_pid, SIGKILL);
+    Glib::spawn_close_pid(_pid);
+  }
+
+  if (_in != -1) {
+    close(_in);
+  }
+  if (_out != -1) {
+    close(_out);
+  }
+  if (_errfd != -1) {
+    close(_errfd);
+  }
 }
 
 /**
- * \brief execute a command and read its output.
- * \param command the command with all its arguments.
- * \param out a reference to a std::string to store the output.
- * \param err a reference to a std::string to store any error.
- * \return true upon success or false otherwise.
+ * \brief start the command.
+ * \param input what to write to the command standard input. We take it over and leave it empty.
+ * \param timeout kill the command if it runs for longer than that many seconds, 0 to wait
+ * forever.
+ * \param error a reference to a std::string to store any error.
+ * \return true if the command was started, false otherwise.
  */
-bool Pipe::exec(const std::string &command, std::string &out, std::string &err)
+bool Pipe::run(std::string &input, int timeout, std::string &error)
 {
-  FILE *p = popen(command.c_str(), "r");
-  if (!p) {
-    err = strerror(errno);
+  if (!_ok) {
+    error = _err;
     return false;
   }
 
-  size_t n;
-  char c;
+  std::vector<std::string> argv;
+  argv.push_back("/bin/sh");
+  argv.push_back("-c");
+  argv.push_back(_command);
 
-  while (true) {
-    // TODO: Bad, One character at a time.
-    n = fread(&c, 1, 1, p);
-    if (n == 0) {
-      break;
-    }
-    if (n != 1) {
-      pclose(p);
-      err = strerror(errno);
-      return false;
-    }
-    out += c;
-  }
-  int status;
-  wait(&status);
-  if (status != 0) {
-    // TODO: Possible some commands might not return 0
-    err = _("Couldn't get the required content.");
+  try {
+    Glib::spawn_async_with_pipes(Glib::get_current_dir(),
+                                 argv,
+                                 Glib::SPAWN_DO_NOT_REAP_CHILD,
+                                 sigc::ptr_fun(&Pipe::child_setup),
+                                 &_pid,
+                                 &_in,
+                                 &_out,
+                                 &_errfd);
+  } catch (Glib::SpawnError &err) {
+    error = err.what();
     return false;
   }
-  int x = pclose(p);
-  if (errno == ECHILD) {
-    return true;
+
+  _running = true;
+  _input.swap(input);
+
+  fcntl(_in, F_SETFL, fcntl(_in, F_GETFL) | O_NONBLOCK);
+  fcntl(_out, F_SETFL, fcntl(_out, F_GETFL) | O_NONBLOCK);
+  fcntl(_errfd, F_SETFL, fcntl(_errfd, F_GETFL) | O_NONBLOCK);
+
+  if (_input.empty()) {
+    close(_in);
+    _in = -1;
+  } else {
+    in_conn = Glib::signal_io().connect(
+        sigc::mem_fun(*this, &Pipe::in_cb), _in, Glib::IO_OUT | Glib::IO_HUP | Glib::IO_ERR);
   }
-  // ECHILD
-  // Probably it will always return -1 ?
-  if (x == -1) {
-    err = strerror(errno);
-    return false;
+
+  out_conn = Glib::signal_io().connect(
+      sigc::mem_fun(*this, &Pipe::out_cb), _out, Glib::IO_IN | Glib::IO_HUP | Glib::IO_ERR);
+  err_conn = Glib::signal_io().connect(
+      sigc::mem_fun(*this, &Pipe::err_cb), _errfd, Glib::IO_IN | Glib::IO_HUP | Glib::IO_ERR);
+  child_conn = Glib::signal_child_watch().connect(sigc::mem_fun(*this, &Pipe::child_cb), _pid);
+
+  if (timeout > 0) {
+    timeout_conn =
+        Glib::signal_timeout().connect_seconds(sigc::mem_fun(*this, &Pipe::timeout_cb), timeout);
   }
+
   return true;
 }
 
 /**
- * \brief check whether the command can be executed or not.
- *
- * Usually, this should be called after creating a Pipe object to check that the command
- * passed to the constructor can be executed.
+ * \brief stop the command. signal_done is still emitted, without an error.
+ */
+void Pipe::cancel()
+{
+  kill("");
+}
+
+/**
+ * \brief runs in the child before the command.
  *
- * \param err a reference to a std::string to store any error.
- * \return true if the command can be executed. false otherwise.
+ * The shell gets its own process group so we can kill whatever it started.
  */
-bool Pipe::ok(std::string &err)
+void Pipe::child_setup()
+{
+  setpgid(0, 0);
+}
+
+bool Pipe::in_cb(Glib::IOCondition cond)
+{
+  while (_written < _input.size()) {
+    std::size_t len = std::min<std::size_t>(_input.size() - _written, CHUNK_SIZE);
+    ssize_t n = write(_in, _input.data() + _written, len);
+    if (n > 0) {
+      _written += n;
+    } else if (n == -1 && errno == EINTR) {
+      continue;
+    } else if (n == -1 && errno == EAGAIN) {
+      return true;
+    } else {
+      // EPIPE, The command doesn't want the rest.
+      break;
+    }
+  }
+
+  // Closing it is how the command knows it got everything.
+  close(_in);
+  _in = -1;
+  std::string().swap(_input);
+  return false;
+}
+
+bool Pipe::out_cb(Glib::IOCondition cond)
 {
-  if (_ok) {
+  char buf[CHUNK_SIZE];
+  ssize_t n = read(_out, buf, sizeof(buf));
+  if (n > 0) {
+    signal_output.emit(buf, n);
     return true;
-  } else {
-    err = _err;
-    return false;
+  } else if (n == -1 && (errno == EINTR || errno == EAGAIN)) {
+    return true;
+  }
+
+  close(_out);
+  _out = -1;
+  check_done();
+  return false;
+}
+
+bool Pipe::err_cb(Glib::IOCondition cond)
+{
+  char buf[1024];
+  ssize_t n = read(_errfd, buf, sizeof(buf));
+  if (n > 0) {
+    if (_stderr.size() < MAX_STDERR) {
+      _stderr.append(buf, std::min<std::size_t>(n, MAX_STDERR - _stderr.size()));
+    }
+    return true;
+  } else if (n == -1 && (errno == EINTR || errno == EAGAIN)) {
+    return true;
+  }
+
+  close(_errfd);
+  _errfd = -1;
+  check_done();
+  return false;
+}
+
+void Pipe::child_cb(GPid pid, int status)
+{
+  Glib::spawn_close_pid(pid);
+  _running = false;
+  _status = status;
+  timeout_conn.disconnect();
+  check_done();
+}
+
+bool Pipe::timeout_cb()
+{
+  kill(_("The command took too long to finish."));
+  return false;
+}
+
+void Pipe::kill(const std::string &error)
+{
+  if (!_running || _killed) {
+    return;
   }
+
+  _killed = true;
+  _error = error;
+  ::kill(-_pid, SIGKILL);
 }
 
 /**
- * \brief execute a ccommand directly and captures its output.
- * \param command1 the command to execute without any arguments.
- * \param command2 the command with all its arguments.
- * \param out a reference to a std::string to store the output.
- * \param error a reference to a std::string to store any error.
- * \return true upon success or false otherwise.
+ * \brief we are done once the command exited and we read everything it wrote.
  */
-bool Pipe::exec(const std::string &command1,
-                const std::string &command2,
-                std::string &out,
-                std::string &error)
+void Pipe::check_done()
 {
-  Pipe pipe(command1);
-  if (!pipe.ok(error)) {
-    return false;
+  if (_running || _out != -1 || _errfd != -1 || done_conn.connected()) {
+    return;
   }
-  if (pipe.exec(command2, out, error)) {
-    return true;
+
+  done_conn = Glib::signal_idle().connect(sigc::mem_fun(*this, &Pipe::done_cb));
+}
+
+bool Pipe::done_cb()
+{
+  std::string error;
+  bool ok = false;
+
+  if (_killed) {
+    error = _error;
+  } else if (WIFSIGNALED(_status)) {
+    error = Utils::substitute(_("The command was killed by signal %i."), WTERMSIG(_status));
+  } else if (WIFEXITED(_status) && WEXITSTATUS(_status) != 0) {
+    // What the command said is more helpful than its exit status.
+    error = _stderr.size() > 0
+                ? _stderr
+                : Utils::substitute(_("The command exited with status %i."), WEXITSTATUS(_status));
+  } else {
+    ok = true;
   }
+
+  // We might get deleted from here.
+  signal_done.emit(ok, error);
   return false;
 }
@@ -21,24 +21,56 @@
 
 #pragma once
 
+#include <glibmm.h>
 #include <string>
 
 /**
  * \brief Use this class to execute any command and capture its output.
+ *
+ * The command runs through the shell without blocking the main loop. Its input is written to
+ * its standard input and its output is emitted in chunks through signal_output as we read it.
+ * signal_done is emitted from the main loop once the command exited and we read all of its
+ * output, so it's safe to delete the Pipe from there.
  */
 class Pipe {
  public:
-  static bool exec(const std::string &, const std::string &, std::string &, std::string &);
-
- private:
   Pipe(const std::string &);
   ~Pipe();
-  bool exec(const std::string &, std::string &, std::string &);
-  bool ok(std::string &);
+  bool run(std::string &, int, std::string &);
+  void cancel();
 
+  sigc::signal<void, const char *, std::size_t> signal_output;
+  sigc::signal<void, bool, const std::string &> signal_done;
+
+ private:
   Pipe();
   Pipe(const Pipe &);
   Pipe &operator=(const Pipe &);
+
+  static void child_setup();
+  bool in_cb(Glib::IOCondition);
+  bool out_cb(Glib::IOCondition);
+  bool err_cb(Glib::IOCondition);
+  void child_cb(GPid, int);
+  bool timeout_cb();
+  bool done_cb();
+  void kill(const std::string &);
+  void check_done();
+
+  std::string _command;
   bool _ok;
   std::string _err;
+
+  std::string _input;
+  std::string::size_type _written;
+  std::string _stderr;
+
+  GPid _pid;
+  bool _running;
+  int _status;
+  bool _killed;
+  std::string _error;
+  int _in, _out, _errfd;
+
+  sigc::connection in_conn, out_conn, err_conn, child_conn, timeout_conn, done_conn;
 };
@@ -24,14 +24,22 @@
 #include "macros.h"
 #include "previewdialog.hh"
 #include "utils.hh"
+#include <algorithm>
+#include <cmath>
 #include <gtkmm.h>
 
 PreviewDialog::PreviewDialog(const Glib::RefPtr<Gtk::PrintOperationPreview> &prvw,
                              const Glib::RefPtr<Gtk::PrintContext> &ctx,
-                             Gtk::Window *parent):
+                             Gtk::Window *parent,
+                             int cache_size):
  preview(prvw),
  context(ctx),
  n_pages(0),
+ cache(static_cast<std::size_t>(cache_size) * 1024 * 1024),
+ page_width(0),
+ page_height(0),
+ dpi_x(72),
+ dpi_y(72),
  adj(1, 1, 1),
  pages(adj),
  label(""),
@@ -70,7 +78,6 @@ PreviewDialog::PreviewDialog(const Glib::RefPtr<Gtk::PrintOperationPreview> &prv
   Glib::RefPtr<Gdk::Screen> sc = Gdk::Screen::get_default();
 
   set_size_request(sc->get_width() / 2, sc->get_height() / 2);
-  area.set_double_buffered(false);
 
   pages.signal_value_changed().connect(
       sigc::mem_fun(*this, &PreviewDialog::on_signal_value_changed));
@@ -104,6 +111,8 @@ PreviewDialog::~PreviewDialog() {
 
 void PreviewDialog::on_hide()
 {
+  prerender_conn.disconnect();
+  cache.clear();
   preview->end_preview();
   preview.clear();
   context.clear();
@@ -156,9 +165,10 @@ void PreviewDialog::recalculate_gui()
 
 PreviewDialog *PreviewDialog::create(const Glib::RefPtr<Gtk::PrintOperationPreview> &preview,
                                      const Glib::RefPtr<Gtk::PrintContext> &context,
-                                     Gtk::Window *parent)
+                                     Gtk::Window *parent,
+                                     int cache_size)
 {
-  return new PreviewDialog(preview, context, parent);
+  return new PreviewDialog(preview, context, parent, cache_size);
 }
 
 void PreviewDialog::signal_area_realize_cb()
@@ -177,39 +187,133 @@ void PreviewDialog::signal_area_realize_cb()
 
 bool PreviewDialog::signal_area_expose_event_cb(GdkEventExpose *event)
 {
-  if (n_pages == 0) {
+  if (n_pages == 0 || !preview) {
     return false;
   }
-  area.get_window()->clear();
-  if (preview) {
-    preview->render_page(pages.get_value_as_int() - 1);
-  }
+
+  const int nr = pages.get_value_as_int() - 1;
+  Cairo::RefPtr<Cairo::ImageSurface> surface = render_page(nr);
+
+  Cairo::RefPtr<Cairo::Context> ctx = area.get_window()->create_cairo_context();
+  ctx->rectangle(event->area.x, event->area.y, event->area.width, event->area.height);
+  ctx->clip();
+  ctx->set_source(surface, 0, 0);
+  ctx->paint();
+
+  prerender(nr);
   return true;
 }
 
+/**
+ * \brief get a page from the cache, rendering it into an image surface if needed.
+ * \param nr the page number, starting from 0.
+ */
+Cairo::RefPtr<Cairo::ImageSurface> PreviewDialog::render_page(int nr)
+{
+  Cairo::RefPtr<Cairo::ImageSurface> surface = cache.get(nr, page_width);
+  if (surface) {
+    return surface;
+  }
+
+  surface = Cairo::ImageSurface::create(Cairo::FORMAT_RGB24,
+                                        std::max(page_width, 1),
+                                        std::max(page_height, 1));
+  _render_ctx = Cairo::Context::create(surface);
+  _render_ctx->set_source_rgb(1, 1, 1);
+  _render_ctx->paint();
+
+  context->set_cairo_context(_render_ctx, dpi_x, dpi_y);
+  Glib::RefPtr<Pango::Layout> layout = signal_get_layout.emit();
+  if (layout) {
+    layout->update_from_cairo_context(_render_ctx);
+  }
+
+  preview->render_page(nr);
+  _render_ctx.clear();
+
+  // The page size might have changed while rendering. Don't keep a page of the wrong size.
+  if (surface->get_width() == page_width && surface->get_height() == page_height) {
+    cache.put(nr, surface);
+  }
+
+  return surface;
+}
+
+/**
+ * \brief queue the pages around the shown one for rendering when we are idle.
+ * \param nr the shown page.
+ */
+void PreviewDialog::prerender(int nr)
+{
+  _prerender.clear();
+  const int neighbours[] = {nr + 1, nr - 1};
+  for (int page : neighbours) {
+    if (page >= 0 && page < n_pages && !cache.has(page, page_width)) {
+      _prerender.push_back(page);
+    }
+  }
+
+  if (!_prerender.empty() && !prerender_conn.connected()) {
+    prerender_conn = Glib::signal_idle().connect(
+        sigc::mem_fun(*this, &PreviewDialog::prerender_worker), Glib::PRIORITY_LOW);
+  }
+}
+
+bool PreviewDialog::prerender_worker()
+{
+  if (_prerender.empty() || !preview) {
+    return false;
+  }
+
+  const int nr = _prerender.front();
+  _prerender.erase(_prerender.begin());
+  render_page(nr);
+
+  return !_prerender.empty();
+}
+
 void PreviewDialog::signal_preview_ready_cb(const Glib::RefPtr<Gtk::PrintContext> &ctx)
 {
   n_pages = signal_get_n_pages.emit();
   pages.set_range(1, n_pages);
   label.set_text(Utils::substitute(_("of %i"), n_pages));
+
+  // The document was paginated again. Whatever we have is stale.
+  cache.clear();
+  set_page_size(ctx->get_page_setup());
   area.queue_draw();
 }
 
 void PreviewDialog::signal_preview_got_page_size_cb(const Glib::RefPtr<Gtk::PrintContext> &ctx,
                                                     const Glib::RefPtr<Gtk::PageSetup> &setup)
 {
-  Gtk::PaperSize paper_size = setup->get_paper_size();
-
-  area.set_size_request((int) ceil(paper_size.get_width(Gtk::UNIT_POINTS)),
-                        (int) ceil(paper_size.get_height(Gtk::UNIT_POINTS)));
+  set_page_size(setup);
+  dpi_x = ctx->get_dpi_x();
+  dpi_y = ctx->get_dpi_y();
 
-  // Avoid getting an odd allocation.
-  if (area.is_realized()) {
-    Cairo::RefPtr<Cairo::Context> cairo_ctx = area.get_window()->create_cairo_context();
-    context->set_cairo_context(cairo_ctx, ctx->get_dpi_x(), ctx->get_dpi_y());
+  // Keep drawing into the surface we are rendering to.
+  if (_render_ctx) {
+    context->set_cairo_context(_render_ctx, dpi_x, dpi_y);
     Glib::RefPtr<Pango::Layout> layout = signal_get_layout.emit();
     if (layout) {
-      layout->update_from_cairo_context(cairo_ctx);
+      layout->update_from_cairo_context(_render_ctx);
     }
   }
 }
+
+void PreviewDialog::set_page_size(const Glib::RefPtr<Gtk::PageSetup> &setup)
+{
+  if (!setup) {
+    return;
+  }
+
+  Gtk::PaperSize paper_size = setup->get_paper_size();
+  const int width = static_cast<int>(ceil(paper_size.get_width(Gtk::UNIT_POINTS)));
+  const int height = static_cast<int>(ceil(paper_size.get_height(Gtk::UNIT_POINTS)));
+
+  if (width != page_width || height != page_height) {
+    page_width = width;
+    page_height = height;
+    area.set_size_request(page_width, page_height);
+  }
+}
@@ -21,13 +21,16 @@
 
 #pragma once
 
+#include "pagecache.hh"
 #include <gtkmm.h>
+#include <vector>
 
 class PreviewDialog: public Gtk::Dialog {
  public:
   static PreviewDialog *create(const Glib::RefPtr<Gtk::PrintOperationPreview> &,
                                const Glib::RefPtr<Gtk::PrintContext> &,
-                               Gtk::Window *);
+                               Gtk::Window *,
+                               int);
   void run();
   sigc::signal<int> signal_get_n_pages;
   sigc::signal<Glib::RefPtr<Pango::Layout> > signal_get_layout;
@@ -35,7 +38,8 @@ class PreviewDialog: public Gtk::Dialog {
  private:
   PreviewDialog(const Glib::RefPtr<Gtk::PrintOperationPreview> &,
                 const Glib::RefPtr<Gtk::PrintContext> &,
-                Gtk::Window *);
+                Gtk::Window *,
+                int);
   //  ~PreviewDialog();
 
   void recalculate_gui();
@@ -51,6 +55,11 @@ class PreviewDialog: public Gtk::Dialog {
   void signal_area_realize_cb();
   bool signal_area_expose_event_cb(GdkEventExpose *);
 
+  Cairo::RefPtr<Cairo::ImageSurface> render_page(int);
+  void set_page_size(const Glib::RefPtr<Gtk::PageSetup> &);
+  void prerender(int);
+  bool prerender_worker();
+
   void signal_preview_ready_cb(const Glib::RefPtr<Gtk::PrintContext> &);
   void signal_preview_got_page_size_cb(const Glib::RefPtr<Gtk::PrintContext> &,
                                        const Glib::RefPtr<Gtk::PageSetup> &);
@@ -60,6 +69,15 @@ class PreviewDialog: public Gtk::Dialog {
 
   int n_pages;
 
+  // Rendered pages, and the neighbours of the shown page still to be prerendered.
+  PageCache cache;
+  std::vector<int> _prerender;
+  sigc::connection prerender_conn;
+  // Set while a page is being rendered into an image surface.
+  Cairo::RefPtr<Cairo::Context> _render_ctx;
+  int page_width, page_height;
+  double dpi_x, dpi_y;
+
   Gtk::HBox hbox;
 
   Gtk::Adjustment adj;
@@ -23,6 +23,7 @@
 
 #include "macros.h"
 #include "print.hh"
+#include <algorithm>
 
 Print::Print(Conf &conf,
              Document *doc,
@@ -30,6 +31,7 @@ Print::Print(Conf &conf,
              Glib::RefPtr<PrintSettings> &settings):
  _conf(conf),
  _doc(doc),
+ _previewing(false),
  applet(conf),
  _page_setup(page_setup),
  _settings(settings)
@@ -42,8 +44,11 @@ Print::Print(Conf &conf,
   //  std::cout << _conf.print_get("pdf_entry", path) << std::endl;
   set_print_settings(_settings);
   set_default_page_setup(_page_setup->get_page_setup());
+  paginator.signal_create_layout.connect(sigc::mem_fun(this, &Print::create_layout));
+  paginator.signal_get_lines.connect(sigc::mem_fun(this, &Print::get_lines));
 #ifndef GLIBMM_DEFAULT_SIGNAL_HANDLERS_ENABLED
   signal_begin_print().connect(sigc::mem_fun(this, &Print::on_begin_print));
+  signal_paginate().connect(sigc::mem_fun(this, &Print::on_paginate));
   signal_draw_page().connect(sigc::mem_fun(this, &Print::on_draw_page));
   signal_preview().connect(sigc::mem_fun(this, &Print::on_preview), false);
   signal_create_custom_widget().connect(sigc::mem_fun(this, &Print::on_create_custom_widget));
@@ -102,102 +107,80 @@ bool Print::run(std::string &error, Gtk::PrintOperationAction print_action)
 
 void Print::on_begin_print(const Glib::RefPtr<Gtk::PrintContext> &context)
 {
-  // You must handle this signal, because this is where you create and set up
-  // a Pango::Layout using the provided Gtk::PrintContext, and break up your
-  // printing output into pages.
-
-  layout = context->create_pango_layout();
-  Pango::FontDescription font =
-      Pango::FontDescription(_conf.print_get("print_font", "Sans Regular 12"));
-  layout->set_font_description(font);
-
-  const double width = context->get_width();
-  const double height = context->get_height();
-  layout->set_width(static_cast<int>(width * Pango::SCALE));
-
-  // Now let's set the number of pages.
-  layout->set_text(_doc->get_text());
-  const int line_count = layout->get_line_count();
-  Glib::RefPtr<Pango::LayoutLine> layout_line;
-  double page_height = 0;
-
-  std::vector<int> _nr;
-
-  for (int line = 0; line < line_count; line++) {
-    Pango::Rectangle ink_rect, logical_rect;
-    layout_line = layout->get_line(line);
-    layout_line->get_extents(ink_rect, logical_rect);
-    const double line_height = logical_rect.get_height() / 1024.0;
-    if (page_height + line_height > height) {
-      pages.push_back(_nr);
-      _nr.clear();
-      _nr.push_back(line);
-      page_height = 0;
-    } else if (page_height + line_height == height) {
-      _nr.push_back(line);
-      pages.push_back(_nr);
-      _nr.clear();
-      page_height += line_height;
-    } else {
-      _nr.push_back(line);
-      page_height += line_height;
-    }
-  }
+  // Nothing is laid out here. on_paginate() lays out one block of lines per call so the
+  // progress dialog stays responsive.
+  _context = context;
+  paginator.reset(Pango::FontDescription(_conf.print_get("print_font", "Sans Regular 12")),
+                  context->get_width(),
+                  context->get_height(),
+                  _doc->get_line_count(),
+                  get_last_page());
+}
 
-  if (_nr.size() > 0) {
-    pages.push_back(_nr);
-  }
+bool Print::on_paginate(const Glib::RefPtr<Gtk::PrintContext> &context)
+{
+  const bool done = paginator.paginate();
 
-  set_n_pages(pages.size());
+  // The progress dialog shows the number of pages prepared so far.
+  set_n_pages(paginator.get_n_pages());
+  return done;
 }
 
 void Print::on_draw_page(const Glib::RefPtr<Gtk::PrintContext> &context, std::size_t nr)
 {
   // You must handle this signal, which provides a PrintContext and a page number.
   // The PrintContext should be used to create a Cairo::Context into which the provided
-  // page should be drawn. To render text, iterate over the Pango::Layout you created
-  // in the begin_print handler.
+  // page should be drawn.
 
-  if ((!context) || (!layout)) {
+  if (!context) {
     return;
   }
 
-  if (nr > pages.size()) {
-    // This shouldn't happen but just in case.
-    return;
-  }
-
-  std::vector<int> &lines = pages[nr];
-  // TODO: Is this correct ??
-  if (lines.empty()) {
-    return;
-  }
+  _context = context;
+  paginator.draw_page(context->get_cairo_context(), nr);
+}
 
-  Cairo::RefPtr<Cairo::Context> ctx = context->get_cairo_context();
+Glib::RefPtr<Pango::Layout> Print::create_layout()
+{
+  return _context->create_pango_layout();
+}
 
-  // TODO: configurable.
-  ctx->set_source_rgb(0, 0, 0);
+void Print::get_lines(std::vector<Glib::ustring> &lines, int first, int last)
+{
+  _doc->get_lines(lines, first, last);
+}
 
-  Glib::RefPtr<Pango::LayoutLine> layout_line;
-  int y = 0;
-  for (unsigned x = 0; x < lines.size(); x++) {
-    int i = lines[x];
-    layout_line = layout->get_line(i);
-    Glib::RefPtr<Pango::LayoutLine> layout_line = layout->get_line(i);
-    Pango::Rectangle logical_rect = layout_line->get_logical_extents();
+int Print::get_last_page()
+{
+  // The preview always shows the whole document.
+  if (_previewing) {
+    return -1;
+  }
 
-    y += logical_rect.get_height();
-    ctx->move_to(0, y / 1024.0);
+  Glib::RefPtr<Gtk::PrintSettings> settings = get_print_settings();
+  if (!settings || settings->get_print_pages() != Gtk::PRINT_PAGES_RANGES) {
+    return -1;
+  }
 
-    layout_line->show_in_cairo_context(ctx);
+  int n = 0;
+  GtkPageRange *ranges = gtk_print_settings_get_page_ranges(settings->gobj(), &n);
+  int last = -1;
+  for (int x = 0; x < n; x++) {
+    last = std::max(last, ranges[x].end);
   }
+  g_free(ranges);
+
+  return last;
 }
 
 bool Print::on_preview(const Glib::RefPtr<Gtk::PrintOperationPreview> &preview,
                        const Glib::RefPtr<Gtk::PrintContext> &context,
                        Gtk::Window *parent)
 {
-  _preview = PreviewDialog::create(preview, context, parent);
+  _previewing = true;
+  // The preview cache size is in megabytes.
+  _preview = PreviewDialog::create(
+      preview, context, parent, _conf.print_get("preview_cache_size", 32));
   _preview->signal_get_n_pages.connect(sigc::mem_fun(this, &Print::get_n_pages));
   _preview->signal_get_layout.connect(sigc::mem_fun(this, &Print::get_layout));
   _preview->signal_hide().connect(sigc::mem_fun(this, &Print::on_preview_window_hide));
@@ -230,16 +213,18 @@ void Print::on_custom_widget_apply(Gtk::Widget *)
 
 void Print::on_done(Gtk::PrintOperationResult result)
 {
+  paginator.clear();
+  _context.clear();
   // TODO:
   //  _preview.clear();
 }
 
 int Print::get_n_pages()
 {
-  return pages.size();
+  return paginator.get_n_pages();
 }
 
 Glib::RefPtr<Pango::Layout> Print::get_layout()
 {
-  return layout;
+  return paginator.get_layout();
 }
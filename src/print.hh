@@ -25,9 +25,11 @@
 #include "conf.hh"
 #include "document.hh"
 #include "pagesetup.hh"
+#include "paginator.hh"
 #include "previewdialog.hh"
 #include "printsettings.hh"
 #include <gtkmm.h>
+#include <vector>
 
 class Print: public Gtk::PrintOperation {
  public:
@@ -41,6 +43,7 @@ class Print: public Gtk::PrintOperation {
 
   // Printing part.
   void on_begin_print(const Glib::RefPtr<Gtk::PrintContext> &context);
+  bool on_paginate(const Glib::RefPtr<Gtk::PrintContext> &context);
   void on_draw_page(const Glib::RefPtr<Gtk::PrintContext> &, std::size_t nr);
 
   // Custom widget.
@@ -57,11 +60,16 @@ class Print: public Gtk::PrintOperation {
 
  private:
   int get_n_pages();
+  int get_last_page();
   Glib::RefPtr<Pango::Layout> get_layout();
+  Glib::RefPtr<Pango::Layout> create_layout();
+  void get_lines(std::vector<Glib::ustring> &, int, int);
 
   Conf &_conf;
-  Glib::RefPtr<Pango::Layout> layout;
+  Paginator paginator;
+  Glib::RefPtr<Gtk::PrintContext> _context;
   Document *_doc;
+  bool _previewing;
 
 #ifdef ENABLE_PRINT
   PrintApplet applet;
@@ -70,5 +78,4 @@ class Print: public Gtk::PrintOperation {
   PreviewDialog *_preview;
   Glib::RefPtr<PageSetup> &_page_setup;
   Glib::RefPtr<PrintSettings> &_settings;
-  std::vector<std::vector<int> > pages;
 };
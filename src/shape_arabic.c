@@ -1041,9 +1041,8 @@ unshape_node unshaping_table[] = {
 /* clang-format on */
 /* *INDENT-ON* */
 
-gunichar *unshape_arabic(gunichar *src, unsigned len, unsigned *_len)
+unsigned unshape_arabic_length(const gunichar *src, unsigned len)
 {
-  // First we calculate the length of the string we are gooing to allocate.
   unsigned length = 0;
   gunichar ch;
   unsigned x;
@@ -1062,10 +1061,13 @@ gunichar *unshape_arabic(gunichar *src, unsigned len, unsigned *_len)
     }
   }
 
-  *_len = length;
-  // Now we have the length.
-  gunichar *out = g_malloc(sizeof(gunichar) * (length + 1));
+  return length;
+}
 
+unsigned unshape_arabic_to(const gunichar *src, unsigned len, gunichar *out)
+{
+  gunichar ch;
+  unsigned x;
   unsigned y = 0;
   for (x = 0; x < len; x++) {
     ch = src[x];
@@ -1083,16 +1085,24 @@ gunichar *unshape_arabic(gunichar *src, unsigned len, unsigned *_len)
       }
     }
   }
-  out[y] = 0x0;
 
-  return out;
+  return y;
 }
 
-gunichar *shape_arabic(gunichar *src, unsigned len, unsigned *_len)
+gunichar *unshape_arabic(gunichar *src, unsigned len, unsigned *_len)
 {
-  gunichar *out = g_malloc(sizeof(gunichar) * (len + 1));
-  out[len] = 0x0;
+  // First we calculate the length of the string we are gooing to allocate.
+  unsigned length = unshape_arabic_length(src, len);
 
+  gunichar *out = g_malloc(sizeof(gunichar) * (length + 1));
+  *_len = unshape_arabic_to(src, len, out);
+  out[*_len] = 0x0;
+
+  return out;
+}
+
+unsigned shape_arabic_to(const gunichar *src, unsigned len, gunichar *out)
+{
   unsigned y;
   unsigned x = 0;
 
@@ -1111,13 +1121,13 @@ gunichar *shape_arabic(gunichar *src, unsigned len, unsigned *_len)
       continue;
     }
 
-    if (((src[y - 1] < 0x621) || (src[y - 1] > 0x64A)) ||
+    if ((y == 0) || ((src[y - 1] < 0x621) || (src[y - 1] > 0x64A)) ||
         (!(shaping_table[(src[y - 1] - 0x621)].initial) &&
          !(shaping_table[(src[y - 1] - 0x621)].medial))) {
       have_previous = FALSE;
     }
 
-    if (((src[y + 1] < 0x621) || (src[y + 1] > 0x64A)) ||
+    if ((y + 1 == len) || ((src[y + 1] < 0x621) || (src[y + 1] > 0x64A)) ||
         (!(shaping_table[(src[y + 1] - 0x621)].medial) &&
          !(shaping_table[(src[y + 1] - 0x621)].final) && (src[y + 1] != 0x640))) {
       have_next = FALSE;
@@ -1183,7 +1193,14 @@ gunichar *shape_arabic(gunichar *src, unsigned len, unsigned *_len)
     }
   }
 
-  out[x] = 0x0;
-  *_len = x;
+  return x;
+}
+
+gunichar *shape_arabic(gunichar *src, unsigned len, unsigned *_len)
+{
+  gunichar *out = g_malloc(sizeof(gunichar) * (len + 1));
+  *_len = shape_arabic_to(src, len, out);
+  out[*_len] = 0x0;
+
   return out;
 }
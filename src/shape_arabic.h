@@ -30,6 +30,27 @@ extern "C" {
 gunichar *shape_arabic(gunichar *, unsigned, unsigned *);
 gunichar *unshape_arabic(gunichar *, unsigned, unsigned *);
 
+/* Same as above but they write to a buffer the caller owns. shape_arabic_to() needs room for
+ * as many characters as the source, unshape_arabic_to() for unshape_arabic_length() of them.
+ * Both return the number of characters written. */
+unsigned shape_arabic_to(const gunichar *, unsigned, gunichar *);
+unsigned unshape_arabic_length(const gunichar *, unsigned);
+unsigned unshape_arabic_to(const gunichar *, unsigned, gunichar *);
+
+/* The isolated lam-alef ligatures U+FEF5, U+FEF7, U+FEF9 and U+FEFB split into ARABIC_LAM
+ * and the alef lam_alef() returns. Anything else gives 0. It's inline and doesn't need
+ * shape_arabic.c so it can be used without fribidi. */
+#define ARABIC_LAM 0x0644
+
+static inline gunichar lam_alef(gunichar ch)
+{
+  static const gunichar alef[] = {0x0622, 0x0623, 0x0625, 0x0627};
+  if (ch < 0xFEF5 || ch > 0xFEFB || !(ch & 1)) {
+    return 0;
+  }
+  return alef[(ch - 0xFEF5) / 2];
+}
+
 #ifdef __cplusplus
 }
 #endif
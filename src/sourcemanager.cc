@@ -27,8 +27,15 @@
 #include <gtksourceview/gtksourceview.h>
 #include <iostream>
 
+// The language manager reads every language file it knows about, We only do that when something
+// actually needs a language.
 void SourceManager::init()
 {
+  if (loaded) {
+    return;
+  }
+  loaded = true;
+
   manager = gtk_source_language_manager_get_default();
   if (manager == NULL) {
     return;
@@ -54,6 +61,7 @@ void SourceManager::init()
 
 SourceCategory &SourceManager::get_categories()
 {
+  init();
   return cats;
 }
 
@@ -63,12 +71,14 @@ SourceCategory &SourceManager::get_categories()
 
 const char *SourceManager::get_name(const std::string &id)
 {
+  init();
   return gtk_source_language_get_name(
       gtk_source_language_manager_get_language(manager, id.c_str()));
 }
 
 std::string SourceManager::get_language_for_file(const std::string &file)
 {
+  init();
   bool uncertain = false;
   Glib::ustring _mime = Gio::content_type_guess(file, NULL, 0, uncertain);
 
@@ -136,8 +146,10 @@ std::string SourceManager::get_language_for_file(const std::string &file)
 
 GtkSourceLanguage *SourceManager::get_language(const std::string &id)
 {
+  init();
   return gtk_source_language_manager_get_language(manager, id.c_str());
 }
 
+bool SourceManager::loaded = false;
 GtkSourceLanguageManager *SourceManager::manager;
 SourceCategory SourceManager::cats;
@@ -32,7 +32,6 @@ typedef SourceCategory::iterator SourceCategoryIter;
 
 class SourceManager {
  public:
-  static void init();
   static SourceCategory &get_categories();
   static GtkSourceLanguage *get_language(const std::string &);
   static std::string get_language_for_file(const std::string &);
@@ -42,6 +41,9 @@ class SourceManager {
   SourceManager();
   ~SourceManager();
 
+  static void init();
+
+  static bool loaded;
   static GtkSourceLanguageManager *manager;
   static SourceCategory cats;
 };
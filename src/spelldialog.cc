@@ -24,6 +24,7 @@
 #include "dialogs.hh"
 #include "macros.h"
 #include "spelldialog.hh"
+#include "utils.hh"
 #include <gtkmm.h>
 
 // TODO: Add replace all
@@ -77,6 +78,9 @@ SpellDialog::SpellDialog(Document *doc):
   table.attach(misspelled_word, 1, 2, 0, 1, Gtk::FILL | Gtk::EXPAND, Gtk::FILL | Gtk::EXPAND, 5);
   table.attach(entry, 1, 2, 1, 2, Gtk::FILL | Gtk::EXPAND, Gtk::FILL | Gtk::EXPAND, 5);
   table.attach(check, 2, 3, 1, 2);
+  table.attach(count, 0, 3, 2, 3, Gtk::FILL | Gtk::EXPAND, Gtk::FILL | Gtk::EXPAND, 5);
+  // We decide whether it's shown or not.
+  count.set_no_show_all(true);
 
   table.set_spacings(5);
 
@@ -149,6 +153,15 @@ void SpellDialog::got_misspelled(std::string &word, std::vector<std::string> &su
 {
   misspelled_word.set_text(word);
 
+  int n = _doc->spell_dialog_helper_misspelled_count();
+  if (n == -1) {
+    count.hide();
+  } else {
+    count.set_text(
+        Utils::substitute(ngettext("%d misspelled word", "%d misspelled words", n), n));
+    count.show();
+  }
+
   populate_suggestions(suggestions);
 }
 
@@ -52,7 +52,7 @@ class SpellDialog: public Gtk::Window {
 
   //  Gtk::Window window;
   Gtk::Button close, ignore, ignore_all, change, /*change_all,*/ check, add;
-  Gtk::Label misspelled_word, misspelled, change_to;
+  Gtk::Label misspelled_word, misspelled, change_to, count;
   Gtk::Image image;
   Gtk::VBox vbox1, vbox2;
   Gtk::HBox hbox1, hbox2, hbox3;
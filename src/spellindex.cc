@@ -0,0 +1,111 @@
+/*
+ * spellindex.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include "spellindex.hh"
+#include <algorithm>
+
+/**
+ * \brief find the first range that ends after an offset.
+ *
+ * Ranges never overlap so their ends are sorted too.
+ */
+std::vector<SpellIndex::Range>::iterator SpellIndex::first_after(int offset)
+{
+  return std::upper_bound(ranges.begin(),
+                          ranges.end(),
+                          offset,
+                          [](int o, const Range &r) { return o < r.second; });
+}
+
+/**
+ * \brief add a misspelled range.
+ * \param s the start offset.
+ * \param e the end offset.
+ */
+void SpellIndex::add(int s, int e)
+{
+  remove(s, e);
+  std::vector<Range>::iterator iter = first_after(s);
+  ranges.insert(iter, Range(s, e));
+}
+
+/**
+ * \brief drop every range that intersects [s, e).
+ */
+void SpellIndex::remove(int s, int e)
+{
+  std::vector<Range>::iterator first = first_after(s);
+  std::vector<Range>::iterator last = first;
+  while ((last != ranges.end()) && (last->first < e)) {
+    ++last;
+  }
+  ranges.erase(first, last);
+}
+
+/**
+ * \brief account for text inserted into the buffer.
+ *
+ * A word the insertion lands inside of is not the same word anymore so it is dropped. The
+ * line is queued for checking again anyway.
+ * \param pos the offset the text was inserted at.
+ * \param len the number of characters inserted.
+ */
+void SpellIndex::insert(int pos, int len)
+{
+  std::vector<Range>::iterator iter = first_after(pos);
+  if ((iter != ranges.end()) && (iter->first < pos)) {
+    iter = ranges.erase(iter);
+  }
+  for (; iter != ranges.end(); iter++) {
+    iter->first += len;
+    iter->second += len;
+  }
+}
+
+/**
+ * \brief account for the text [s, e) erased from the buffer.
+ */
+void SpellIndex::erase(int s, int e)
+{
+  remove(s, e);
+  int len = e - s;
+  for (std::vector<Range>::iterator iter = first_after(s); iter != ranges.end(); iter++) {
+    iter->first -= len;
+    iter->second -= len;
+  }
+}
+
+/**
+ * \brief find the first misspelled range starting at or after an offset.
+ * \return false if there's none.
+ */
+bool SpellIndex::next(int offset, int &s, int &e) const
+{
+  const_iterator iter = std::lower_bound(ranges.begin(),
+                                         ranges.end(),
+                                         offset,
+                                         [](const Range &r, int o) { return r.first < o; });
+  if (iter == ranges.end()) {
+    return false;
+  }
+  s = iter->first;
+  e = iter->second;
+  return true;
+}
@@ -0,0 +1,65 @@
+/*
+ * spellindex.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+/**
+ * \brief An ordered index of the misspelled ranges in a Document.
+ *
+ * The background spell checker fills this as it checks lines. Ranges are stored as
+ * [start, end) character offsets sorted by start so the spell dialog can jump to the next
+ * misspelled word with a binary search instead of re-checking the text.
+ */
+class SpellIndex {
+ public:
+  typedef std::pair<int, int> Range;
+  typedef std::vector<Range>::const_iterator const_iterator;
+
+  void add(int, int);
+  void remove(int, int);
+  void insert(int, int);
+  void erase(int, int);
+  bool next(int, int &, int &) const;
+
+  void clear()
+  {
+    ranges.clear();
+  }
+  int count() const
+  {
+    return ranges.size();
+  }
+  const_iterator begin() const
+  {
+    return ranges.begin();
+  }
+  const_iterator end() const
+  {
+    return ranges.end();
+  }
+
+ private:
+  std::vector<Range>::iterator first_after(int);
+
+  std::vector<Range> ranges;
+};
@@ -28,16 +28,57 @@
 #include <cassert>
 #endif
 
-SpellMenu::SpellMenu()
+SpellMenu::SpellMenu(): populated(false)
 {
-  katoob_spell_list_available(dicts);
-  for (unsigned x = 0; x < dicts.size(); x++) {
+  // Listing the dictionaries loads all the enchant providers. Until the main loop is idle we only
+  // have the active one.
+  populate_conn = Glib::signal_idle().connect(sigc::mem_fun(*this, &SpellMenu::populate),
+                                              Glib::PRIORITY_LOW);
+}
+
+SpellMenu::~SpellMenu()
+{
+  populate_conn.disconnect();
+}
+
+bool SpellMenu::populate()
+{
+  std::vector<std::string> available;
+  katoob_spell_list_available(available);
+
+  // The rows go around the active one so it stays active and we don't emit changed.
+  std::string active = dicts.size() > 0 ? dicts[0] : "";
+  bool found = false;
+  for (unsigned x = 0; x < available.size(); x++) {
+    if ((!found) && (available[x] == active)) {
+      found = true;
+      continue;
+    }
 #ifdef ENABLE_ISOCODES
-    append_text(iso_codes.translate(dicts[x]));
+    insert_text(x, iso_codes.translate(available[x]));
 #else
-    append_text(dicts[x]);
+    insert_text(x, available[x]);
 #endif
   }
+
+#ifdef ENABLE_ISOCODES
+  if (active.size() > 0) {
+    Gtk::TreeModel::iterator iter = get_active();
+    if (iter) {
+      (*iter).set_value(0, Glib::ustring(iso_codes.translate(active)));
+    }
+  }
+#endif
+
+  // An active dictionary we don't have ends up last.
+  if ((!found) && (active.size() > 0)) {
+    available.push_back(active);
+  }
+
+  dicts.swap(available);
+  populated = true;
+
+  return false;
 }
 
 const Glib::ustring SpellMenu::get_active_text()
@@ -53,6 +94,14 @@ const Glib::ustring SpellMenu::get_active_text()
 
 void SpellMenu::set_active_text(const Glib::ustring &str)
 {
+  if (!populated) {
+    clear_items();
+    dicts.assign(1, str);
+    append_text(str);
+    set_active(0);
+    return;
+  }
+
 #ifdef ENABLE_ISOCODES
   return Gtk::ComboBoxText::set_active_text(iso_codes.translate(str));
 #else
@@ -30,13 +30,19 @@
 class SpellMenu: public Gtk::ComboBoxText {
  public:
   SpellMenu();
+  ~SpellMenu();
   const Glib::ustring get_active_text();
   void set_active_text(const Glib::ustring &);
   //  void set_sensitive(bool);
   //  void append_text(const Glib::ustring&);
 
  private:
+  bool populate();
+
+  // One entry per row.
   std::vector<std::string> dicts;
+  bool populated;
+  sigc::connection populate_conn;
 #ifdef ENABLE_ISOCODES
   IsoCodes iso_codes;
 #endif
@@ -0,0 +1,71 @@
+/*
+ * startupprofile.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "startupprofile.hh"
+#include <cstdio>
+
+/**
+ * \brief start timing. Everything is measured from here.
+ */
+void StartupProfile::enable()
+{
+  _enabled = true;
+  _start = g_get_monotonic_time();
+}
+
+/**
+ * \brief end the current phase.
+ * \param phase what we were doing since the previous mark.
+ */
+void StartupProfile::mark(const char *phase)
+{
+  if (_enabled) {
+    _marks.push_back(std::make_pair(phase, g_get_monotonic_time()));
+  }
+}
+
+/**
+ * \brief print how long each phase took to stderr. Later marks are ignored.
+ */
+void StartupProfile::report()
+{
+  if (!_enabled) {
+    return;
+  }
+  _enabled = false;
+
+  gint64 last = _start;
+  for (unsigned x = 0; x < _marks.size(); x++) {
+    fprintf(stderr,
+            "%8.2f ms %8.2f ms  %s\n",
+            (_marks[x].second - last) / 1000.0,
+            (_marks[x].second - _start) / 1000.0,
+            _marks[x].first);
+    last = _marks[x].second;
+  }
+
+  _marks.clear();
+}
+
+bool StartupProfile::_enabled = false;
+gint64 StartupProfile::_start = 0;
+std::vector<std::pair<const char *, gint64> > StartupProfile::_marks;
@@ -0,0 +1,47 @@
+/*
+ * startupprofile.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include <glib.h>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief Times the phases of our startup (--profile-startup).
+ *
+ * Every mark ends a phase that started at the previous one. Marks are ignored unless enable()
+ * was called so they can stay in the code.
+ */
+class StartupProfile {
+ public:
+  static void enable();
+  static bool enabled()
+  {
+    return _enabled;
+  }
+  static void mark(const char *);
+  static void report();
+
+ private:
+  static bool _enabled;
+  static gint64 _start;
+  static std::vector<std::pair<const char *, gint64> > _marks;
+};
@@ -0,0 +1,196 @@
+/*
+ * streamdecoder.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "macros.h"
+#include "streamdecoder.hh"
+#include "utils.hh"
+#include <cerrno>
+#include <glibmm.h>
+
+/**
+ * \brief constructor.
+ * \param encodings our Encodings instance.
+ * \param enc the encoding to use if the text is not UTF-8.
+ */
+StreamDecoder::StreamDecoder(Encodings &encodings, int enc):
+ _encodings(encodings),
+ _fallback(enc),
+ _encoding(-1),
+ cd(reinterpret_cast<GIConv>(-1))
+{
+}
+
+StreamDecoder::~StreamDecoder()
+{
+  if (cd != reinterpret_cast<GIConv>(-1)) {
+    g_iconv_close(cd);
+  }
+}
+
+/**
+ * \brief decode a chunk.
+ * \param data the chunk.
+ * \param len the length of the chunk.
+ * \param out the UTF-8 text will be appended to this.
+ * \param error contains the error, if any.
+ * \return false if the text can't be decoded.
+ */
+bool StreamDecoder::decode(const char *data, std::size_t len, std::string &out, std::string &error)
+{
+  pending.append(data, len);
+
+  if (_encoding == -1) {
+    // ASCII reads the same either way so it can go out before we decide.
+    std::string::size_type x = 0;
+    while (x < pending.size() && static_cast<unsigned char>(pending[x] - 1) < 0x7f) {
+      ++x;
+    }
+    out.append(pending, 0, x);
+    pending.erase(0, x);
+
+    if (pending.empty()) {
+      return true;
+    }
+
+    if (!detect(error)) {
+      return false;
+    }
+
+    if (_encoding == -1) {
+      // We only have part of the first non-ASCII character.
+      return true;
+    }
+  }
+
+  if (_encoding == _encodings.utf8()) {
+    return validate(out, error);
+  }
+
+  return convert(out, error);
+}
+
+/**
+ * \brief check that we are not left with half a character.
+ * \param error contains the error, if any.
+ * \return false if the text ended with an incomplete character.
+ */
+bool StreamDecoder::finish(std::string &error)
+{
+  if (pending.empty()) {
+    return true;
+  }
+
+  error = _("The document ends with an incomplete character.");
+  return false;
+}
+
+/**
+ * \brief pick the encoding from the first non-ASCII character.
+ *
+ * Leaves the encoding undecided if that character is still incomplete.
+ */
+bool StreamDecoder::detect(std::string &error)
+{
+  const gunichar ch = g_utf8_get_char_validated(pending.data(), pending.size());
+  if (ch == static_cast<gunichar>(-2)) {
+    return true;
+  }
+
+  if ((ch != static_cast<gunichar>(-1)) && (ch != 0)) {
+    _encoding = _encodings.utf8();
+    return true;
+  }
+
+  return use_fallback(error);
+}
+
+/**
+ * \brief convert the rest of the text from the encoding we were given.
+ */
+bool StreamDecoder::use_fallback(std::string &error)
+{
+  if (_fallback == _encodings.utf8()) {
+    error = _("I wasn't able to convert the encoding.");
+    return false;
+  }
+
+  cd = g_iconv_open(_encodings.get_charset(_encodings.utf8()).c_str(),
+                    _encodings.get_charset(_fallback).c_str());
+  if (cd == reinterpret_cast<GIConv>(-1)) {
+    error = Utils::substitute(_("Conversion from %s is not supported."),
+                              _encodings.get_charset(_fallback));
+    return false;
+  }
+
+  _encoding = _fallback;
+  return true;
+}
+
+bool StreamDecoder::validate(std::string &out, std::string &error)
+{
+  const gchar *end;
+  const bool valid = g_utf8_validate(pending.data(), pending.size(), &end);
+
+  const std::size_t len = end - pending.data();
+  out.append(pending, 0, len);
+  pending.erase(0, len);
+
+  // Only an incomplete character at the end is acceptable.
+  if (valid ||
+      g_utf8_get_char_validated(pending.data(), pending.size()) == static_cast<gunichar>(-2)) {
+    return true;
+  }
+
+  // The start only looked like UTF-8. Take the rest as the encoding we were given.
+  return use_fallback(error) && convert(out, error);
+}
+
+bool StreamDecoder::convert(std::string &out, std::string &error)
+{
+  gchar *in = const_cast<gchar *>(pending.data());
+  gsize in_left = pending.size();
+  gchar buf[4096];
+
+  while (in_left > 0) {
+    gchar *outp = buf;
+    gsize out_left = sizeof(buf);
+    const gsize res = g_iconv(cd, &in, &in_left, &outp, &out_left);
+    out.append(buf, outp - buf);
+
+    if (res != static_cast<gsize>(-1)) {
+      continue;
+    }
+
+    if (errno == E2BIG) {
+      continue;
+    } else if (errno == EINVAL) {
+      // An incomplete character. Keep it for the next chunk.
+      break;
+    }
+
+    error = Glib::strerror(errno);
+    return false;
+  }
+
+  pending.erase(0, pending.size() - in_left);
+  return true;
+}
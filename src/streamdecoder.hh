@@ -0,0 +1,64 @@
+/*
+ * streamdecoder.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include "encodings.hh"
+#include <glib.h>
+#include <string>
+
+/**
+ * \brief Convert text to UTF-8 as it arrives in arbitrary chunks.
+ *
+ * A chunk may end in the middle of a character. The incomplete bytes are kept and
+ * prepended to the next chunk. ASCII is passed through until the first non-ASCII character,
+ * which picks the encoding: UTF-8 if it's valid UTF-8, otherwise the encoding we were given.
+ * That is only a guess. If invalid UTF-8 turns up later, the rest of the text is converted from
+ * the encoding we were given and what we already returned stays as it was.
+ */
+class StreamDecoder {
+ public:
+  StreamDecoder(Encodings &, int);
+  ~StreamDecoder();
+
+  bool decode(const char *, std::size_t, std::string &, std::string &);
+  bool finish(std::string &);
+
+  int get_encoding() const
+  {
+    return _encoding;
+  }
+
+ private:
+  StreamDecoder(const StreamDecoder &);
+  StreamDecoder &operator=(const StreamDecoder &);
+
+  bool detect(std::string &);
+  bool use_fallback(std::string &);
+  bool validate(std::string &, std::string &);
+  bool convert(std::string &, std::string &);
+
+  Encodings &_encodings;
+  int _fallback;
+  int _encoding;
+  GIConv cd;
+  // Bytes we got but couldn't decode yet.
+  std::string pending;
+};
@@ -0,0 +1,277 @@
+/*
+ * textsnapshot.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "textsnapshot.hh"
+#include <algorithm>
+#include <atomic>
+#include <glib.h>
+
+// The size we aim for, a chunk gets split once it's twice as big.
+#define CHUNK_SIZE 65536
+
+TextSnapshot::TextSnapshot(unsigned long generation, std::size_t bytes, std::size_t chars):
+ _generation(generation),
+ _bytes(bytes),
+ _chars(chars)
+{
+}
+
+/**
+ * \brief put the chunks together.
+ */
+std::string TextSnapshot::text() const
+{
+  std::string out;
+  out.reserve(_bytes);
+  for (const Chunk &chunk: _chunks) {
+    out += *chunk;
+  }
+  return out;
+}
+
+TextChunks::TextChunks(): _active(false), _generation(0), _bytes(0), _chars(0)
+{
+}
+
+/**
+ * \brief start over with an empty text, fill it with append().
+ */
+void TextChunks::reset()
+{
+  pieces.clear();
+  _bytes = 0;
+  _chars = 0;
+  _active = true;
+  changed();
+}
+
+/**
+ * \brief add text to the end, it has the signature of a Document::SegmentSlot.
+ */
+bool TextChunks::append(const char *text, std::size_t len, int, int)
+{
+  _bytes += len;
+  _chars += cut(text, len, pieces.size());
+  changed();
+  return true;
+}
+
+/**
+ * \brief insert text.
+ * \param offset where, in characters.
+ * \param text the text.
+ * \param len the length of text in bytes.
+ */
+void TextChunks::insert(std::size_t offset, const char *text, std::size_t len)
+{
+  if (len == 0) {
+    return;
+  }
+
+  // Our own copy of the last snapshot must not make writable() copy the chunk.
+  _snapshot.reset();
+
+  if (pieces.empty()) {
+    append(text, len, 0, 0);
+    return;
+  }
+
+  std::size_t local;
+  std::size_t x = find(offset, local);
+
+  std::string &str = writable(x);
+  std::size_t at = g_utf8_offset_to_pointer(str.data(), local) - str.data();
+  std::size_t chars = g_utf8_strlen(text, len);
+  str.insert(at, text, len);
+  pieces[x].chars += chars;
+
+  _bytes += len;
+  _chars += chars;
+
+  if (str.size() >= 2 * CHUNK_SIZE) {
+    split(x);
+  }
+
+  changed();
+}
+
+/**
+ * \brief remove text.
+ * \param offset where it starts, in characters.
+ * \param chars how many characters.
+ */
+void TextChunks::erase(std::size_t offset, std::size_t chars)
+{
+  if (chars == 0 || pieces.empty()) {
+    return;
+  }
+
+  _snapshot.reset();
+
+  std::size_t local;
+  std::size_t x = find(offset, local);
+
+  while (chars > 0 && x < pieces.size()) {
+    std::size_t n = std::min(chars, pieces[x].chars - local);
+    std::string &str = writable(x);
+    const char *start = g_utf8_offset_to_pointer(str.data(), local);
+    const char *stop = g_utf8_offset_to_pointer(start, n);
+
+    _bytes -= stop - start;
+    _chars -= n;
+    str.erase(start - str.data(), stop - start);
+    pieces[x].chars -= n;
+    chars -= n;
+    local = 0;
+
+    if (pieces[x].chars == 0) {
+      pieces.erase(pieces.begin() + x);
+    } else {
+      ++x;
+    }
+  }
+
+  // Don't leave lots of tiny chunks behind.
+  if (x > 0) {
+    merge(x - 1);
+  }
+
+  changed();
+}
+
+/**
+ * \brief get a snapshot of the text as it is now.
+ */
+std::shared_ptr<const TextSnapshot> TextChunks::snapshot()
+{
+  if (!_snapshot) {
+    std::shared_ptr<TextSnapshot> snapshot(new TextSnapshot(_generation, _bytes, _chars));
+    snapshot->_chunks.reserve(pieces.size());
+    for (const Piece &piece: pieces) {
+      snapshot->_chunks.push_back(piece.text);
+    }
+    _snapshot = snapshot;
+  }
+
+  return _snapshot;
+}
+
+/**
+ * \brief find the chunk an offset is in.
+ * \param offset the offset in characters.
+ * \param local the offset in that chunk.
+ * \return the index of the chunk.
+ */
+std::size_t TextChunks::find(std::size_t offset, std::size_t &local) const
+{
+  std::size_t x = 0;
+  while (x + 1 < pieces.size() && offset >= pieces[x].chars) {
+    offset -= pieces[x].chars;
+    ++x;
+  }
+
+  local = std::min(offset, pieces[x].chars);
+  return x;
+}
+
+/**
+ * \brief get a chunk we can change, copying it first if a snapshot still has it.
+ */
+std::string &TextChunks::writable(std::size_t x)
+{
+  // Nobody can take a new reference from another thread, use_count() only goes down there.
+  if (pieces[x].text.use_count() > 1) {
+    pieces[x].text = std::make_shared<std::string>(*pieces[x].text);
+  } else {
+    // use_count() is a relaxed load. Pair with the release done by the thread that dropped its
+    // reference so its reads of the chunk happen before our write.
+    std::atomic_thread_fence(std::memory_order_acquire);
+  }
+  return *pieces[x].text;
+}
+
+void TextChunks::changed()
+{
+  ++_generation;
+  // Let the snapshot go, our chunks will be copied only if somebody else still has it.
+  _snapshot.reset();
+}
+
+/**
+ * \brief split a chunk which got too big.
+ */
+void TextChunks::split(std::size_t x)
+{
+  std::shared_ptr<std::string> str = pieces[x].text;
+  pieces.erase(pieces.begin() + x);
+  cut(str->data(), str->size(), x);
+}
+
+/**
+ * \brief cut text into chunks without splitting a character.
+ * \param x where to put them in pieces.
+ * \return how many characters the text has.
+ */
+std::size_t TextChunks::cut(const char *text, std::size_t len, std::size_t x)
+{
+  std::vector<Piece> cuts;
+  std::size_t chars = 0;
+
+  const char *end = text + len;
+  while (text < end) {
+    const char *stop = end;
+    if (stop - text > CHUNK_SIZE) {
+      stop = g_utf8_find_prev_char(text, text + CHUNK_SIZE + 1);
+    }
+
+    Piece piece;
+    piece.text = std::make_shared<std::string>(text, stop - text);
+    piece.chars = g_utf8_strlen(text, stop - text);
+    cuts.push_back(piece);
+
+    chars += piece.chars;
+    text = stop;
+  }
+
+  pieces.insert(pieces.begin() + x, cuts.begin(), cuts.end());
+  return chars;
+}
+
+/**
+ * \brief join a small chunk with the one after it.
+ */
+void TextChunks::merge(std::size_t x)
+{
+  if (x + 1 >= pieces.size()) {
+    return;
+  }
+
+  std::size_t size = pieces[x].text->size() + pieces[x + 1].text->size();
+  if (size > CHUNK_SIZE ||
+      (pieces[x].text->size() >= CHUNK_SIZE / 4 && pieces[x + 1].text->size() >= CHUNK_SIZE / 4)) {
+    return;
+  }
+
+  writable(x) += *pieces[x + 1].text;
+  pieces[x].chars += pieces[x + 1].chars;
+  pieces.erase(pieces.begin() + x + 1);
+}
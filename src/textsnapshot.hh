@@ -0,0 +1,115 @@
+/*
+ * textsnapshot.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * \brief An immutable copy of the text of a Document at some point.
+ *
+ * The text is a list of UTF-8 chunks which are shared with the other snapshots of the same
+ * Document, taking one doesn't copy the text. A snapshot never changes so it can be read from
+ * any thread while the Document is being edited.
+ */
+class TextSnapshot {
+ public:
+  typedef std::shared_ptr<const std::string> Chunk;
+
+  // Bigger for every change of the text.
+  unsigned long generation() const
+  {
+    return _generation;
+  }
+  std::size_t bytes() const
+  {
+    return _bytes;
+  }
+  std::size_t chars() const
+  {
+    return _chars;
+  }
+  // No chunk is split in the middle of a character.
+  const std::vector<Chunk> &chunks() const
+  {
+    return _chunks;
+  }
+
+  std::string text() const;
+
+ private:
+  friend class TextChunks;
+
+  TextSnapshot(unsigned long, std::size_t, std::size_t);
+
+  unsigned long _generation;
+  std::size_t _bytes;
+  std::size_t _chars;
+  std::vector<Chunk> _chunks;
+};
+
+/**
+ * \brief The text of a Document split in chunks, updated as it's edited.
+ *
+ * The chunks are copied on write: a chunk that's still part of a snapshot is copied before it's
+ * changed, all the others are changed in place. It's only used from the main thread.
+ */
+class TextChunks {
+ public:
+  TextChunks();
+
+  bool active() const
+  {
+    return _active;
+  }
+
+  void reset();
+  bool append(const char *, std::size_t, int, int);
+  void insert(std::size_t, const char *, std::size_t);
+  void erase(std::size_t, std::size_t);
+
+  std::shared_ptr<const TextSnapshot> snapshot();
+
+ private:
+  TextChunks(const TextChunks &);
+  TextChunks &operator=(const TextChunks &);
+
+  struct Piece {
+    std::shared_ptr<std::string> text;
+    std::size_t chars;
+  };
+
+  std::size_t find(std::size_t, std::size_t &) const;
+  std::string &writable(std::size_t);
+  void changed();
+  void split(std::size_t);
+  std::size_t cut(const char *, std::size_t, std::size_t);
+  void merge(std::size_t);
+
+  bool _active;
+  unsigned long _generation;
+  std::size_t _bytes;
+  std::size_t _chars;
+  std::vector<Piece> pieces;
+  // The last snapshot, we give it again until the text changes.
+  std::shared_ptr<const TextSnapshot> _snapshot;
+};
@@ -0,0 +1,152 @@
+/*
+ * ucs4string.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "shape_arabic.h"
+#include "ucs4string.hh"
+#include <fribidi/fribidi.h>
+
+Ucs4String::Ucs4String(): len(0)
+{
+  resize(0);
+}
+
+/**
+ * \brief set the size of the text, the characters after the old size are undefined.
+ */
+void Ucs4String::resize(std::size_t n)
+{
+  if (buf.size() < n + 2) {
+    buf.resize(n + 2);
+  }
+  buf[0] = 0x0;
+  buf[n + 1] = 0x0;
+  len = n;
+}
+
+/**
+ * \brief replace the text.
+ * \param str UTF-8 text, it must be valid.
+ * \param n the length of str in bytes.
+ */
+void Ucs4String::assign(const char *str, std::size_t n)
+{
+  // A character can't be shorter than a byte.
+  resize(n);
+
+  const char *end = str + n;
+  gunichar *out = data();
+  std::size_t x = 0;
+  while (str < end) {
+    out[x++] = g_utf8_get_char(str);
+    str = g_utf8_next_char(str);
+  }
+
+  resize(x);
+}
+
+/**
+ * \brief convert the text to UTF-8 and append it.
+ */
+void Ucs4String::append_to(std::string &out) const
+{
+  const gunichar *in = data();
+  std::size_t bytes = 0;
+  for (std::size_t x = 0; x < len; x++) {
+    bytes += g_unichar_to_utf8(in[x], NULL);
+  }
+
+  std::size_t offset = out.size();
+  out.resize(offset + bytes);
+
+  for (std::size_t x = 0; x < len; x++) {
+    offset += g_unichar_to_utf8(in[x], &out[offset]);
+  }
+}
+
+/**
+ * \brief decompose the isolated lam-alef ligatures, like Utils::is_lam_alef()
+ * \param out the result.
+ */
+void Ucs4String::split_lam_alef(Ucs4String &out) const
+{
+  const gunichar *in = data();
+  std::size_t n = len;
+  for (std::size_t x = 0; x < len; x++) {
+    if (lam_alef(in[x])) {
+      ++n;
+    }
+  }
+
+  out.resize(n);
+  gunichar *o = out.data();
+  for (std::size_t x = 0; x < len; x++) {
+    gunichar alef = lam_alef(in[x]);
+    if (alef) {
+      *o++ = ARABIC_LAM;
+      *o++ = alef;
+    } else {
+      *o++ = in[x];
+    }
+  }
+}
+
+/**
+ * \brief apply the arabic shaping.
+ * \param out the shaped text.
+ */
+void Ucs4String::shape(Ucs4String &out) const
+{
+  out.resize(len);
+  out.resize(shape_arabic_to(data(), len, out.data()));
+}
+
+/**
+ * \brief replace the arabic presentation forms with the letters.
+ * \param out the unshaped text.
+ */
+void Ucs4String::unshape(Ucs4String &out) const
+{
+  out.resize(unshape_arabic_length(data(), len));
+  unshape_arabic_to(data(), len, out.data());
+}
+
+/**
+ * \brief reorder the text from the logical to the visual order, right to left.
+ * \param out the reordered text.
+ * \return false if fribidi failed.
+ */
+bool Ucs4String::log2vis(Ucs4String &out) const
+{
+  FriBidiCharType base = FRIBIDI_TYPE_RTL;
+
+  out.resize(len);
+  // fribidi doesn't modify its input but it's not declared const.
+  return fribidi_log2vis(const_cast<gunichar *>(data()), len, &base, out.data(), NULL, NULL, NULL);
+}
+
+/**
+ * \brief remove the unicode bidi control characters.
+ */
+void Ucs4String::remove_bidi_marks()
+{
+  resize(fribidi_remove_bidi_marks(data(), len, NULL, NULL, NULL));
+}
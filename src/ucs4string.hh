@@ -0,0 +1,67 @@
+/*
+ * ucs4string.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include <glib.h>
+#include <string>
+#include <vector>
+
+/**
+ * \brief A UCS-4 string for the shaping and bidi filters.
+ *
+ * The characters are converted from and to UTF-8 in one pass each. The storage is kept between
+ * uses so a filter that runs on every line of a document only allocates when a line is longer
+ * than all the previous ones. The text always has a 0 before and after it.
+ */
+class Ucs4String {
+ public:
+  Ucs4String();
+
+  void assign(const char *, std::size_t);
+  void append_to(std::string &) const;
+  void resize(std::size_t);
+
+  gunichar *data()
+  {
+    return &buf[1];
+  }
+  const gunichar *data() const
+  {
+    return &buf[1];
+  }
+  std::size_t size() const
+  {
+    return len;
+  }
+
+  void split_lam_alef(Ucs4String &) const;
+  void shape(Ucs4String &) const;
+  void unshape(Ucs4String &) const;
+  bool log2vis(Ucs4String &) const;
+  void remove_bidi_marks();
+
+ private:
+  Ucs4String(const Ucs4String &);
+  Ucs4String &operator=(const Ucs4String &);
+
+  std::vector<gunichar> buf;
+  std::size_t len;
+};
@@ -30,12 +30,30 @@ KatoobDoElem::KatoobDoElem(KatoobDoType action, const std::string &t, int p):
 {
 }
 
+/**
+ * \brief a replacement of the whole text.
+ * \param old what undoing puts back.
+ * \param current the text we have now.
+ */
+KatoobDoElem::KatoobDoElem(const std::string &old, const std::string &current):
+ _text(old),
+ _other(current),
+ _pos(0),
+ _action(KATOOB_DO_REPLACE)
+{
+}
+
 KatoobDoElem::~KatoobDoElem()
 {
 }
 
 void KatoobDoElem::toggle()
 {
+  if (_action == KATOOB_DO_REPLACE) {
+    _text.swap(_other);
+    return;
+  }
+
   _action = _action == KATOOB_DO_INSERT ? KATOOB_DO_DELETE : KATOOB_DO_INSERT;
 }
 
@@ -26,13 +26,15 @@
 typedef enum
 {
   KATOOB_DO_INSERT,
-  KATOOB_DO_DELETE
+  KATOOB_DO_DELETE,
+  KATOOB_DO_REPLACE
   /*  KATOOB_DO_ENCODING */
 } KatoobDoType;
 
 class KatoobDoElem {
  public:
   KatoobDoElem(KatoobDoType, const std::string &, int);
+  KatoobDoElem(const std::string &, const std::string &);
   ~KatoobDoElem();
   std::string &text();
   int pos();
@@ -41,6 +43,8 @@ class KatoobDoElem {
 
  private:
   std::string _text;
+  // For KATOOB_DO_REPLACE: the whole text is replaced by _text, and by _other when toggled.
+  std::string _other;
   int _pos;
   KatoobDoType _action;
 };
@@ -0,0 +1,73 @@
+/*
+ * updatebus.cc
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#include <config.h>
+
+#include "updatebus.hh"
+#include <glibmm/main.h>
+
+UpdateBus::UpdateBus(): _pending(0) {}
+
+UpdateBus::~UpdateBus()
+{
+  _conn.disconnect();
+}
+
+/**
+ * \brief queue an update.
+ * \param what one or more UpdateBus::Update values.
+ */
+void UpdateBus::queue(int what)
+{
+  _pending |= what;
+  if (!_conn.connected()) {
+    // Before Gtk resizes and redraws so whatever we update shows in the same frame.
+    _conn = Glib::signal_idle().connect(sigc::mem_fun(*this, &UpdateBus::dispatch),
+                                        G_PRIORITY_HIGH_IDLE);
+  }
+}
+
+/**
+ * \brief dispatch whatever is pending right now.
+ */
+void UpdateBus::flush()
+{
+  _conn.disconnect();
+  dispatch();
+}
+
+/**
+ * \brief drop whatever is pending. Use it after emitting the full state by other means.
+ */
+void UpdateBus::cancel()
+{
+  _conn.disconnect();
+  _pending = 0;
+}
+
+bool UpdateBus::dispatch()
+{
+  int what = _pending;
+  _pending = 0;
+  if (what) {
+    signal_dispatch.emit(what);
+  }
+  return false;
+}
@@ -0,0 +1,57 @@
+/*
+ * updatebus.hh
+ *
+ * This file is part of Katoob.
+ *
+ * Copyright © 2008-2021 Fred Morcos <fm+Katoob@fredmorcos.com>
+ *
+ * This program is free software; you can redistribute it and/or modify it under the terms of the
+ * GNU General Public License as published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with this program; if
+ * not, write to the Free Software Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
+ * 02111-1307, USA.
+ */
+
+#pragma once
+
+#include <sigc++/sigc++.h>
+
+/**
+ * \brief Collapses state change notifications into one dispatch per main loop iteration.
+ *
+ * Every keystroke moves the cursor, modifies the buffer and might change what can be undone.
+ * Instead of emitting a signal for each of those every time, callers queue what changed and
+ * signal_dispatch is emitted once from an idle handler that runs before Gtk redraws.
+ */
+class UpdateBus {
+ public:
+  typedef enum
+  {
+    UPDATE_CURSOR = 1 << 0,
+    UPDATE_MODIFIED = 1 << 1,
+    UPDATE_CAN_UNDO = 1 << 2,
+    UPDATE_CAN_REDO = 1 << 3
+  } Update;
+
+  UpdateBus();
+  ~UpdateBus();
+
+  void queue(int);
+  void flush();
+  void cancel();
+
+  /** \brief emitted with the bitwise or of everything queued since the last dispatch. */
+  sigc::signal<void, int> signal_dispatch;
+
+ private:
+  bool dispatch();
+
+  int _pending;
+  sigc::connection _conn;
+};
@@ -23,6 +23,7 @@
 
 #include "glibmm/miscutils.h"
 #include "macros.h"
+#include "shape_arabic.h"
 #include "utils.hh"
 #include <cerrno>
 #include <cstring>
@@ -65,50 +66,55 @@ std::string Utils::prepend_home_dir(char *str)
   return Glib::build_filename(Glib::get_home_dir(), str);
 }
 
+/**
+ * \brief split the isolated lam-alef ligatures into a lam and an alef.
+ *
+ * Nothing is copied unless there's a ligature, the text is only scanned for their first byte.
+ *
+ * \param src the text.
+ * \param res the text with the ligatures split, only set if we return true.
+ * \return true if there was a ligature.
+ */
 bool Utils::is_lam_alef(const Glib::ustring &src, Glib::ustring &res)
 {
-  res = src;
-  bool ret = false;
-  ret = is_lam_alef(res, static_cast<gunichar>(0x000fef7));
-  ret = (is_lam_alef(res, static_cast<gunichar>(0x000fefb)) == false ? ret : true);
-  ret = (is_lam_alef(res, static_cast<gunichar>(0x000fef5)) == false ? ret : true);
-  ret = (is_lam_alef(res, static_cast<gunichar>(0x000fef9)) == false ? ret : true);
+  const char *data = src.data();
+  const char *end = data + src.bytes();
+  const char *p = data;
+  std::string out;
 
-  return ret;
-}
-
-bool inline Utils::is_lam_alef(Glib::ustring &src, gunichar ch)
-{
-  gunichar repl;
-  switch (ch) {
-    case 0x000fef7:
-      repl = 0x0623;
+  while (end - p >= 3) {
+    p = static_cast<const char *>(memchr(p, 0xEF, end - p - 2));
+    if (!p) {
       break;
-    case 0x000fefb:
-      repl = 0x0627;
-      break;
-    case 0x000fef5:
-      repl = 0x0622;
-      break;
-    case 0x000fef9:
-      repl = 0x0625;
-      break;
-  }
+    }
 
-  bool ret = false;
-  Glib::ustring::size_type offset = src.find(ch);
+    // The ligatures are all U+FExx, three bytes starting with 0xEF.
+    gunichar alef = lam_alef(g_utf8_get_char(p));
+    if (!alef) {
+      ++p;
+      continue;
+    }
+
+    if (out.empty()) {
+      // Each ligature gets a byte longer.
+      out.reserve(src.bytes() + 64);
+    }
+    out.append(data, p - data);
 
-  if (offset != Glib::ustring::npos) {
-    ret = true;
+    char buf[6];
+    out.append(buf, g_unichar_to_utf8(ARABIC_LAM, buf));
+    out.append(buf, g_unichar_to_utf8(alef, buf));
+    p += 3;
+    data = p;
   }
 
-  while (offset != Glib::ustring::npos) {
-    src.replace(offset, 1, 1, static_cast<gunichar>(0x0644));
-    src.insert(offset + 1, 1, repl);
-    offset = src.find(ch, offset);
+  if (data == src.data()) {
+    return false;
   }
 
-  return ret;
+  out.append(data, end - data);
+  res = out;
+  return true;
 }
 
 bool Utils::katoob_file_is_writable(std::string &file)
@@ -153,7 +159,22 @@ void Utils::katoob_set_color(Conf &cf, Gtk::Label *l, KatoobColor c)
   katoob_set_color(cf, *l, c);
 }
 
+static bool write_buffer(int fd, const char *text, std::size_t len)
+{
+  return Utils::write_all(fd, text, len);
+}
+
 bool Utils::katoob_write(Conf &conf, std::string &file, std::string &text, std::string &error)
+{
+  return katoob_write(
+      conf, file, sigc::bind(sigc::ptr_fun(&write_buffer), text.data(), text.size()), error);
+}
+
+/**
+ * \brief write a file, taking a backup of the old one first if we are configured to.
+ * \param writer gets the descriptor of the file and writes the contents to it.
+ */
+bool Utils::katoob_write(Conf &conf, std::string &file, const WriteSlot &writer, std::string &error)
 {
   gchar *f = NULL;
   GError *er = NULL;
@@ -204,7 +225,7 @@ bool Utils::katoob_write(Conf &conf, std::string &file, std::string &text, std::
     er = NULL;
   }
 
-  if (katoob_write(f ? f : file.c_str(), text.c_str(), text.size(), error)) {
+  if (katoob_write(f ? f : file.c_str(), writer, error)) {
     if (!stat_error) {
       katoob_set_perms(f ? f : file.c_str(), buf);
     }
@@ -220,11 +241,16 @@ bool Utils::katoob_write(Conf &conf, std::string &file, std::string &text, std::
   return false;
 }
 
+bool Utils::katoob_write(const char *file, const char *text, unsigned len, std::string &error)
+{
+  return katoob_write(file, sigc::bind(sigc::ptr_fun(&write_buffer), text, len), error);
+}
+
 // We are not using g_file_set_contents() because it'll create a file first
 // and then copy it overwriting the target file. This will fail if we
 // don't have write access to that directory although we have write access
 // to the target file.
-bool Utils::katoob_write(const char *file, const char *text, unsigned len, std::string &error)
+bool Utils::katoob_write(const char *file, const WriteSlot &writer, std::string &error)
 {
   int fd = open(file, O_CREAT | O_TRUNC | O_WRONLY, 0644);
   if (fd == -1) {
@@ -232,8 +258,7 @@ bool Utils::katoob_write(const char *file, const char *text, unsigned len, std::
     return false;
   }
 
-  ssize_t sz = write(fd, text, len);
-  if (sz == -1) {
+  if (!writer(fd)) {
     error = Utils::substitute("I can't write to the file %s\n", file) + std::strerror(errno);
     close(fd);
     return false;
@@ -246,6 +271,26 @@ bool Utils::katoob_write(const char *file, const char *text, unsigned len, std::
   return true;
 }
 
+/**
+ * \brief write all of data, write() may write less than we ask it to.
+ * \return false on error, errno tells which.
+ */
+bool Utils::write_all(int fd, const char *data, std::size_t len)
+{
+  while (len > 0) {
+    ssize_t sz = write(fd, data, len);
+    if (sz == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    data += sz;
+    len -= sz;
+  }
+  return true;
+}
+
 bool Utils::katoob_read(const std::string &file, std::string &out)
 {
   if (Glib::file_test(file, Glib::FILE_TEST_IS_DIR)) {
@@ -475,7 +520,8 @@ std::string Utils::get_recovery_template(std::string suffix)
   return "katoob_autosave_" + suffix;
 }
 
-bool Utils::get_recovery_files(std::map<std::string, std::string> &files, std::string &error)
+// Only the names, The contents are read if the user wants them back.
+bool Utils::get_recovery_files(std::vector<std::string> &files, std::string &error)
 {
   try {
     Glib::Dir dir(recoveryDir());
@@ -494,19 +540,17 @@ bool Utils::get_recovery_files(std::map<std::string, std::string> &files, std::s
         continue;
       }
 
-      // Try to read it:
-      try {
-        std::string str = Glib::file_get_contents(file);
-        if (str.size() == 0) {
-          std::cerr << "Erasing zero sized file " << file << std::endl;
-          unlink(file.c_str());
-          continue;
-        }
-        files[file] = str;
-      } catch (Glib::FileError &err) {
-        std::cerr << "Failed to read " << file << ": " << err.what() << std::endl;
+      struct stat buf;
+      if (stat(file.c_str(), &buf) == -1) {
+        std::cerr << "Failed to stat " << file << ": " << std::strerror(errno) << std::endl;
+        continue;
+      }
+      if (buf.st_size == 0) {
+        std::cerr << "Erasing zero sized file " << file << std::endl;
+        unlink(file.c_str());
         continue;
       }
+      files.push_back(file);
     }
     return true;
   } catch (Glib::FileError &err) {
@@ -42,13 +42,17 @@ namespace Utils {
   std::string get_dir_separator();
   std::string get_data_path(const char *);
   std::string prepend_home_dir(char *);
-  bool inline is_lam_alef(Glib::ustring &, gunichar);
   bool is_lam_alef(const Glib::ustring &, Glib::ustring &);
   bool katoob_file_is_writable(std::string &);
   void katoob_set_color(Conf &, Gtk::Label &, KatoobColor);
   void katoob_set_color(Conf &, Gtk::Label *, KatoobColor);
+  // Writes to the file descriptor it gets, errno tells what went wrong if it returns false.
+  typedef sigc::slot<bool, int> WriteSlot;
   bool katoob_write(Conf &, std::string &, std::string &, std::string &);
+  bool katoob_write(Conf &, std::string &, const WriteSlot &, std::string &);
   bool katoob_write(const char *, const char *, unsigned, std::string &);
+  bool katoob_write(const char *, const WriteSlot &, std::string &);
+  bool write_all(int, const char *, std::size_t);
   bool katoob_read(const std::string &, std::string &);
   void katoob_set_perms(const char *, const struct stat &);
   bool file_copy(const char *, const char *, std::string &);
@@ -64,7 +68,7 @@ namespace Utils {
                          const std::string &,
                          const std::string &);
   bool create_recovery_file(std::string &, int &);
-  bool get_recovery_files(std::map<std::string, std::string> &, std::string &);
+  bool get_recovery_files(std::vector<std::string> &, std::string &);
   std::string get_recovery_template(std::string = "XXXXXX");
 
   std::string katoob_get_default_font();
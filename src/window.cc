@@ -26,31 +26,24 @@
 #include "glibmm/miscutils.h"
 #include "macros.h"
 #include "preferencesdialog.hh"
+#include "startupprofile.hh"
 #include "utils.hh"
 #include "window.hh"
 #include <cassert>
 #include <iostream>
 #include <sstream>
 
-Window::Window(Conf &conf, Encodings &encodings, std::vector<std::string> &files):
+Window::Window(Conf &conf, Encodings &encodings, std::vector<OpenFile> &files):
  _conf(conf),
  _encodings(encodings),
- menubar(conf,
-         encodings
-#ifdef ENABLE_EMULATOR
-         ,
-         Emulator::list_layouts()
-#endif
-#ifdef ENABLE_MULTIPRESS
-             ,
-         Multipress::list_layouts()
-#endif
-             ),
+ menubar(conf, encodings),
  toolbar(conf),
  mdi(conf, encodings),
  statusbar(conf),
  box(false, 0)
 {
+  StartupProfile::mark("Menus, toolbars and notebook");
+
   box.pack_start(menubar, Gtk::PACK_SHRINK, 0);
   box.pack_start(toolbar.get_main(), false, false, 0);
   //  box.pack_start(toolbar.get_extended(), Gtk::PACK_SHRINK, 0);
@@ -70,6 +63,8 @@ Window::Window(Conf &conf, Encodings &encodings, std::vector<std::string> &files
   reset_gui();
 
   mdi.scan_temp();
+  StartupProfile::mark("Recovery scan");
+
   // This is here after we connect the signals
   // So we can get the signals emitted when we create the first document.
   // Now let's create the children.
@@ -79,7 +74,7 @@ Window::Window(Conf &conf, Encodings &encodings, std::vector<std::string> &files
     mdi.create_document();
   } else {
     for (auto &file: files) {
-      mdi.create_document(file);
+      open_file(file);
     }
 
     files.clear();
@@ -91,6 +86,7 @@ Window::Window(Conf &conf, Encodings &encodings, std::vector<std::string> &files
       mdi.create_document();
     }
   }
+  StartupProfile::mark("Documents");
 
   move(conf.get("x", 50), conf.get("y", 50));
   resize(conf.get("w", 500), conf.get("h", 400));
@@ -127,6 +123,7 @@ Window::Window(Conf &conf, Encodings &encodings, std::vector<std::string> &files
   box.show();
   mdi.show_all();
   show();
+  StartupProfile::mark("Show the window");
 
   Document *doc = mdi.get_active();
 
@@ -134,32 +131,6 @@ Window::Window(Conf &conf, Encodings &encodings, std::vector<std::string> &files
     doc->grab_focus();
   }
 
-#ifdef ENABLE_EMULATOR
-  {
-    std::string err;
-
-    if (!Emulator::ok(err)) {
-      std::stringstream errStream;
-      errStream << err << "." << std::endl << std::endl;
-      errStream << _("<b>The keyboard emulator will not work.</b>");
-      katoob_error(errStream.str());
-    }
-  }
-#endif
-
-#ifdef ENABLE_MULTIPRESS
-  {
-    std::string err;
-
-    if (!Multipress::ok(err)) {
-      std::stringstream errStream;
-      errStream << err << "." << std::endl << std::endl;
-      errStream << _("<b>Multipress will not work.</b>");
-      katoob_error(errStream.str());
-    }
-  }
-#endif
-
   std::string ver = conf.get_version();
   if ((ver.empty()) && conf.ok()) {
     katoob_info(_("A lot of the configuration options have been changed in this version.\nPlease "
@@ -602,10 +573,10 @@ void Window::signal_dictionary_changed_cb(std::string d)
 #endif
 
 #ifdef ENABLE_DBUS
-void Window::open_files(std::vector<std::string> &f)
+void Window::open_files(std::vector<OpenFile> &f)
 {
   for (auto &x: f) {
-    mdi.create_document(x);
+    open_file(x);
   }
 
   if (f.empty()) {
@@ -616,6 +587,31 @@ void Window::open_files(std::vector<std::string> &f)
 }
 #endif
 
+/**
+ * \brief open a file we got on the command line, in the encoding and at the position given there.
+ */
+void Window::open_file(OpenFile &file)
+{
+  int enc = -1;
+  if (!file.encoding.empty()) {
+    enc = _encodings.get_by_charset(file.encoding);
+    if (enc == -1) {
+      enc = _encodings.get(file.encoding);
+    }
+    if (enc == -1) {
+      enc = _encodings.get_by_charset(Glib::ustring(file.encoding).uppercase());
+    }
+    if (enc == -1) {
+      katoob_error(Utils::substitute(_("Unknown encoding %s"), file.encoding));
+    }
+  }
+
+  Document *doc = mdi.create_document(file.path, enc);
+  if ((doc) && (file.line > 0)) {
+    doc->scroll_to(file.line, file.column);
+  }
+}
+
 void Window::signal_wrap_text_activate_cb(bool s)
 {
   mdi.set_wrap_text(s);
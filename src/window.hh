@@ -25,6 +25,7 @@
 #include "encodings.hh"
 #include "mdi.hh"
 #include "menubar.hh"
+#include "openfile.hh"
 #include "statusbar.hh"
 #include "toolbar.hh"
 #include <gtkmm.h>
@@ -45,12 +46,12 @@
 
 class Window: public Gtk::Window {
  public:
-  Window(Conf &, Encodings &, std::vector<std::string> &);
+  Window(Conf &, Encodings &, std::vector<OpenFile> &);
   ~Window();
 
   // Our methods.
 #ifdef ENABLE_DBUS
-  void open_files(std::vector<std::string> &);
+  void open_files(std::vector<OpenFile> &);
 #endif
 
 #ifdef ENABLE_SPELL
@@ -62,6 +63,7 @@ class Window: public Gtk::Window {
   auto signal_quit_event() -> sigc::signal<void>;
 
  private:
+  void open_file(OpenFile &);
   // Our signals.
   sigc::signal<void> signal_quit;
 
@@ -132,12 +134,6 @@ class Window: public Gtk::Window {
   void on_document_removed_cb(int);
 
   // Our members.
-#ifdef ENABLE_EMULATOR
-  Emulator _emulator;
-#endif
-#ifdef ENABLE_MULTIPRESS
-  Multipress _multipress;
-#endif
   Conf &_conf;
   Encodings &_encodings;
 